@@ -0,0 +1,47 @@
+include_guard(GLOBAL)
+
+function(add_catch2_benchmarks)
+    # Usage:
+    # add_catch2_benchmarks(
+    #   TARGET <name>
+    #   SOURCES <list...>
+    #   LINK <list ...>
+    #
+    # Benchmarks are plain Catch2 executables using BENCHMARK(...). They are not registered with CTest,
+    # run them manually, e.g. `<name> --benchmark-samples 50`.
+    # The target <name>_json runs all benchmarks and writes the results with the Catch2 JSON reporter
+    # (Catch2 3.5 or newer) to <build>/benchmarks/<name>.json, to compare them against a baseline.
+
+    set(opts)
+    set(one TARGET)
+    set(multi SOURCES LINK)
+
+    cmake_parse_arguments(APP "${opts}" "${one}" "${multi}" ${ARGN})
+
+    if (NOT APP_TARGET)
+        message(FATAL_ERROR "add_catch2_benchmarks: TARGET is required")
+    endif ()
+    if (NOT APP_LINK)
+        message(FATAL_ERROR "add_catch2_benchmarks: LINK (target lib) is required")
+    endif ()
+    if (NOT APP_SOURCES)
+        message(FATAL_ERROR "add_catch2_benchmarks: SOURCES are required")
+    endif ()
+
+    if (NOT BUILD_BENCHMARKS)
+        return()
+    endif ()
+
+    add_executable(${APP_TARGET} ${APP_SOURCES})
+    target_compile_features(${APP_TARGET} PRIVATE cxx_std_20)
+    target_link_libraries(${APP_TARGET} PRIVATE Catch2::Catch2WithMain ${APP_LINK})
+
+    set(json_dir "${CMAKE_BINARY_DIR}/benchmarks")
+    add_custom_target(${APP_TARGET}_json
+            COMMAND ${CMAKE_COMMAND} -E make_directory "${json_dir}"
+            COMMAND $<TARGET_FILE:${APP_TARGET}> --reporter "JSON::out=${json_dir}/${APP_TARGET}.json"
+            DEPENDS ${APP_TARGET}
+            COMMENT "Running ${APP_TARGET}, writing ${json_dir}/${APP_TARGET}.json"
+            USES_TERMINAL
+    )
+endfunction()
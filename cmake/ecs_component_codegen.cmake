@@ -0,0 +1,47 @@
+cmake_minimum_required(VERSION 3.20)
+include_guard(GLOBAL)
+
+# Set variables
+set(COMPONENT_CODEGEN_SCRIPT "${CMAKE_SOURCE_DIR}/tools/component_file_generator.py")
+set(COMPONENT_CODEGEN_ROOT_DIRS
+        ${CMAKE_SOURCE_DIR}/engine/components
+        ${CMAKE_SOURCE_DIR}/gameplay/components
+)
+
+set(GENERATED_DIR "${CMAKE_SOURCE_DIR}/generated")
+set(GENERATED_COMPONENTS_BASE_NAME "ECS_Components")
+set(GENERATED_COMPONENTS_CPP_FILE "${GENERATED_DIR}/${GENERATED_COMPONENTS_BASE_NAME}.gen.cpp")
+set(GENERATED_COMPONENTS_HPP_FILE "${GENERATED_DIR}/${GENERATED_COMPONENTS_BASE_NAME}.gen.hpp")
+
+
+# Find python package
+find_package(Python3 COMPONENTS Interpreter REQUIRED)
+
+# Create target directory
+file(MAKE_DIRECTORY "${GENERATED_DIR}")
+
+# Inputs for rebuild trigger
+message(STATUS "ECS Component Scan Dirs: ${COMPONENT_CODEGEN_ROOT_DIRS}")
+file(GLOB_RECURSE COMPONENT_CODEGEN_INPUTS
+        CONFIGURE_DEPENDS
+        ${COMPONENT_CODEGEN_ROOT_DIRS}/*.hpp
+        ${COMPONENT_CODEGEN_ROOT_DIRS}/*.h
+)
+set(COMPONENT_CODEGEN_ARGS --out "${GENERATED_COMPONENTS_CPP_FILE}" --roots)
+list(APPEND COMPONENT_CODEGEN_ARGS ${COMPONENT_CODEGEN_ROOT_DIRS})
+
+# Trigger code gen script
+add_custom_command(
+        OUTPUT "${GENERATED_COMPONENTS_CPP_FILE}" "${GENERATED_COMPONENTS_HPP_FILE}"
+        COMMAND ${Python3_EXECUTABLE} -u "${COMPONENT_CODEGEN_SCRIPT}" ${COMPONENT_CODEGEN_ARGS}
+        DEPENDS "${COMPONENT_CODEGEN_SCRIPT}" "${COMPONENT_CODEGEN_INPUTS}"
+        COMMENT "Generating ECS component reflection ${GENERATED_COMPONENTS_CPP_FILE}"
+        VERBATIM
+)
+
+# Define target and output parameters of script
+add_custom_target(ecs_component_codegen
+        DEPENDS "${GENERATED_COMPONENTS_CPP_FILE}" "${GENERATED_COMPONENTS_HPP_FILE}"
+)
+
+set(GENERATED_COMPONENTS_CPP "${GENERATED_COMPONENTS_CPP_FILE}")
@@ -213,7 +213,10 @@ namespace Engine::AssetHandling {
             throw std::invalid_argument("No asset found for handle");
         }
 
-        updater(*it->second.asset);
+        // Copy on write, so readers holding the previous version (like the render thread) never see a partial update
+        auto updated = std::make_shared<T>(*it->second.asset);
+        updater(*updated);
+        it->second.asset = std::move(updated);
         ++it->second.revision;
     }
 } // namespace
@@ -120,6 +120,22 @@ TEST_CASE("AssetHandler - Update increases revision", "[AssetHandling]")
     REQUIRE(asset->value == 14);
 }
 
+TEST_CASE("AssetHandler - Update keeps previously fetched assets unchanged", "[AssetHandling]")
+{
+    TestAssetCacheGuard guard;
+    AssetHandler handler;
+    auto handle = handler.LoadAsset<TestAsset>("abc");
+
+    const auto before = handler.GetAsset<TestAsset>(handle);
+    handler.UpdateAsset<TestAsset>(handle, [](TestAsset& a)
+    {
+        a.value = 99;
+    });
+
+    REQUIRE(before->value == 3);
+    REQUIRE(handler.GetAsset<TestAsset>(handle)->value == 99);
+}
+
 TEST_CASE("Asset Handler - Find returns existing handle", "[AssetHandling]")
 {
     TestAssetCacheGuard guard;
@@ -4,9 +4,12 @@
 
 #pragma once
 #include <glm/glm.hpp>
+#include "ComponentReflection.hpp"
 
 namespace Engine::Components {
     struct Camera {
+        friend struct Ecs::ComponentReflection<Camera>;
+
         Camera() {
             m_width = 0;
             m_height = 0;
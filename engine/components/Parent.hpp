@@ -0,0 +1,12 @@
+#pragma once
+#include "Ecs/Types.hpp"
+
+namespace Engine::Components {
+    /**
+     * Attaches an entity to a parent entity. The Transform or RectTransform of the entity is then relative to the
+     * one of its parent, so whole groups move with their parent.
+     */
+    struct Parent {
+        Ecs::EntityId entity;
+    };
+}
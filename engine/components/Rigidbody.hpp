@@ -4,11 +4,14 @@
 
 #pragma once
 #include <glm/vec3.hpp>
+#include "ComponentReflection.hpp"
 
 namespace Engine::Components
 {
     struct Rigidbody
     {
+        friend struct Ecs::ComponentReflection<Rigidbody>;
+
     private:
         glm::vec3 m_velocity{};
         bool m_velocity_fixed;
@@ -7,9 +7,12 @@
 #include <glm/glm.hpp>
 #include <spdlog/spdlog.h>
 
+#include "ComponentReflection.hpp"
 
 namespace Engine::Components {
     struct Transform {
+        friend struct Ecs::ComponentReflection<Transform>;
+
     private:
         glm::vec3 m_position{};
         glm::vec3 m_rotation{};
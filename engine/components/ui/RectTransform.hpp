@@ -4,9 +4,8 @@
 
 #pragma once
 #include <algorithm>
-#include <optional>
 #include <glm/vec2.hpp>
-#include "Ecs/Types.hpp"
+#include "ComponentReflection.hpp"
 
 namespace Engine::Components::UI {
     enum class Anchor {
@@ -22,6 +21,8 @@ namespace Engine::Components::UI {
     };
 
     struct RectTransform {
+        friend struct Ecs::ComponentReflection<RectTransform>;
+
     public:
         RectTransform() = default;
 
@@ -30,7 +31,6 @@ namespace Engine::Components::UI {
 
         [[nodiscard]] glm::vec2 GetPivot() const { return m_pivot; }
         [[nodiscard]] Anchor GetAnchor() const { return m_anchor; }
-        [[nodiscard]] std::optional<Ecs::EntityId> GetParent() const { return m_parent_entity; }
         [[nodiscard]] uint64_t GetVersion() const { return m_version; }
 
         RectTransform &SetPosition(const glm::vec2 local_position) {
@@ -61,18 +61,11 @@ namespace Engine::Components::UI {
             return *this;
         }
 
-        RectTransform &SetParent(const Ecs::EntityId parent_entity) {
-            m_parent_entity = parent_entity;
-            m_version++;
-            return *this;
-        }
-
     private:
         glm::vec2 m_local_position = glm::vec2(0.0f);
         glm::vec2 m_size = glm::vec2(1.0f);
         glm::vec2 m_pivot = glm::vec2(0.5f, 0.5f);
         Anchor m_anchor = Anchor::TopLeft;
-        std::optional<Ecs::EntityId> m_parent_entity;
         uint64_t m_version = 0;
     };
 }
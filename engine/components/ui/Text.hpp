@@ -5,8 +5,14 @@
 #pragma once
 #include <string>
 
+#include "ComponentReflection.hpp"
+#include "ComponentSerializer.hpp"
+
 namespace Engine::Components::UI {
     struct Text {
+        friend struct Ecs::ComponentSerializer<Text>;
+        friend struct Ecs::ComponentReflection<Text>;
+
         Text() {
             m_text_content = "";
             m_font_name = "";
@@ -47,3 +53,26 @@ namespace Engine::Components::UI {
         uint64_t m_font_version;
     };
 }
+
+namespace Engine::Ecs {
+    template<>
+    struct ComponentSerializer<Components::UI::Text> {
+        static void Write(SnapshotWriter& writer, const Components::UI::Text& text) {
+            writer.WriteString(text.m_text_content);
+            writer.WriteString(text.m_font_name);
+            writer.Write<int>(text.m_text_size_in_px);
+            writer.Write<uint64_t>(text.m_text_version);
+            writer.Write<uint64_t>(text.m_font_version);
+        }
+
+        static Components::UI::Text Read(SnapshotReader& reader) {
+            Components::UI::Text text;
+            text.m_text_content = reader.ReadString();
+            text.m_font_name = reader.ReadString();
+            text.m_text_size_in_px = reader.Read<int>();
+            text.m_text_version = reader.Read<uint64_t>();
+            text.m_font_version = reader.Read<uint64_t>();
+            return text;
+        }
+    };
+}
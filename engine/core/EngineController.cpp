@@ -1,11 +1,15 @@
 #include "EngineController.hpp"
 
+#include <cstdio>
+
 #include "CacheManagerFactory.hpp"
 #include "DebugBuilder.hpp"
 #include "EnvironmentBuilder.hpp"
 #include "InputManagerBuilder.hpp"
+#include "JobSystem.hpp"
 #include "RenderControllerFactory.hpp"
 #include "SystemManager.hpp"
+#include "SystemTimingStats.hpp"
 #include "TextController.hpp"
 #include "settings/Settings.hpp"
 #include "settings/SettingsHandler.hpp"
@@ -13,6 +17,7 @@
 namespace Engine::Core {
     EngineController::EngineController() {
         m_services = std::make_unique<ServiceLocator>();
+        m_services->RegisterService(std::make_unique<Jobs::JobSystem>());
         m_cache_manager = Systems::CacheManagerFactory::CreateCacheManager();
         m_file_manager = Environment::EnvironmentBuilder::CreateFileManager();
         m_is_running = true;
@@ -21,14 +26,19 @@ namespace Engine::Core {
     EngineController::~EngineController() = default;
 
 
-    void EngineController::Initialize(const std::vector<Ecs::SystemMeta>& systems) {
+    void EngineController::Initialize(const std::vector<Ecs::SystemMeta>& systems,
+                                      const std::vector<Ecs::ComponentTypeInfo>& component_types) {
+        // Before anything touches a component, so the type ids follow the generated table
+        constexpr std::size_t component_pool_capacity = 1024;
+        Ecs::World::RegisterComponentTypes(component_types, component_pool_capacity);
+
         const auto engine_settings = Settings::SettingsHandler::ReadSettingsFromDisk(m_file_manager.get());
         SetupWindow(engine_settings);
 
         AssetHandling::AssetHandler* asset_handler_service = SetupAssetHandler();
         SetupInputManager(asset_handler_service);
 
-        SetupRenderController(asset_handler_service);
+        SetupRenderController(asset_handler_service, engine_settings.render.render_thread);
 
         auto text_controller = std::make_unique<Text::TextController>(asset_handler_service);
         m_services->RegisterService(std::move(text_controller));
@@ -39,6 +49,7 @@ namespace Engine::Core {
                                                     m_window->GetWindowContext(),
                                                     90
                 );
+        m_debug_console->ShowPage(engine_settings.debug.console_page);
 
         m_system_manager = std::make_unique<Ecs::SystemManager>(systems, m_services.get(), m_cache_manager.get());
 
@@ -127,7 +138,8 @@ namespace Engine::Core {
         m_input_manager = Input::InputManagerBuilder::CreateInputManager(m_window.get(), input_maps);
     }
 
-    void EngineController::SetupRenderController(AssetHandling::AssetHandler* asset_handler_service) const {
+    void EngineController::SetupRenderController(AssetHandling::AssetHandler* asset_handler_service,
+                                                 const bool use_render_thread) const {
         // Load all shader files from disk and store them as assets
         const std::string directory = "resources/shaders";
         const std::vector<std::string> file_extensions = {".vert", ".frag", ".glsl"};
@@ -139,8 +151,9 @@ namespace Engine::Core {
         asset_handler_service->LoadAssets<AssetHandling::ShaderAsset>(shader_files.value);
 
         auto render_controller = Renderer::RenderControllerFactory::CreateRenderController(
-                m_window->GetWindowContext(),
-                asset_handler_service
+                *m_window,
+                asset_handler_service,
+                use_render_thread
                 );
         m_services->RegisterService(std::move(render_controller));
     }
@@ -179,10 +192,13 @@ namespace Engine::Core {
                 m_debug_console->PushValue("Draws:",
                                            m_services->GetService<Renderer::IRenderController>()->GetDrawCalls()
                         );
+                PushSystemTimings();
+                PushWorldMemory();
             }
 
             accumulator += frame_dt;
 
+            m_services->TryGetService<Jobs::JobSystem>()->ExecuteMainThreadJobs();
             m_input_manager->UpdateInput();
             m_scene_manager->PreFixed(frame_dt);
             int steps = 0;
@@ -198,11 +214,86 @@ namespace Engine::Core {
 
             m_debug_console->PushToFrame();
             m_scene_manager->Update(frame_dt);
-            m_window->SwapBuffers();
+            // Hands the extracted frame to the render thread, which draws it while the next tick is simulated
+            m_services->GetService<Renderer::IRenderController>()->SubmitFrame();
+        }
+    }
+
+    void EngineController::PushSystemTimings() const {
+        constexpr auto page = "Systems";
+        const auto format_ms = [](const float ms) {
+            char buffer[16];
+            std::snprintf(buffer, sizeof(buffer), "%.3f", ms);
+            return std::string(buffer);
+        };
+
+        const auto report = m_system_manager->GetTimingReport();
+        for (const auto& phase : report.phases) {
+            m_debug_console->PushText(page,
+                                      std::string(Ecs::GetPhaseName(phase.phase)) + ":",
+                                      format_ms(phase.time.avg_ms) + " / " + format_ms(phase.time.max_ms) + " ms"
+                    );
+        }
+        for (const auto& system : report.systems) {
+            m_debug_console->PushText(page,
+                                      system.name + ":",
+                                      format_ms(system.time.avg_ms) + " / " + format_ms(system.time.p99_ms) + " ms, "
+                                      + std::to_string(system.queried_entities) + " ents"
+                    );
+        }
+    }
+
+    void EngineController::WriteSystemTimings() const {
+        const auto report = m_system_manager->GetTimingReport();
+        if (!m_file_manager->WriteTextToFile("", "system_timings.csv", report.ToCsv())
+            || !m_file_manager->WriteTextToFile("", "system_timings.json", report.ToJson())) {
+            spdlog::warn("Failed to write the system timings.");
+        }
+    }
+
+    void EngineController::PushWorldMemory() const {
+        constexpr auto page = "Memory";
+        const auto to_kb = [](const std::size_t bytes) { return std::to_string(bytes / 1024) + " KB"; };
+
+        const auto stats = m_scene_manager->GetWorldMemoryStats();
+        m_debug_console->PushText(page, "World:", to_kb(stats.GetTotalBytes()));
+        m_debug_console->PushText(page,
+                                  "Entities:",
+                                  std::to_string(stats.entities.alive) + " alive, "
+                                  + std::to_string(stats.entities.pending) + " pending, "
+                                  + std::to_string(stats.entities.free_indices) + " free, "
+                                  + to_kb(stats.entities.table_bytes + stats.entities.name_bytes)
+                );
+        for (const auto& event_buffer : stats.event_buffers) {
+            m_debug_console->PushText(page,
+                                      event_buffer.name + ":",
+                                      std::to_string(event_buffer.high_water_mark) + " peak, "
+                                      + to_kb(event_buffer.bytes)
+                    );
+        }
+        for (const auto& [type_id, name, usage] : stats.components) {
+            m_debug_console->PushText(page,
+                                      name + ":",
+                                      std::to_string(usage.component_count) + " / "
+                                      + std::to_string(usage.component_capacity) + ", "
+                                      + to_kb(usage.dense_bytes + usage.sparse_bytes + usage.change_log_bytes)
+                    );
+        }
+    }
+
+    void EngineController::WriteWorldMemory() const {
+        const auto stats = m_scene_manager->GetWorldMemoryStats();
+        spdlog::info("World memory at shutdown: {} KB in {} component pools, {} alive entities",
+                     stats.GetTotalBytes() / 1024, stats.components.size(), stats.entities.alive);
+        if (!m_file_manager->WriteTextToFile("", "world_memory.json", stats.ToJson())) {
+            spdlog::warn("Failed to write the world memory stats.");
         }
     }
 
     void EngineController::Shutdown() const {
+        WriteSystemTimings();
+        WriteWorldMemory();
+        m_services->GetService<Renderer::IRenderController>()->StopRenderThread();
         m_window->Shutdown();
     }
 
@@ -28,8 +28,12 @@ namespace Engine::Core {
 
         /**
          * Initialize the engine backend
+         * @param systems The systems of the generated system table
+         * @param component_types The reflected component types of the generated component table, their pools are
+         * created up front in every world
          */
-        void Initialize(const std::vector<Ecs::SystemMeta>& systems);
+        void Initialize(const std::vector<Ecs::SystemMeta>& systems,
+                        const std::vector<Ecs::ComponentTypeInfo>& component_types = {});
 
         /**
          * Update the engines systems, like drawing, the objects in the world, etc.
@@ -52,10 +56,31 @@ namespace Engine::Core {
 
         void SetupInputManager(AssetHandling::AssetHandler* asset_handler);
 
-        void SetupRenderController(AssetHandling::AssetHandler* asset_handler_service) const;
+        void SetupRenderController(AssetHandling::AssetHandler* asset_handler_service, bool use_render_thread) const;
 
         [[nodiscard]] AssetHandling::AssetHandler* SetupAssetHandler() const;
 
+        /**
+         * Push the rolling timings of every phase and system to the "Systems" page of the debug console.
+         */
+        void PushSystemTimings() const;
+
+        /**
+         * Write the timings of all phases and systems as system_timings.csv and system_timings.json.
+         */
+        void WriteSystemTimings() const;
+
+        /**
+         * Push the occupancy and memory of the active world and its component pools to the "Memory" page of the
+         * debug console.
+         */
+        void PushWorldMemory() const;
+
+        /**
+         * Write the memory stats of the active world as world_memory.json and log its total.
+         */
+        void WriteWorldMemory() const;
+
         std::unique_ptr<ServiceLocator> m_services;
         std::unique_ptr<Environment::IWindow> m_window;
         std::unique_ptr<Environment::Files::IFileManager> m_file_manager;
@@ -60,11 +60,18 @@ namespace Engine::Core::Settings
     {
         RenderApi api = RenderApi::OpenGL;
         bool vsync = false;
+        bool render_thread = true;
+    };
+
+    struct DebugSettings
+    {
+        std::string console_page = "Overview";
     };
 
     struct EngineSettings
     {
         WindowSettings window;
         RenderSettings render;
+        DebugSettings debug;
     };
 }
@@ -41,6 +41,7 @@ namespace Engine::Core::Settings
         std::string toml_str;
         AddWindowSettingsToTomlStr(toml_str, settings.window);
         AddRenderSettingsToTomlStr(toml_str, settings.render);
+        AddDebugSettingsToTomlStr(toml_str, settings.debug);
         return toml_str;
     }
 
@@ -61,6 +62,15 @@ namespace Engine::Core::Settings
         toml_str += "[Renderer]\n";
         toml_str += "api = \"" + GetNameOfRenderApi(render_settings.api) + "\"\n";
         toml_str += "vsync = " + std::string(render_settings.vsync ? "true\n" : "false\n");
+        toml_str += "render_thread = " + std::string(render_settings.render_thread ? "true\n" : "false\n");
+        // Add new settings here
+        toml_str += "\n";
+    }
+
+    void SettingsHandler::AddDebugSettingsToTomlStr(std::string& toml_str, const DebugSettings& debug_settings)
+    {
+        toml_str += "[Debug]\n";
+        toml_str += "console_page = \"" + debug_settings.console_page + "\"\n";
         // Add new settings here
         toml_str += "\n";
     }
@@ -95,6 +105,11 @@ namespace Engine::Core::Settings
         EngineSettings settings{};
         settings.window = ReadWindowSettingsFromToml(toml_doc.GetRequiredTable("Window"));
         settings.render = ReadRenderSettingsFromToml(toml_doc.GetRequiredTable("Renderer"));
+        // Optional, so settings files written before the section existed keep loading
+        if (const auto debug_table = toml_doc.GetOptionalTable("Debug"))
+        {
+            settings.debug = ReadDebugSettingsFromToml(*debug_table);
+        }
         return settings;
     }
 
@@ -113,6 +128,14 @@ namespace Engine::Core::Settings
         RenderSettings settings{};
         settings.api = table.GetOptionalEnum<RenderApi>("api", RenderApiMap).value_or(settings.api);
         settings.vsync = table.GetOptionalBool("vsync").value_or(settings.vsync);
+        settings.render_thread = table.GetOptionalBool("render_thread").value_or(settings.render_thread);
+        return settings;
+    }
+
+    DebugSettings SettingsHandler::ReadDebugSettingsFromToml(Utilities::Toml::TomlTable table)
+    {
+        DebugSettings settings{};
+        settings.console_page = table.GetOptionalString("console_page").value_or(settings.console_page);
         return settings;
     }
 } // namespace
@@ -24,6 +24,7 @@ namespace Engine::Core::Settings
             static std::string CreateTomlFromSettings(const EngineSettings& settings);
             static void AddWindowSettingsToTomlStr(std::string& toml_str, const WindowSettings& window_settings);
             static void AddRenderSettingsToTomlStr(std::string& toml_str, RenderSettings render_settings);
+            static void AddDebugSettingsToTomlStr(std::string& toml_str, const DebugSettings& debug_settings);
             static std::string GetNameOfWindowMode(WindowMode window_mode);
             static std::string GetNameOfRenderApi(RenderApi api);
 
@@ -31,5 +32,6 @@ namespace Engine::Core::Settings
             static EngineSettings ReadSettingsFromToml(const std::string& toml_str);
             static WindowSettings ReadWindowSettingsFromToml(Utilities::Toml::TomlTable table);
             static RenderSettings ReadRenderSettingsFromToml(Utilities::Toml::TomlTable table);
+            static DebugSettings ReadDebugSettingsFromToml(Utilities::Toml::TomlTable table);
     };
 }
@@ -6,12 +6,31 @@
 #include <string>
 
 namespace Engine::Debug {
+    /**
+     * The page PushValue() writes to and the console shows by default.
+     */
+    inline const std::string OVERVIEW_PAGE = "Overview";
+
     class IDebugConsole {
     public:
         virtual ~IDebugConsole() = default;
 
         virtual void PushValue(const std::string& label, size_t value) = 0;
 
+        /**
+         * Set the text of a row on a page, creating the page and the row if needed.
+         * @param page The page of the row
+         * @param label The label of the row, unique per page
+         * @param text The text shown next to the label
+         */
+        virtual void PushText(const std::string& page, const std::string& label, const std::string& text) = 0;
+
+        /**
+         * Select the page to draw. Rows of the other pages are still collected, but their text meshes are only
+         * built once their page is shown.
+         */
+        virtual void ShowPage(const std::string& page) = 0;
+
         virtual void PushToFrame() = 0;
     };
 }
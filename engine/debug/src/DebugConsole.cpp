@@ -43,25 +43,49 @@ namespace Engine::Debug
 
     void DebugConsole::PushValue(const std::string& label, const size_t value)
     {
-        if (m_label_id_map.contains(label))
+        PushText(OVERVIEW_PAGE, label, std::to_string(value));
+    }
+
+    void DebugConsole::PushText(const std::string& page, const std::string& label, const std::string& text)
+    {
+        auto& debug_page = m_pages[page];
+        if (const auto it = debug_page.row_by_label.find(label); it != debug_page.row_by_label.end())
         {
-            const auto id = m_label_id_map[label];
-            UpdateTextElements(id, std::to_string(value));
+            auto& text_element = debug_page.rows[it->second];
+            if (text_element.content != text)
+            {
+                text_element.content = text;
+                text_element.content_changed = true;
+            }
             return;
         }
 
-        m_current_label_id++;
-        auto text_element = CreateTextElement(label, std::to_string(value));
-        m_label_id_map.emplace(label, m_current_label_id);
-        m_text_elements.emplace(m_current_label_id, text_element);
+        const auto row = static_cast<uint8_t>(debug_page.rows.size() + 1);
+        TextElement text_element{};
+        text_element.label = label;
+        text_element.content = text;
+        debug_page.row_by_label.emplace(label, row);
+        debug_page.rows.emplace(row, text_element);
+    }
+
+    void DebugConsole::ShowPage(const std::string& page)
+    {
+        m_shown_page = page;
     }
 
     void DebugConsole::PushToFrame()
     {
         std::vector<Renderer::DrawAsset> draw_assets;
-        for (const auto& [id, text] : m_text_elements)
+        const auto page = m_pages.find(m_shown_page);
+        if (page == m_pages.end())
         {
-            const uint8_t row = id;
+            m_render_controller->SubmitDebugInfos(draw_assets);
+            return;
+        }
+
+        for (auto& [row, text] : page->second.rows)
+        {
+            UpdateTextMeshes(text);
             auto label_asset = CreateUiDrawAsset(0, row, text.label_mesh, 2);
             auto content_asset = CreateUiDrawAsset(1, row, text.content_mesh, 1);
             draw_assets.push_back(label_asset);
@@ -71,32 +95,33 @@ namespace Engine::Debug
         m_render_controller->SubmitDebugInfos(draw_assets);
     }
 
-    void DebugConsole::UpdateTextElements(const uint8_t id, const std::string& content)
+    void DebugConsole::UpdateTextMeshes(TextElement& text_element) const
     {
-        m_text_elements[id].content = content;
-        m_text_elements[id].content_mesh = CreateTextMeshElement(content);
-    }
-
-    TextElement DebugConsole::CreateTextElement(const std::string& label,
-                                                const std::string& content) const
-    {
-        TextElement text_element{};
-        text_element.label = label;
-        text_element.content = content;
-
-        text_element.label_mesh = CreateTextMeshElement(label);
-        text_element.content_mesh = CreateTextMeshElement(content);
+        if (!text_element.has_meshes)
+        {
+            text_element.label_mesh = CreateTextMeshElement(text_element.label);
+            text_element.content_mesh = CreateTextMeshElement(text_element.content);
+            text_element.has_meshes = true;
+            text_element.content_changed = false;
+            return;
+        }
 
-        return text_element;
+        if (text_element.content_changed)
+        {
+            // Rewrite the existing mesh, so changing values do not register new assets every update
+            UpdateTextMeshElement(text_element.content_mesh, text_element.content);
+            text_element.content_changed = false;
+        }
     }
 
-    TextMeshElement DebugConsole::CreateTextMeshElement(const std::string& text) const
+    std::pair<AssetHandling::MeshAsset, Text::TextMesh> DebugConsole::BuildTextMeshAsset(
+        const std::string& text) const
     {
-        const Text::TextMesh text_mesh = m_text_controller->BuildTextMesh(
-                                                                          m_font_handle,
-                                                                          text,
-                                                                          Text::TextAlignment::Left
-                                                                         );
+        Text::TextMesh text_mesh = m_text_controller->BuildTextMesh(
+                                                                    m_font_handle,
+                                                                    text,
+                                                                    Text::TextAlignment::Left
+                                                                   );
 
         std::vector<AssetHandling::MeshVertexAsset> text_vertices;
         for (auto& vertex : text_mesh.vertices)
@@ -110,9 +135,13 @@ namespace Engine::Debug
         auto mesh_asset = AssetHandling::MeshAsset();
         mesh_asset.vertices = text_vertices;
         mesh_asset.indices = text_mesh.indices;
+        return {std::move(mesh_asset), std::move(text_mesh)};
+    }
 
+    TextMeshElement DebugConsole::CreateTextMeshElement(const std::string& text) const
+    {
+        auto [mesh_asset, text_mesh] = BuildTextMeshAsset(text);
         auto mesh_handle = m_asset_handler->RegisterAsset(mesh_asset);
-        auto asset = m_asset_handler->GetAsset<AssetHandling::MeshAsset>(mesh_handle);
 
         auto material_asset = AssetHandling::MaterialAsset();
         material_asset.render_state = AssetHandling::RenderState::UI;
@@ -132,6 +161,18 @@ namespace Engine::Debug
         return text_mesh_element;
     }
 
+    void DebugConsole::UpdateTextMeshElement(TextMeshElement& text_mesh_element, const std::string& text) const
+    {
+        auto [mesh_asset, text_mesh] = BuildTextMeshAsset(text);
+        m_asset_handler->UpdateMesh(text_mesh_element.mesh_handle,
+                                    [&mesh_asset](AssetHandling::MeshAsset& existing_mesh)
+                                    {
+                                        existing_mesh = std::move(mesh_asset);
+                                    });
+        text_mesh_element.width = text_mesh.dimensions_width;
+        text_mesh_element.height = text_mesh.dimensions_height;
+    }
+
     Renderer::DrawAsset DebugConsole::CreateUiDrawAsset(const uint8_t col, const uint8_t row,
                                                         const TextMeshElement& text_mesh_element,
                                                         const uint8_t queue_index) const
@@ -20,6 +20,14 @@ namespace Engine::Debug
         std::string content;
         TextMeshElement label_mesh;
         TextMeshElement content_mesh;
+        bool has_meshes = false;
+        bool content_changed = false;
+    };
+
+    struct DebugPage
+    {
+        std::unordered_map<std::string, uint8_t> row_by_label;
+        std::unordered_map<uint8_t, TextElement> rows;
     };
 
     class DebugConsole : public IDebugConsole
@@ -33,6 +41,10 @@ namespace Engine::Debug
 
         void PushValue(const std::string& label, size_t value) override;
 
+        void PushText(const std::string& page, const std::string& label, const std::string& text) override;
+
+        void ShowPage(const std::string& page) override;
+
         void PushToFrame() override;
 
     private:
@@ -48,17 +60,18 @@ namespace Engine::Debug
         Text::FontHandle m_font_handle;
         Assets::TextureHandle m_texture_handle;
 
-        uint8_t m_current_label_id = 0;
-        std::unordered_map<std::string, uint8_t> m_label_id_map;
-        std::unordered_map<uint8_t, TextElement> m_text_elements;
-
-        void UpdateTextElements(uint8_t id, const std::string& content);
+        std::unordered_map<std::string, DebugPage> m_pages;
+        std::string m_shown_page = OVERVIEW_PAGE;
 
-        [[nodiscard]] TextElement CreateTextElement(const std::string& label,
-                                                    const std::string& content) const;
+        void UpdateTextMeshes(TextElement& text_element) const;
 
         [[nodiscard]] TextMeshElement CreateTextMeshElement(const std::string& text) const;
 
+        void UpdateTextMeshElement(TextMeshElement& text_mesh_element, const std::string& text) const;
+
+        [[nodiscard]] std::pair<AssetHandling::MeshAsset, Text::TextMesh> BuildTextMeshAsset(
+            const std::string& text) const;
+
         Renderer::DrawAsset CreateUiDrawAsset(uint8_t col, uint8_t row, const TextMeshElement& text_mesh_element, uint8_t queue_index) const;
     };
 } // namespace
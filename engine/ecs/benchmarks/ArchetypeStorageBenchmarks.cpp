@@ -0,0 +1,101 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <string>
+#include <vector>
+
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    // Mirrors the component set of a maze tile (Transform, MeshRenderer, BoxCollider)
+    struct TileTransform {
+        float position[3];
+        float rotation[3];
+        float scale[3];
+        uint64_t version;
+    };
+
+    struct TileMeshRenderer {
+        uint64_t mesh;
+        uint64_t material;
+    };
+
+    struct TileCollider {
+        float width;
+        float height;
+        float depth;
+        bool is_static;
+        bool is_trigger;
+    };
+
+    void FillTiles(World& world, const std::size_t entity_count) {
+        std::vector<EntityId> entities(entity_count);
+        world.CreateEntities(entity_count, entities);
+        std::vector<TileTransform> transforms;
+        std::vector<TileMeshRenderer> mesh_renderers;
+        transforms.reserve(entity_count);
+        mesh_renderers.reserve(entity_count);
+        for (std::size_t i = 0; i < entity_count; ++i) {
+            const auto f = static_cast<float>(i);
+            transforms.push_back(TileTransform{{f, 0.0f, f}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 0});
+            mesh_renderers.push_back(TileMeshRenderer{i, i});
+        }
+        const std::vector colliders(entity_count, TileCollider{1.0f, 2.0f, 1.0f, true, false});
+        world.AddComponents<TileTransform>(entities, transforms);
+        world.AddComponents<TileMeshRenderer>(entities, mesh_renderers);
+        world.AddComponents<TileCollider>(entities, colliders);
+        world.ApplyEngineEvents();
+    }
+
+    float SumTiles(World& world) {
+        float sum = 0.0f;
+        for (auto [entity, transform, mesh_renderer, collider]: world.View<
+                 TileTransform, const TileMeshRenderer, const TileCollider>()) {
+            transform.position[1] += collider.height;
+            sum += transform.position[1] + static_cast<float>(mesh_renderer.mesh);
+        }
+        return sum;
+    }
+
+    float SumPositions(World& world) {
+        float sum = 0.0f;
+        for (const auto [entity, transform]: world.View<const TileTransform>()) {
+            sum += transform.position[0];
+        }
+        return sum;
+    }
+}
+
+TEST_CASE("ArchetypeStorage - Iteration throughput against sparse set pools", "[benchmark][ecs]") {
+    const std::size_t entity_count = GENERATE(100'000, 500'000);
+
+    World sparse_set_world(ComponentStorage::SparseSet);
+    World archetype_world(ComponentStorage::Archetype);
+    FillTiles(sparse_set_world, entity_count);
+    FillTiles(archetype_world, entity_count);
+
+    const auto suffix = " (" + std::to_string(entity_count) + " entities)";
+
+    BENCHMARK("Sparse set View<Transform, MeshRenderer, Collider>" + suffix) {
+        return SumTiles(sparse_set_world);
+    };
+
+    BENCHMARK("Archetype View<Transform, MeshRenderer, Collider>" + suffix) {
+        return SumTiles(archetype_world);
+    };
+
+    BENCHMARK("Sparse set View<Transform>" + suffix) {
+        return SumPositions(sparse_set_world);
+    };
+
+    BENCHMARK("Archetype View<Transform>" + suffix) {
+        return SumPositions(archetype_world);
+    };
+}
@@ -0,0 +1,69 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/ComponentPool.hpp"
+#include "JobSystem.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    // Same layout as the transform component, the benchmark rebuilds a matrix-like value per component.
+    struct BenchTransform {
+        float position[3];
+        float rotation[3];
+        float scale[3];
+        uint64_t version;
+        float matrix[16];
+    };
+
+    void RebuildMatrix(BenchTransform& transform) {
+        const float sin_z = std::sin(transform.rotation[2]);
+        const float cos_z = std::cos(transform.rotation[2]);
+        for (int i = 0; i < 16; ++i) {
+            transform.matrix[i] = transform.position[i % 3] * cos_z + transform.scale[i % 3] * sin_z;
+        }
+        transform.version++;
+    }
+}
+
+TEST_CASE("ComponentPool - ParallelForEach scaling over thread counts", "[benchmark][ecs]") {
+    const std::size_t component_count = GENERATE(10'000, 100'000, 1'000'000);
+    ComponentPool<BenchTransform> pool(0);
+    for (std::size_t i = 0; i < component_count; ++i) {
+        const auto value = static_cast<float>(i);
+        pool.Add(i + 1, BenchTransform{{value, value, value}, {0.0f, 0.0f, value}, {1.0f, 1.0f, 1.0f}, 0, {}});
+    }
+
+    BENCHMARK("ForEach - " + std::to_string(component_count) + " components") {
+        pool.ForEach([](EntityId, BenchTransform& transform) { RebuildMatrix(transform); });
+        return pool.Count();
+    };
+
+    // Doubles the thread count from 1 up to the number of hardware threads, which is always measured as well.
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> thread_counts;
+    for (std::size_t thread_count = 1; thread_count < max_threads; thread_count *= 2) {
+        thread_counts.push_back(thread_count);
+    }
+    thread_counts.push_back(max_threads);
+
+    for (const auto thread_count: thread_counts) {
+        Engine::Jobs::JobSystem job_system(thread_count - 1);
+        BENCHMARK("ParallelForEach - " + std::to_string(component_count) + " components, " +
+                  std::to_string(thread_count) + " threads") {
+            pool.ParallelForEach(job_system, [](EntityId, BenchTransform& transform) { RebuildMatrix(transform); });
+            return pool.Count();
+        };
+    }
+}
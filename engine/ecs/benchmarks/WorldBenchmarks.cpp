@@ -0,0 +1,284 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    // Every random sequence of this file is drawn from this seed, so runs are comparable against a baseline.
+    constexpr std::mt19937::result_type BENCHMARK_SEED = 0x4D415A45;
+
+    struct BenchPosition {
+        float x;
+        float y;
+        float z;
+    };
+
+    struct BenchVelocity {
+        float x;
+        float y;
+        float z;
+    };
+
+    struct BenchHealth {
+        int32_t value;
+    };
+
+    std::string Suffix(const std::size_t entity_count) {
+        return " (" + std::to_string(entity_count) + " entities)";
+    }
+
+    std::vector<EntityId> CreateEntities(World& world, const std::size_t entity_count) {
+        std::vector<EntityId> entities(entity_count);
+        world.CreateEntities(entity_count, entities);
+        world.ApplyEngineEvents();
+        return entities;
+    }
+
+    std::vector<EntityId> PopulateWorld(World& world, const std::size_t entity_count) {
+        auto entities = CreateEntities(world, entity_count);
+        std::vector<BenchPosition> positions(entity_count);
+        for (std::size_t i = 0; i < entity_count; ++i) {
+            const auto f = static_cast<float>(i);
+            positions[i] = BenchPosition{f, 0.0f, f};
+        }
+        world.AddComponents<BenchPosition>(entities, positions);
+        world.AddComponents<BenchVelocity>(
+                entities, std::vector<BenchVelocity>(entity_count, BenchVelocity{1.0f, 0.0f, 1.0f}));
+        world.AddComponents<BenchHealth>(entities, std::vector<BenchHealth>(entity_count, BenchHealth{100}));
+        world.ApplyEngineEvents();
+        return entities;
+    }
+
+    /**
+     * Worlds for benchmarks that consume their input. Catch asks for the number of runs per sample, and every
+     * run gets a world of its own that is prepared outside of the measurement.
+     */
+    template<typename Prepare>
+    std::vector<std::unique_ptr<World> > PrepareWorlds(const int count, Prepare prepare) {
+        std::vector<std::unique_ptr<World> > worlds;
+        worlds.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            worlds.push_back(std::make_unique<World>());
+            prepare(*worlds.back());
+        }
+        return worlds;
+    }
+}
+
+TEST_CASE("World - Create and destroy entities", "[benchmark][ecs]") {
+    const std::size_t entity_count = GENERATE(1'000, 10'000, 100'000, 1'000'000);
+    const auto suffix = Suffix(entity_count);
+
+    BENCHMARK_ADVANCED("CreateEntity one by one" + suffix)(Catch::Benchmark::Chronometer meter) {
+        auto worlds = PrepareWorlds(meter.runs(), [](World&) {});
+        meter.measure([&](const int run) {
+            auto& world = *worlds[run];
+            for (std::size_t i = 0; i < entity_count; ++i) {
+                (void) world.CreateEntity();
+            }
+            world.ApplyEngineEvents();
+        });
+    };
+
+    BENCHMARK_ADVANCED("CreateEntities in bulk" + suffix)(Catch::Benchmark::Chronometer meter) {
+        auto worlds = PrepareWorlds(meter.runs(), [](World&) {});
+        std::vector<EntityId> entities(entity_count);
+        meter.measure([&](const int run) {
+            auto& world = *worlds[run];
+            world.CreateEntities(entity_count, entities);
+            world.ApplyEngineEvents();
+        });
+    };
+
+    BENCHMARK_ADVANCED("DestroyEntity in random order" + suffix)(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<EntityId> > entities(meter.runs());
+        std::mt19937 random(BENCHMARK_SEED);
+        int prepared = 0;
+        auto worlds = PrepareWorlds(meter.runs(), [&](World& world) {
+            auto& created = entities[prepared++];
+            created = PopulateWorld(world, entity_count);
+            std::ranges::shuffle(created, random);
+        });
+        meter.measure([&](const int run) {
+            auto& world = *worlds[run];
+            for (const auto entity: entities[run]) {
+                world.DestroyEntity(entity);
+            }
+            world.ApplyEngineEvents();
+        });
+    };
+}
+
+TEST_CASE("World - AddComponent through ApplyEngineEvents", "[benchmark][ecs]") {
+    const std::size_t entity_count = GENERATE(1'000, 10'000, 100'000, 1'000'000);
+    const auto suffix = Suffix(entity_count);
+
+    BENCHMARK_ADVANCED("AddComponent one by one" + suffix)(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<EntityId> > entities(meter.runs());
+        int prepared = 0;
+        auto worlds = PrepareWorlds(meter.runs(), [&](World& world) {
+            entities[prepared++] = CreateEntities(world, entity_count);
+        });
+        meter.measure([&](const int run) {
+            auto& world = *worlds[run];
+            for (const auto entity: entities[run]) {
+                world.AddComponent(entity, BenchPosition{1.0f, 2.0f, 3.0f});
+            }
+            world.ApplyEngineEvents();
+        });
+    };
+
+    BENCHMARK_ADVANCED("AddComponents in bulk" + suffix)(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<EntityId> > entities(meter.runs());
+        int prepared = 0;
+        auto worlds = PrepareWorlds(meter.runs(), [&](World& world) {
+            entities[prepared++] = CreateEntities(world, entity_count);
+        });
+        const std::vector positions(entity_count, BenchPosition{1.0f, 2.0f, 3.0f});
+        meter.measure([&](const int run) {
+            auto& world = *worlds[run];
+            world.AddComponents<BenchPosition>(entities[run], positions);
+            world.ApplyEngineEvents();
+        });
+    };
+}
+
+TEST_CASE("World - Iterating and accessing components", "[benchmark][ecs]") {
+    const std::size_t entity_count = GENERATE(1'000, 10'000, 100'000, 1'000'000);
+    const auto suffix = Suffix(entity_count);
+
+    World world;
+    auto entities = PopulateWorld(world, entity_count);
+
+    BENCHMARK("GetComponentsOfType" + suffix) {
+        float sum = 0.0f;
+        for (const auto& [position, entity]: world.GetComponentsOfType<BenchPosition>()) {
+            sum += position->x;
+        }
+        return sum;
+    };
+
+    BENCHMARK("GetComponentView" + suffix) {
+        float sum = 0.0f;
+        for (const auto [position, entity]: world.GetComponentView<BenchPosition>()) {
+            sum += position->x;
+        }
+        return sum;
+    };
+
+    BENCHMARK("View of two components" + suffix) {
+        float sum = 0.0f;
+        for (auto [entity, position, velocity]: world.View<const BenchPosition, const BenchVelocity>()) {
+            sum += position.x * velocity.x;
+        }
+        return sum;
+    };
+
+    std::ranges::shuffle(entities, std::mt19937(BENCHMARK_SEED));
+
+    BENCHMARK("GetComponent in random order" + suffix) {
+        float sum = 0.0f;
+        for (const auto entity: entities) {
+            sum += world.GetComponent<BenchPosition>(entity)->x;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("ComponentEventBus - Dispatching add and remove events", "[benchmark][ecs]") {
+    const std::size_t entity_count = GENERATE(1'000, 10'000, 100'000, 1'000'000);
+    const auto suffix = Suffix(entity_count);
+
+    ComponentEventBus event_bus;
+    float added = 0.0f;
+    std::size_t removed = 0;
+    event_bus.SubscribeOnComponentAddEvent<BenchPosition>([&added](EntityId, const BenchPosition& position) {
+        added += position.x;
+    });
+    event_bus.SubscribeOnComponentRemoveEvent<BenchPosition>([&removed](EntityId) { ++removed; });
+
+    const BenchPosition position{1.0f, 2.0f, 3.0f};
+    BENCHMARK("RaiseAddComponentEvent" + suffix) {
+        for (std::size_t i = 0; i < entity_count; ++i) {
+            event_bus.RaiseAddComponentEvent(i + 1, position);
+        }
+        return added;
+    };
+
+    BENCHMARK("RaiseRemoveComponentEvent" + suffix) {
+        for (std::size_t i = 0; i < entity_count; ++i) {
+            event_bus.RaiseRemoveComponentEvent<BenchPosition>(i + 1);
+        }
+        return removed;
+    };
+
+    BENCHMARK("RaiseAddComponentEvent without subscriber" + suffix) {
+        for (std::size_t i = 0; i < entity_count; ++i) {
+            event_bus.RaiseAddComponentEvent(i + 1, BenchHealth{1});
+        }
+        return added;
+    };
+}
+
+TEST_CASE("World - ClearEntities", "[benchmark][ecs]") {
+    const std::size_t entity_count = GENERATE(1'000, 10'000, 100'000, 1'000'000);
+
+    BENCHMARK_ADVANCED("ClearEntities" + Suffix(entity_count))(Catch::Benchmark::Chronometer meter) {
+        auto worlds = PrepareWorlds(meter.runs(), [entity_count](World& world) {
+            PopulateWorld(world, entity_count);
+        });
+        meter.measure([&](const int run) { worlds[run]->ClearEntities(); });
+    };
+}
+
+TEST_CASE("World - Instantiating a prefab against adding components", "[benchmark][ecs]") {
+    const std::size_t entity_count = GENERATE(1'000, 10'000, 100'000, 1'000'000);
+    const auto suffix = Suffix(entity_count);
+
+    std::vector<BenchPosition> positions(entity_count);
+    for (std::size_t i = 0; i < entity_count; ++i) {
+        positions[i] = BenchPosition{static_cast<float>(i), 0.0f, 0.0f};
+    }
+
+    BENCHMARK_ADVANCED("CreateEntities and AddComponents" + suffix)(Catch::Benchmark::Chronometer meter) {
+        auto worlds = PrepareWorlds(meter.runs(), [](World&) {});
+        std::vector<EntityId> entities(entity_count);
+        const std::vector velocities(entity_count, BenchVelocity{1.0f, 0.0f, 1.0f});
+        const std::vector healths(entity_count, BenchHealth{100});
+        meter.measure([&](const int run) {
+            auto& world = *worlds[run];
+            world.CreateEntities(entity_count, entities);
+            world.AddComponents<BenchPosition>(entities, positions);
+            world.AddComponents<BenchVelocity>(entities, velocities);
+            world.AddComponents<BenchHealth>(entities, healths);
+            world.ApplyEngineEvents();
+        });
+    };
+
+    BENCHMARK_ADVANCED("Instantiate prefab" + suffix)(Catch::Benchmark::Chronometer meter) {
+        auto worlds = PrepareWorlds(meter.runs(), [](World&) {});
+        std::vector<EntityId> entities(entity_count);
+        Prefab prefab;
+        prefab.With(BenchPosition{}).With(BenchVelocity{1.0f, 0.0f, 1.0f}).With(BenchHealth{100});
+        PrefabOverrides overrides;
+        overrides.Set<BenchPosition>(positions);
+        meter.measure([&](const int run) {
+            auto& world = *worlds[run];
+            world.Instantiate(prefab, entity_count, entities, overrides);
+            world.ApplyEngineEvents();
+        });
+    };
+}
@@ -0,0 +1,79 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <string>
+#include <vector>
+
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    // Mirrors the component set of a maze tile (Transform, MeshRenderer, BoxCollider)
+    struct TileTransform {
+        float position[3];
+        float rotation[3];
+        float scale[3];
+        uint64_t version;
+    };
+
+    struct TileMeshRenderer {
+        uint64_t mesh;
+        uint64_t material;
+    };
+
+    struct TileCollider {
+        float width;
+        float height;
+        float depth;
+        bool is_static;
+        bool is_trigger;
+    };
+
+    void BuildTiles(World& world, const std::size_t tile_count) {
+        std::vector<EntityId> tiles(tile_count);
+        world.CreateEntities(tile_count, tiles);
+        std::vector<TileTransform> transforms(tile_count);
+        for (std::size_t i = 0; i < tile_count; ++i) {
+            const auto f = static_cast<float>(i);
+            transforms[i] = TileTransform{{f, 0.0f, f}, {0.0f, 90.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1};
+        }
+        world.AddComponents<TileTransform>(tiles, transforms);
+        world.AddComponents<TileMeshRenderer>(
+                tiles, std::vector<TileMeshRenderer>(tile_count, TileMeshRenderer{1, 2}));
+        world.AddComponents<TileCollider>(
+                tiles, std::vector<TileCollider>(tile_count, TileCollider{2.0f, 2.0f, 0.1f, true, false}));
+        world.ApplyEngineEvents();
+    }
+}
+
+TEST_CASE("World - Restoring a snapshot against rebuilding the level", "[benchmark][ecs]") {
+    // A 50x50 maze creates about five tile entities per cell.
+    const std::size_t tile_count = GENERATE(50 * 50 * 5, 100 * 100 * 5);
+
+    World world;
+    BuildTiles(world, tile_count);
+    const auto snapshot = world.Snapshot();
+
+    const auto suffix = " (" + std::to_string(tile_count) + " tiles)";
+
+    BENCHMARK("Rebuild with ClearEntities and bulk creation" + suffix) {
+        world.ClearEntities();
+        BuildTiles(world, tile_count);
+        return world.GetComponentView<TileTransform>().Size();
+    };
+
+    BENCHMARK("Restore snapshot" + suffix) {
+        world.Restore(snapshot);
+        return world.GetComponentView<TileTransform>().Size();
+    };
+
+    BENCHMARK("Take snapshot" + suffix) {
+        return world.Snapshot().Size();
+    };
+}
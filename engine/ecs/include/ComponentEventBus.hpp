@@ -4,6 +4,7 @@
 
 #pragma once
 #include <functional>
+#include <span>
 #include <typeindex>
 #include <unordered_map>
 
@@ -14,11 +15,13 @@ namespace Engine::Ecs {
     private:
         using ErasedAddFn = std::function<void(EntityId, const void *)>;
         using ErasedRemoveFn = std::function<void(EntityId)>;
+        using BatchAddFn = std::function<void(std::span<const EntityId>)>;
 
     public:
         ComponentEventBus() {
             m_on_component_add_events = std::unordered_map<std::type_index, std::vector<ErasedAddFn> >();
             m_on_component_remove_events = std::unordered_map<std::type_index, std::vector<ErasedRemoveFn> >();
+            m_on_components_add_events = std::unordered_map<std::type_index, std::vector<BatchAddFn> >();
         }
 
         ~ComponentEventBus() = default;
@@ -30,6 +33,16 @@ namespace Engine::Ecs {
             vec.emplace_back(Wrap<T>(std::move(fn)));
         }
 
+        /**
+         * Subscribe to components added in bulk, e.g. by AddComponents or prefab instantiation. The function is
+         * called once per batch with all entities, single additions arrive as a batch of one.
+         * Per entity subscribers are still called for every entity of a batch.
+         */
+        template<typename T>
+        void SubscribeOnComponentsAddEvent(BatchAddFn fn) {
+            m_on_components_add_events[std::type_index(typeid(T))].emplace_back(std::move(fn));
+        }
+
         template<typename T>
         void SubscribeOnComponentRemoveEvent(std::function<void(EntityId)> fn) {
             const auto type_index = std::type_index(typeid(T));
@@ -37,8 +50,17 @@ namespace Engine::Ecs {
             vec.emplace_back(std::move(fn));
         }
 
+        /**
+         * Subscribe to World::Reset(). It is raised once for the whole world instead of a remove event per
+         * component, so caches drop all their entries at once.
+         */
+        void SubscribeOnWorldResetEvent(std::function<void()> fn) {
+            m_on_world_reset_events.emplace_back(std::move(fn));
+        }
+
         template<typename T>
         void RaiseAddComponentEvent(const EntityId entity, const T &value) const {
+            RaiseBatchAddEvent<T>(std::span(&entity, 1));
             const auto it = m_on_component_add_events.find(std::type_index(typeid(T)));
             if (it == m_on_component_add_events.end()) {
                 return;
@@ -50,6 +72,32 @@ namespace Engine::Ecs {
             }
         }
 
+        /**
+         * Raise the add events of a batch of entities. Batch subscribers are called once, per entity subscribers
+         * once per entity.
+         * @param entities The entities that got a component of type T
+         * @param get_component Returns the added component of an entity
+         */
+        template<typename T, typename GetComponent>
+        void RaiseAddComponentsEvent(const std::span<const EntityId> entities, GetComponent &&get_component) const {
+            if (entities.empty()) {
+                return;
+            }
+            RaiseBatchAddEvent<T>(entities);
+            const auto it = m_on_component_add_events.find(std::type_index(typeid(T)));
+            if (it == m_on_component_add_events.end()) {
+                return;
+            }
+            for (const auto entity: entities) {
+                const T &value = get_component(entity);
+                for (auto &func: it->second) {
+                    if (func) {
+                        func(entity, &value);
+                    }
+                }
+            }
+        }
+
         template<typename T>
         void RaiseRemoveComponentEvent(const EntityId entity) const {
             const auto it = m_on_component_remove_events.find(std::type_index(typeid(T)));
@@ -63,9 +111,42 @@ namespace Engine::Ecs {
             }
         }
 
+        void RaiseWorldResetEvent() const {
+            for (auto &func: m_on_world_reset_events) {
+                if (func) {
+                    func();
+                }
+            }
+        }
+
+        /**
+         * Drop all subscriptions, e.g. before the systems of the next scene subscribe to a reused world.
+         */
+        void Clear() {
+            m_on_component_add_events.clear();
+            m_on_component_remove_events.clear();
+            m_on_components_add_events.clear();
+            m_on_world_reset_events.clear();
+        }
+
     private:
         std::unordered_map<std::type_index, std::vector<ErasedAddFn> > m_on_component_add_events;
         std::unordered_map<std::type_index, std::vector<ErasedRemoveFn> > m_on_component_remove_events;
+        std::unordered_map<std::type_index, std::vector<BatchAddFn> > m_on_components_add_events;
+        std::vector<std::function<void()> > m_on_world_reset_events;
+
+        template<typename T>
+        void RaiseBatchAddEvent(const std::span<const EntityId> entities) const {
+            const auto it = m_on_components_add_events.find(std::type_index(typeid(T)));
+            if (it == m_on_components_add_events.end()) {
+                return;
+            }
+            for (auto &func: it->second) {
+                if (func) {
+                    func(entities);
+                }
+            }
+        }
 
         template<typename T>
         static ErasedAddFn Wrap(std::function<void(EntityId, const T &)> fn) {
@@ -0,0 +1,82 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "Ecs/NameId.hpp"
+
+namespace Engine::Ecs {
+    class ComponentManager;
+
+    /**
+     * Layout of a single data member of a component.
+     */
+    struct ComponentField {
+        std::string_view name;
+        /**
+         * The type as it is spelled in the component declaration.
+         */
+        std::string_view type_name;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    /**
+     * Compile time description of a component type, specialized by the component code generator for every struct in
+     * engine/components and gameplay/components. A specialization provides
+     * static constexpr std::string_view name, static constexpr uint64_t stable_id and static constexpr fields, an
+     * array of ComponentField. The stable id is HashName() of the qualified name, so unlike the type ids it does not
+     * depend on the order the types are used in and stays the same across builds and compilers. Components with
+     * private members befriend their specialization.
+     */
+    template<class T>
+    struct ComponentReflection {
+    };
+
+    template<class T>
+    concept ReflectedComponent = requires {
+        { ComponentReflection<T>::name } -> std::convertible_to<std::string_view>;
+        { ComponentReflection<T>::stable_id } -> std::convertible_to<uint64_t>;
+        std::span<const ComponentField>(ComponentReflection<T>::fields);
+    };
+
+    /**
+     * Call fn(const ComponentField&, const void* field) for every reflected member of a component.
+     */
+    template<ReflectedComponent T, class Fn>
+    void ForEachField(const T& component, Fn&& fn) {
+        const auto* bytes = reinterpret_cast<const std::byte*>(&component);
+        for (const auto& field: ComponentReflection<T>::fields) {
+            fn(field, static_cast<const void*>(bytes + field.offset));
+        }
+    }
+
+    /**
+     * Type erased description of a reflected component type, as listed by the generated component table.
+     */
+    struct ComponentTypeInfo {
+        std::string_view name;
+        uint64_t stable_id;
+        std::size_t size;
+        std::size_t alignment;
+        std::span<const ComponentField> fields;
+
+        std::size_t (*register_type)(ComponentManager&);
+
+        template<ReflectedComponent T>
+        static constexpr ComponentTypeInfo Of() {
+            return ComponentTypeInfo{
+                ComponentReflection<T>::name,
+                ComponentReflection<T>::stable_id,
+                sizeof(T),
+                alignof(T),
+                ComponentReflection<T>::fields,
+                // Generic, so the manager only needs to be complete where a table is instantiated
+                [](auto& component_manager) { return component_manager.template RegisterType<T>(); }
+            };
+        }
+    };
+} // namespace
@@ -0,0 +1,27 @@
+#pragma once
+#include <concepts>
+#include <type_traits>
+
+#include "SnapshotStream.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * Customization point to store components with owning members, like strings, in a world snapshot.
+     * Specialize it next to the component with
+     * static void Write(SnapshotWriter&, const T&) and static T Read(SnapshotReader&).
+     * Trivially copyable components need no specialization, their dense arrays are copied as a whole.
+     */
+    template<class T>
+    struct ComponentSerializer {
+    };
+
+    template<class T>
+    concept CustomSerializedComponent = requires(SnapshotWriter& writer, SnapshotReader& reader, const T& component) {
+        ComponentSerializer<T>::Write(writer, component);
+        { ComponentSerializer<T>::Read(reader) } -> std::same_as<T>;
+    };
+
+    template<class T>
+    concept SerializableComponent = CustomSerializedComponent<T> ||
+                                    (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>);
+} // namespace
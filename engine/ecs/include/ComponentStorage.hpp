@@ -0,0 +1,20 @@
+#pragma once
+
+namespace Engine::Ecs {
+    /**
+     * Layout the components of a world are stored in, chosen when the world is created.
+     */
+    enum class ComponentStorage {
+        /**
+         * One sparse set per component type. Supports every feature of the world.
+         */
+        SparseSet,
+        /**
+         * Entities are grouped by their exact component signature into archetypes of 16 KiB SoA chunks, see
+         * ArchetypeStorage. Views over entities sharing the same components walk packed arrays side by side, while
+         * adding or removing a component moves the entity into another archetype. Component views, change tracking,
+         * persistent queries and snapshots need the per-type pools and throw std::logic_error.
+         */
+        Archetype,
+    };
+} // namespace
@@ -5,6 +5,7 @@
 #pragma once
 #include <Input/IInput.hpp>
 #include "IServiceToEcsProvider.hpp"
+#include "JobSystem.hpp"
 #include "World.hpp"
 
 #include "../../systems/src/CacheManager.hpp"
@@ -22,10 +23,16 @@ namespace Engine::Ecs {
         IServiceToEcsProvider* m_service_locator{};
         World* m_world{};
         Systems::CacheManager* m_cache_manager{};
+        Jobs::JobSystem* m_job_system{};
 
     protected:
         [[nodiscard]] IServiceToEcsProvider* ServiceLocator() const { return m_service_locator; }
         [[nodiscard]] World* EcsWorld() const { return m_world; }
         [[nodiscard]] Systems::CacheManager* Cache() const { return m_cache_manager; }
+
+        /**
+         * @return The job system the system manager runs on, used to split the work of a system into parallel chunks
+         */
+        [[nodiscard]] Jobs::JobSystem* Workers() const { return m_job_system; }
     };
 }
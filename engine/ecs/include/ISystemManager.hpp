@@ -1,8 +1,9 @@
 #pragma once
-#include <any>
-#include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
+#include "SystemDispatch.hpp"
 #include "World.hpp"
 #include "Ecs/ISystem.hpp"
 #include "Input/IInput.hpp"
@@ -21,15 +22,52 @@ namespace Engine::Ecs
         Render = 7,
     };
 
+    inline constexpr std::size_t PHASE_COUNT = 8;
+
+    inline std::string_view GetPhaseName(const Phase phase)
+    {
+        switch (phase)
+        {
+            case Phase::Input: return "Input";
+            case Phase::Physics: return "Physics";
+            case Phase::Ui: return "Ui";
+            case Phase::Update: return "Update";
+            case Phase::EngineEvents: return "EngineEvents";
+            case Phase::LateUpdate: return "LateUpdate";
+            case Phase::Commands: return "Commands";
+            case Phase::Render: return "Render";
+        }
+        return "Unknown";
+    }
+
     using SystemFactory = std::unique_ptr<ISystem>(*)();
 
+    /**
+     * The component types a system reads and writes during Run(), compared by their unqualified type name.
+     */
+    struct SystemAccess
+    {
+        std::vector<std::string> reads;
+        std::vector<std::string> writes;
+    };
+
     struct SystemMeta
     {
         std::string name;
         Phase phase;
         std::vector<std::string> tags;
         std::vector<std::string> dependencies;
+        /**
+         * Declared component access. Systems without a declaration are treated as conflicting with every other
+         * system and always run alone on the main thread.
+         */
+        std::optional<SystemAccess> access;
         SystemFactory factory;
+        /**
+         * Direct calls into the concrete system type, emitted by the code generator. If run is null, the system is
+         * run through the virtual interface and subscribed to every physics event.
+         */
+        SystemDispatch dispatch{};
     };
 
     class ISystemManager
@@ -43,10 +81,5 @@ namespace Engine::Ecs
             virtual void FixedUpdateSystems(float fixed_dt) = 0;
 
             virtual void UpdateSystems(float delta_time) = 0;
-
-            virtual void RegisterForSystemCommands(std::string subscriber_name,
-                                                   std::function<void(std::vector<std::any>)> command_callback) =0;
-
-            virtual void DeregisterForSystemCommands(const std::string& subscriber_name) = 0;
     };
 }
@@ -0,0 +1,29 @@
+#pragma once
+#include "Ecs/NameId.hpp"
+#include "../src/Entity.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * @class NamedEntity
+     * @brief Cached handle to an entity that is found by its name.
+     *
+     * Systems keep the handle as member and resolve it through the world every frame. Resolving only checks the
+     * generation of the cached entity and falls back to the name lookup if the entity was destroyed or did not exist
+     * yet, so the handle can be created in Initialize() before the scene spawned the entity.
+     */
+    class NamedEntity {
+        friend class World;
+
+    public:
+        constexpr NamedEntity() = default;
+
+        constexpr explicit NamedEntity(const NameId name) : m_name(name) {
+        }
+
+        [[nodiscard]] constexpr NameId GetName() const { return m_name; }
+
+    private:
+        NameId m_name = INVALID_NAME_ID;
+        EntityId m_entity = INVALID_ENTITY_ID;
+    };
+} // namespace
@@ -62,6 +62,13 @@ namespace Engine::Ecs {
             }
         };
 
+        void Clear() {
+            m_on_collision_enter_funcs.clear();
+            m_on_collision_exit_funcs.clear();
+            m_on_trigger_enter_funcs.clear();
+            m_on_trigger_exit_funcs.clear();
+        }
+
     private:
         std::vector<CollisionEventFunc> m_on_collision_enter_funcs;
         std::vector<CollisionEventFunc> m_on_collision_exit_funcs;
@@ -0,0 +1,123 @@
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <typeindex>
+#include <vector>
+
+#include "../src/ComponentManager.hpp"
+#include "../src/buffer/CommandArena.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * Type erased operations on a component type, shared by prefabs and their overrides.
+     */
+    struct PrefabComponentType {
+        std::type_index type;
+
+        ComponentTypeId (*register_type)(ComponentManager &);
+
+        /**
+         * Copy count contiguous components into the arena.
+         */
+        void *(*copy_to_arena)(Buffer::CommandArena &, const void *values, std::size_t count);
+
+        template<typename T>
+        static const PrefabComponentType &Of() {
+            static const PrefabComponentType component_type{
+                std::type_index(typeid(T)),
+                [](ComponentManager &cm) { return cm.RegisterType<T>(); },
+                [](Buffer::CommandArena &arena, const void *values, const std::size_t count) -> void * {
+                    return arena.CreateRange<T>(std::span(static_cast<const T *>(values), count));
+                }
+            };
+            return component_type;
+        }
+    };
+
+    /**
+     * @class Prefab
+     * @brief A set of components with default values, spawned many times with World::Instantiate().
+     *
+     * Instantiating a prefab creates all entities in one batch and writes each component type into its pool in one
+     * pass, instead of a deferred event per entity and component.
+     */
+    class Prefab {
+    public:
+        /**
+         * Add a component to the prefab, replacing the default of the same type if there is one.
+         * @tparam T The component type
+         * @param component The value every instance starts with
+         * @return This prefab, to chain the calls
+         */
+        template<typename T>
+        Prefab &With(T component) {
+            const auto &component_type = PrefabComponentType::Of<T>();
+            auto value = std::make_shared<const T>(std::move(component));
+            const auto it = std::ranges::find(m_components, &component_type, &Component::type);
+            if (it != m_components.end()) {
+                it->value = std::move(value);
+            } else {
+                m_components.push_back(Component{&component_type, std::move(value)});
+            }
+            return *this;
+        }
+
+        template<typename T>
+        [[nodiscard]] bool Has() const {
+            return std::ranges::find(m_components, &PrefabComponentType::Of<T>(), &Component::type) !=
+                   m_components.end();
+        }
+
+        [[nodiscard]] std::size_t GetComponentCount() const { return m_components.size(); }
+
+    private:
+        friend class World;
+
+        struct Component {
+            const PrefabComponentType *type;
+            std::shared_ptr<const void> value;
+        };
+
+        std::vector<Component> m_components;
+    };
+
+    /**
+     * @class PrefabOverrides
+     * @brief Per instance values for some component types of a World::Instantiate() call.
+     *
+     * The values are only referenced and copied when the instantiation is queued, so they have to live until then.
+     */
+    class PrefabOverrides {
+    public:
+        /**
+         * Give every instance its own component of type T, replacing the default of the prefab. Types the prefab does
+         * not contain are added to the instances.
+         * @tparam T The component type
+         * @param values One component per instance
+         * @return These overrides, to chain the calls
+         */
+        template<typename T>
+        PrefabOverrides &Set(std::span<const T> values) {
+            const auto &component_type = PrefabComponentType::Of<T>();
+            const auto it = std::ranges::find(m_overrides, &component_type, &Override::type);
+            if (it != m_overrides.end()) {
+                *it = Override{&component_type, values.data(), values.size()};
+            } else {
+                m_overrides.push_back(Override{&component_type, values.data(), values.size()});
+            }
+            return *this;
+        }
+
+    private:
+        friend class World;
+
+        struct Override {
+            const PrefabComponentType *type;
+            const void *values;
+            std::size_t count;
+        };
+
+        std::vector<Override> m_overrides;
+    };
+} // namespace
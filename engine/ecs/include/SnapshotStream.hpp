@@ -0,0 +1,121 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Engine::Ecs {
+    /**
+     * @class SnapshotWriter
+     * @brief Appends plain values and arrays to the contiguous byte buffer of a world snapshot.
+     */
+    class SnapshotWriter {
+    public:
+        explicit SnapshotWriter(std::vector<std::byte>& buffer) : m_buffer(buffer) {
+        }
+
+        void WriteBytes(const void* data, const std::size_t size) {
+            const auto offset = m_buffer.size();
+            m_buffer.resize(offset + size);
+            if (size > 0) {
+                std::memcpy(m_buffer.data() + offset, data, size);
+            }
+        }
+
+        template<class T>
+        void Write(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>, "SnapshotWriter::Write: Type must be trivially copyable");
+            WriteBytes(&value, sizeof(T));
+        }
+
+        /**
+         * Write the element count followed by the elements in one copy.
+         */
+        template<class T>
+        void WriteArray(const std::span<const T> values) {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "SnapshotWriter::WriteArray: Type must be trivially copyable");
+            Write<uint64_t>(values.size());
+            WriteBytes(values.data(), values.size_bytes());
+        }
+
+        void WriteString(const std::string_view value) {
+            Write<uint64_t>(value.size());
+            WriteBytes(value.data(), value.size());
+        }
+
+    private:
+        std::vector<std::byte>& m_buffer;
+    };
+
+    /**
+     * @class SnapshotReader
+     * @brief Reads the values written by a SnapshotWriter back in the same order.
+     *
+     * Every read is bounds checked and throws a std::runtime_error if the snapshot is truncated.
+     */
+    class SnapshotReader {
+    public:
+        explicit SnapshotReader(const std::span<const std::byte> data) : m_data(data) {
+        }
+
+        void ReadBytes(void* out, const std::size_t size) {
+            if (size > m_data.size() - m_offset) {
+                throw std::runtime_error("SnapshotReader: Snapshot is truncated");
+            }
+            if (size > 0) {
+                std::memcpy(out, m_data.data() + m_offset, size);
+            }
+            m_offset += size;
+        }
+
+        template<class T>
+        T Read() {
+            static_assert(std::is_trivially_copyable_v<T>, "SnapshotReader::Read: Type must be trivially copyable");
+            T value;
+            ReadBytes(&value, sizeof(T));
+            return value;
+        }
+
+        /**
+         * Read an array written by WriteArray, replacing the content of out but keeping its capacity.
+         */
+        template<class T, class Allocator>
+        void ReadArray(std::vector<T, Allocator>& out) {
+            static_assert(std::is_trivially_copyable_v<T>, "SnapshotReader::ReadArray: Type must be trivially copyable");
+            const auto count = ReadCount(sizeof(T));
+            out.resize(count);
+            ReadBytes(out.data(), count * sizeof(T));
+        }
+
+        std::string ReadString() {
+            const auto size = ReadCount(1);
+            std::string value(size, '\0');
+            ReadBytes(value.data(), size);
+            return value;
+        }
+
+        /**
+         * Read an element count and check that the remaining data can hold that many elements.
+         * @param element_size The minimal size of one element in bytes
+         */
+        std::size_t ReadCount(const std::size_t element_size) {
+            const auto count = Read<uint64_t>();
+            if (element_size > 0 && count > (m_data.size() - m_offset) / element_size) {
+                throw std::runtime_error("SnapshotReader: Snapshot is truncated");
+            }
+            return static_cast<std::size_t>(count);
+        }
+
+        [[nodiscard]] bool AtEnd() const { return m_offset == m_data.size(); }
+
+    private:
+        std::span<const std::byte> m_data;
+        std::size_t m_offset = 0;
+    };
+} // namespace
@@ -0,0 +1,82 @@
+#pragma once
+#include <type_traits>
+
+#include "Ecs/ISystem.hpp"
+
+namespace Engine::Ecs
+{
+    using SystemRunFn = void (*)(ISystem&, float);
+    using SystemCollisionFn = void (*)(ISystem&, const EntityId&, const EntityId&);
+
+    /**
+     * Calls into one concrete system type, emitted per system by the code generator. Every function casts to the
+     * concrete type and calls the member with a qualified name, which skips the virtual dispatch and lets the compiler
+     * inline Run() into the call. Callbacks the system does not override stay null, so the system manager does not
+     * subscribe them to the physics events at all.
+     */
+    struct SystemDispatch
+    {
+        SystemRunFn run = nullptr;
+        SystemCollisionFn on_collision_enter = nullptr;
+        SystemCollisionFn on_collision_exit = nullptr;
+        SystemCollisionFn on_trigger_enter = nullptr;
+        SystemCollisionFn on_trigger_exit = nullptr;
+    };
+
+    namespace Detail
+    {
+        using CollisionMember = void (ISystem::*)(const EntityId&, const EntityId&);
+
+        /**
+         * Taking the address of an inherited member yields a pointer to a member of the class declaring it, so the
+         * type only differs from the one of ISystem if S or one of its bases overrides the callback.
+         */
+        template <typename Member>
+        constexpr bool IsOverridden = !std::is_same_v<Member, CollisionMember>;
+    }
+
+    /**
+     * @tparam S The concrete system type
+     * @return The direct calls into S
+     */
+    template <typename S>
+    constexpr SystemDispatch MakeSystemDispatch()
+    {
+        static_assert(std::is_base_of_v<ISystem, S>, "MakeSystemDispatch: S must derive from ISystem");
+
+        SystemDispatch dispatch{};
+        dispatch.run = [](ISystem& system, const float delta_time)
+        {
+            static_cast<S&>(system).S::Run(delta_time);
+        };
+        if constexpr (Detail::IsOverridden<decltype(&S::OnCollisionEnter)>)
+        {
+            dispatch.on_collision_enter = [](ISystem& system, const EntityId& target, const EntityId& other)
+            {
+                static_cast<S&>(system).S::OnCollisionEnter(target, other);
+            };
+        }
+        if constexpr (Detail::IsOverridden<decltype(&S::OnCollisionExit)>)
+        {
+            dispatch.on_collision_exit = [](ISystem& system, const EntityId& target, const EntityId& other)
+            {
+                static_cast<S&>(system).S::OnCollisionExit(target, other);
+            };
+        }
+        if constexpr (Detail::IsOverridden<decltype(&S::OnTriggerEnter)>)
+        {
+            dispatch.on_trigger_enter = [](ISystem& system, const EntityId& target, const EntityId& other)
+            {
+                static_cast<S&>(system).S::OnTriggerEnter(target, other);
+            };
+        }
+        if constexpr (Detail::IsOverridden<decltype(&S::OnTriggerExit)>)
+        {
+            dispatch.on_trigger_exit = [](ISystem& system, const EntityId& target, const EntityId& other)
+            {
+                static_cast<S&>(system).S::OnTriggerExit(target, other);
+            };
+        }
+        return dispatch;
+    }
+} // namespace
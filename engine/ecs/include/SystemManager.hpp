@@ -1,14 +1,16 @@
 #pragma once
-#include <any>
-#include <functional>
+#include <array>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "IEngineSystem.hpp"
 #include "ISystemManager.hpp"
+#include "SystemTimingStats.hpp"
 #include "SystemWorld.hpp"
+#include "../src/TimingWindow.hpp"
 #include "../../systems/src/CacheManager.hpp"
+#include "JobSystem.hpp"
 
 namespace Engine::Input
 {
@@ -33,12 +35,34 @@ namespace Engine::Ecs
             void FixedUpdateSystems(float fixed_dt) override;
             void UpdateSystems(float delta_time) override;
 
-            void RegisterForSystemCommands(std::string subscriber_name,
-                                           std::function<void(std::vector<std::any>)> command_callback) override;
-
-            void DeregisterForSystemCommands(const std::string& subscriber_name) override;
+            /**
+             * Get the timings of every phase and system over the most recent runs. Systems are kept by name,
+             * so the report also covers the systems of scenes that were unloaded since.
+             * @return The timings in execution order of the phases and systems
+             */
+            [[nodiscard]] SystemTimingReport GetTimingReport() const;
 
         private:
+            struct SystemProfile
+            {
+                std::string name;
+                Phase phase;
+                TimingWindow time;
+                std::size_t queried_entities = 0;
+            };
+
+            /**
+             * A system as laid out in the stage tables, the run function and the profile are resolved once on
+             * registration.
+             */
+            struct ScheduledSystem
+            {
+                ISystem* system;
+                SystemRunFn run;
+                SystemProfile* profile;
+            };
+
+            World* m_world = nullptr;
             std::unique_ptr<SystemWorld> m_game_world;
             std::vector<SystemMeta> m_system_metas;
             IServiceToEcsProvider* m_service_provider;
@@ -46,10 +70,37 @@ namespace Engine::Ecs
 
             std::vector<Phase> m_phase_execution_order;
             std::unordered_map<Phase, std::vector<std::unique_ptr<ISystem>>> m_phase_map;
-            std::unordered_map<std::string, std::function<void(std::vector<std::any>)>> m_command_callback_subscriber;
+            /**
+             * Indexed by phase, the systems grouped into stages. Stages run one after another, the systems of a stage
+             * run concurrently on the job system.
+             */
+            std::array<std::vector<std::vector<ScheduledSystem>>, PHASE_COUNT> m_phase_stages;
+            Jobs::JobSystem* m_job_system = nullptr;
+            std::unique_ptr<Jobs::JobSystem> m_owned_job_system;
+
+            std::vector<std::unique_ptr<SystemProfile>> m_system_profiles;
+            std::unordered_map<std::string, SystemProfile*> m_system_profiles_by_name;
+            std::vector<Phase> m_profiled_phases;
+            std::unordered_map<Phase, TimingWindow> m_phase_timings;
+
+            SystemProfile* GetOrCreateProfile(const std::string& name, Phase phase);
+
+            static void RunProfiled(const ScheduledSystem& scheduled, float delta_time);
+
+            /**
+             * Subscribe the collision callbacks of a system to the physics events. With a generated dispatch, only
+             * the callbacks the system overrides are subscribed.
+             */
+            void SubscribePhysicsCallbacks(ISystem& system, const SystemDispatch& dispatch) const;
+
+            void BuildPhaseStages(const std::vector<SystemMeta>& sorted_metas,
+                                  const std::vector<ScheduledSystem>& sorted_systems);
 
             void RunPhase(Phase phase, float delta_time);
 
-            void RaiseCommandsEvent(const std::vector<std::any>& commands) const;
+            /**
+             * Drop the change records every system has already seen, i.e. everything up to the oldest last run tick.
+             */
+            void TrimChanges() const;
     };
 } // namespace
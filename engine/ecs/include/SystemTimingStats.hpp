@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ISystemManager.hpp"
+
+namespace Engine::Ecs
+{
+    /**
+     * Run time statistics over the rolling window of the most recent samples, in milliseconds.
+     */
+    struct TimingStats
+    {
+        float min_ms = 0.0f;
+        float avg_ms = 0.0f;
+        float max_ms = 0.0f;
+        float p99_ms = 0.0f;
+        std::size_t samples = 0;
+    };
+
+    struct SystemTimingStats
+    {
+        std::string name;
+        Phase phase;
+        TimingStats time;
+        /**
+         * Entities matched by the views the system requested during its last run. Joined views count the
+         * entities of their smallest pool, which is an upper bound of the visited entities.
+         */
+        std::size_t queried_entities;
+    };
+
+    struct PhaseTimingStats
+    {
+        Phase phase;
+        TimingStats time;
+    };
+
+    /**
+     * @struct SystemTimingReport
+     * @brief Timings of every phase and system that ran since the system manager was created.
+     */
+    struct SystemTimingReport
+    {
+        std::vector<PhaseTimingStats> phases;
+        std::vector<SystemTimingStats> systems;
+
+        /**
+         * @return One line per phase and system with the columns kind, name, phase, samples, min, avg, max, p99
+         * and entities
+         */
+        [[nodiscard]] std::string ToCsv() const;
+
+        /**
+         * @return The report as a JSON object with a "phases" and a "systems" array
+         */
+        [[nodiscard]] std::string ToJson() const;
+    };
+} // namespace
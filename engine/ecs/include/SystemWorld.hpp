@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include "World.hpp"
@@ -22,10 +23,14 @@ namespace Engine::Ecs {
 
         void DestroyEntity(const EntityId& entity) const { return m_world->DestroyEntity(entity); }
 
-        [[nodiscard]] EntityId GetEntityByName(const std::string& name) const {
+        [[nodiscard]] EntityId GetEntityByName(const std::string_view name) const {
             return m_world->GetEntityByName(name);
         }
 
+        [[nodiscard]] EntityId GetEntityByName(const NameId name) const { return m_world->GetEntityByName(name); }
+
+        EntityId Resolve(NamedEntity& handle) const { return m_world->Resolve(handle); }
+
         template<typename T>
         void AddComponent(const EntityId entity, T component) {
             m_world->AddComponent<T>(entity, component);
@@ -39,9 +44,51 @@ namespace Engine::Ecs {
         template<typename T>
         T* GetComponent(const EntityId entity) const { return m_world->GetComponent<T>(entity); }
 
+        template<typename... Ts>
+        [[nodiscard]] bool HasComponents(const EntityId entity) const { return m_world->HasComponents<Ts...>(entity); }
+
+        template<typename T>
+        ComponentView<T> GetComponentView() { return m_world->GetComponentView<T>(); }
+
+        template<typename... Ts, typename... Ex>
+        EntityView<Exclude<Ex...>, Ts...> View(Exclude<Ex...> exclude = {}) {
+            return m_world->View<Ts...>(exclude);
+        }
+
+        template<typename... Ts, typename... Ex>
+        Query<Exclude<Ex...>, Ts...> RegisterQuery(Exclude<Ex...> exclude = {}) {
+            return m_world->RegisterQuery<Ts...>(exclude);
+        }
+
         template<typename T>
         std::vector<std::pair<T*, EntityId> > GetComponentsOfType() { return m_world->GetComponentsOfType<T>(); }
 
+        template<typename T>
+        T* Modify(const EntityId entity) const { return m_world->Modify<T>(entity); }
+
+        template<typename T>
+        void MarkChanged(const EntityId entity) const { m_world->MarkChanged<T>(entity); }
+
+        template<typename T>
+        ChangedView<T> Added(const ChangeTick since) { return m_world->Added<T>(since); }
+
+        template<typename T>
+        ChangedView<T> Changed(const ChangeTick since) { return m_world->Changed<T>(since); }
+
+        template<typename T>
+        ChangeLogView Removed(const ChangeTick since) { return m_world->Removed<T>(since); }
+
+        template<typename T>
+        [[nodiscard]] const T* GetResource() const { return m_world->GetResource<T>(); }
+
+        template<typename T>
+        T* ModifyResource() const { return m_world->ModifyResource<T>(); }
+
+        template<typename T>
+        [[nodiscard]] bool IsResourceChanged(const ChangeTick since) const {
+            return m_world->IsResourceChanged<T>(since);
+        }
+
     private:
         World* m_world;
     };
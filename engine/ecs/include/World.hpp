@@ -4,42 +4,311 @@
 
 #pragma once
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
 
+#include "ComponentStorage.hpp"
+#include "NamedEntity.hpp"
+#include "Prefab.hpp"
+#include "WorldMemoryStats.hpp"
+#include "WorldSnapshot.hpp"
 #include "PhysicsEventBus.hpp"
+#include "Ecs/CommandBus.hpp"
+#include "../src/ChangedView.hpp"
+#include "../src/ComponentView.hpp"
+#include "../src/EntityView.hpp"
+#include "../src/Query.hpp"
+#include "../src/buffer/CommandArena.hpp"
 #include "../src/buffer/EcsEvent.hpp"
 #include "../src/buffer/PhysicsEvent.hpp"
 #include "../src/buffer/EventBuffer.hpp"
-#include "../src/buffer/SystemCommandQueue.hpp"
 
 namespace Engine::Ecs {
     class World {
     public:
-        World();
+        /**
+         * @param storage The layout of the components, the per-type pools unless a world opts into archetypes
+         */
+        explicit World(ComponentStorage storage = ComponentStorage::SparseSet);
 
         ~World();
 
+        /**
+         * Register the component types of the generated component table, see ComponentManager::RegisterReflectedTypes().
+         * Every world created afterwards starts with the pools of these types, each reserved for capacity components.
+         * @param types The reflected component types, in the order of their type ids
+         * @param capacity The number of components each of these pools is reserved for
+         */
+        static void RegisterComponentTypes(std::span<const ComponentTypeInfo> types, std::size_t capacity = 0);
+
         [[nodiscard]] EntityId CreateEntity(const std::string& name) const;
 
+        /**
+         * Create an anonymous entity. It can not be fetched by name, which saves the name lookup for entities that
+         * are only reached through their components, like the tiles of a level.
+         * @return The pending entity, committed by the next call to ApplyEngineEvents()
+         */
+        [[nodiscard]] EntityId CreateEntity() const;
+
+        /**
+         * Create anonymous entities in bulk. Indices and generations are reserved in one pass and the whole batch is
+         * queued as a single event.
+         * @param count The number of entities to create
+         * @param out Receives the created entities, must hold at least count elements
+         */
+        void CreateEntities(std::size_t count, std::span<EntityId> out) const;
+
+        /**
+         * Spawn instances of a prefab. The entities are reserved in one pass and the whole batch is queued as a
+         * single event. Applying it writes every component type into its pool in one pass and raises the add events
+         * per type as one batch, once all components of the instances exist.
+         * @param prefab The components every instance starts with
+         * @param count The number of instances
+         * @param out Receives the created entities, must hold at least count elements
+         * @param overrides Per instance components, each holding count values
+         * @throws std::invalid_argument if out or an override holds less than count elements
+         */
+        void Instantiate(const Prefab& prefab, std::size_t count, std::span<EntityId> out,
+                         const PrefabOverrides& overrides = {}) const;
+
         void DestroyEntity(EntityId entity) const;
 
         void ClearEntities() const;
 
-        [[nodiscard]] EntityId GetEntityByName(const std::string& name) const;
+        /**
+         * Destroy all entities, components and resources at once, keeping the capacity of the entity table, the pools
+         * and the command arena. Queued events and commands are dropped. Instead of a remove event per component, subscribers
+         * get a single world reset event, see ComponentEventBus::SubscribeOnWorldResetEvent(). Handles from before the
+         * reset are no longer alive.
+         */
+        void Reset() const;
+
+        /**
+         * Drop all component and physics event subscriptions, so the systems of the next scene can subscribe to this
+         * world. Command subscriptions are owned by the scenes, which remove them on unload.
+         */
+        void ClearSubscriptions() const;
+
+        [[nodiscard]] EntityId GetEntityByName(std::string_view name) const;
+
+        /**
+         * Fetch an entity by the id of its name, e.g. GetEntityByName("Player"_name).
+         * @param name The id of the entity name
+         * @return The entity, or INVALID_ENTITY_ID if no entity with this name exists
+         */
+        [[nodiscard]] EntityId GetEntityByName(NameId name) const;
+
+        /**
+         * Get the entity behind a named handle. The cached entity is returned as long as it exists, otherwise it
+         * is looked up by name again and cached.
+         * @param handle The handle to resolve
+         * @return The entity, or INVALID_ENTITY_ID if no entity with the name of the handle exists
+         */
+        EntityId Resolve(NamedEntity& handle) const;
 
         template<typename T>
         void AddComponent(EntityId entity, T component);
 
+        /**
+         * Add one component per entity in bulk. The components are copied into the command arena as one block and
+         * moved into their pool by the next call to ApplyEngineEvents(). Entities that are neither alive nor pending
+         * are skipped.
+         * @tparam T The component type
+         * @param entities The entities to add the components to
+         * @param components The components, one per entity
+         */
+        template<typename T>
+        void AddComponents(std::span<const EntityId> entities, std::span<const T> components);
+
         template<typename T>
         void RemoveComponent(EntityId entity) const;
 
         void ApplyEngineEvents() const;
 
+        /**
+         * Serialize the entity table and every component pool into one contiguous blob. Trivially copyable
+         * components are copied as whole arrays, other components need a ComponentSerializer specialization.
+         * @return The snapshot, restorable with Restore() by any world of the same build
+         * @throws std::logic_error if structural changes are queued, apply them first, or if the world stores its
+         * components in archetypes
+         */
+        [[nodiscard]] WorldSnapshot Snapshot() const;
+
+        /**
+         * Replace all entities and components with the ones of a snapshot. Queued structural changes are
+         * discarded. The remove events of the current components and the add events of the restored ones are
+         * raised outside the structural lock, so the engine caches follow and handlers may call into the world.
+         * The snapshot is decoded completely before anything is replaced, a corrupt one leaves the world unchanged.
+         * Entities and their names are restored with their ids, so handles taken before the snapshot stay valid.
+         * @param snapshot The snapshot to restore
+         * @throws std::runtime_error if the snapshot is not a world snapshot or it is corrupt
+         * @throws std::logic_error if the world stores its components in archetypes
+         */
+        void Restore(const WorldSnapshot& snapshot) const;
+
         template<typename T>
         T* GetComponent(EntityId entity);
 
+        /**
+         * Check if an entity owns all given component types with a single signature comparison.
+         * Components queued for adding or removing only count once they were applied.
+         * @tparam Ts The component types
+         * @param entity The entity to check
+         * @return True if the entity exists and owns every component of Ts
+         */
+        template<typename... Ts>
+        [[nodiscard]] bool HasComponents(EntityId entity) const;
+
+        /**
+         * Get a non-allocating view over all components of the given type.
+         * The cost of iterating the view scales with the number of components of this type, not with the number of
+         * entities in the world. The view is invalidated by the next call to ApplyEngineEvents().
+         * @tparam T The component type
+         * @return A view yielding (component pointer, entity) pairs
+         * @throws std::logic_error if the world stores its components in archetypes, use View() instead
+         */
+        template<typename T>
+        ComponentView<T> GetComponentView();
+
+        /**
+         * Get a non-allocating view over all entities owning every component of Ts and none of Ex.
+         * The view walks the smallest of the required pools and probes the others, so its cost scales with the
+         * number of candidate entities only. Iterating yields (EntityId, Ts&...) tuples. If the world stores its
+         * components in archetypes, the view walks the chunks of every archetype owning the components instead.
+         * @tparam Ts The required component types, const qualified types are yielded as const references
+         * @tparam Ex The excluded component types, deduced from the optional Exclude filter
+         * @return A view that is invalidated by the next call to ApplyEngineEvents()
+         */
+        template<typename... Ts, typename... Ex>
+        EntityView<Exclude<Ex...>, Ts...> View(Exclude<Ex...> exclude = {});
+
+        /**
+         * Register a persistent query over all entities owning every component of Ts and none of Ex, or get the
+         * already registered one. The world keeps its entities in a list sorted by entity index, updated while
+         * ApplyEngineEvents() adds and removes components, so iterating it only walks that list. Queries asking for
+         * the same components share their list and live as long as the world, including across Reset().
+         * Register queries once, e.g. in ISystem::Initialize(), and keep the handle instead of calling View() every
+         * frame. Registering takes the structural lock and scans the pools, so it does not belong in an update.
+         * @tparam Ts The required component types, const qualified types are yielded as const references
+         * @tparam Ex The excluded component types, deduced from the optional Exclude filter
+         * @return A query handle that stays valid as long as the world
+         * @throws std::logic_error if the world stores its components in archetypes, use View() instead
+         */
+        template<typename... Ts, typename... Ex>
+        Query<Exclude<Ex...>, Ts...> RegisterQuery(Exclude<Ex...> exclude = {});
+
         template<typename T>
         std::vector<std::pair<T*, EntityId> > GetComponentsOfType();
 
+        /**
+         * Get a component for writing and record the write, so the entity shows up in Changed<T>().
+         * @tparam T The component type
+         * @param entity The entity owning the component
+         * @return The component, or nullptr if the entity does not exist or has no such component
+         */
+        template<typename T>
+        T* Modify(EntityId entity);
+
+        /**
+         * Record a write to a component that was done through a view or a pointer. Writes are not detected
+         * automatically, only adding a component counts as a change by itself.
+         * @tparam T The component type
+         * @param entity The entity owning the component
+         */
+        template<typename T>
+        void MarkChanged(EntityId entity);
+
+        /**
+         * Get a non-allocating view over the components added after the given tick.
+         * @tparam T The component type
+         * @param since The tick of the last look at the changes, usually the last run tick of a system
+         * @return A view yielding (component pointer, entity) pairs, every entity at most once
+         * @throws std::logic_error if the world stores its components in archetypes, which keep no change records
+         */
+        template<typename T>
+        ChangedView<T> Added(ChangeTick since);
+
+        /**
+         * Get a non-allocating view over the components added or marked as changed after the given tick.
+         * Its cost scales with the number of changed components, not with the number of components.
+         * @tparam T The component type
+         * @param since The tick of the last look at the changes, usually the last run tick of a system
+         * @return A view yielding (component pointer, entity) pairs, every entity at most once
+         * @throws std::logic_error if the world stores its components in archetypes, which keep no change records
+         */
+        template<typename T>
+        ChangedView<T> Changed(ChangeTick since);
+
+        /**
+         * Get a view over the entities that lost their component of the given type after the tick.
+         * @tparam T The component type
+         * @param since The tick of the last look at the changes, usually the last run tick of a system
+         * @return A view yielding the entities, which might already be destroyed
+         * @throws std::logic_error if the world stores its components in archetypes, which keep no change records
+         */
+        template<typename T>
+        ChangeLogView Removed(ChangeTick since);
+
+        /**
+         * Advance the tick changes are stamped with. Called by the system manager before every stage.
+         * @return The new tick
+         */
+        ChangeTick AdvanceChangeTick() const;
+
+        [[nodiscard]] ChangeTick GetChangeTick() const;
+
+        /**
+         * Drop the change records of all component types older than the given tick.
+         * @param oldest_tick The oldest tick to keep
+         */
+        void TrimChanges(ChangeTick oldest_tick) const;
+
+        /**
+         * Store the single value of a type in the world, replacing the previous one, e.g. the active camera. Resources
+         * are set on the main thread outside of the system updates, by scenes or in component event callbacks.
+         * @tparam T The resource type
+         * @param resource The new value
+         */
+        template<typename T>
+        void SetResource(T resource) const;
+
+        /**
+         * Get a resource in constant time.
+         * @tparam T The resource type
+         * @return The resource, or nullptr if it was never set or was removed
+         */
+        template<typename T>
+        [[nodiscard]] const T* GetResource() const;
+
+        /**
+         * Get a resource for writing and record the write, so IsResourceChanged() reports it. Systems writing a
+         * resource declare it in WRITES, like a component.
+         * @tparam T The resource type
+         * @return The resource, or nullptr if it was never set or was removed
+         */
+        template<typename T>
+        T* ModifyResource() const;
+
+        template<typename T>
+        void RemoveResource() const;
+
+        /**
+         * Check if a resource was set, modified or removed after the tick.
+         * @tparam T The resource type
+         * @param since The tick of the last look at the resource, usually the last run tick of a system
+         */
+        template<typename T>
+        [[nodiscard]] bool IsResourceChanged(ChangeTick since) const;
+
+        /**
+         * Measure the memory held by the component pools, the entity table, the name lookups, the event buffers and
+         * the command arena. Walks every pool and the entity table once, so take it once per second, not per frame.
+         * @return The memory and occupancy of this world
+         */
+        [[nodiscard]] WorldMemoryStats GetMemoryStats() const;
+
         [[nodiscard]] ComponentEventBus* GetComponentEventBus() const {
             return m_component_event_bus.get();
         }
@@ -56,22 +325,36 @@ namespace Engine::Ecs {
             return m_physics_event_buffer.get();
         }
 
-        void PushCommand(const std::any& cmd) const {
-            m_command_queue->PushCommand(cmd);
-        }
-
-        [[nodiscard]] std::vector<std::any> GetAllCommands() const {
-            return m_command_queue->ConsumeAll();
+        /**
+         * Get the bus routing the commands sent by systems to their subscribers, e.g. the active scene.
+         * @return The command bus of this world
+         */
+        [[nodiscard]] CommandBus* GetCommandBus() const {
+            return m_command_bus.get();
         }
 
     private:
         struct WorldImpl;
         std::unique_ptr<WorldImpl> m_impl;
         std::unique_ptr<Buffer::EventBuffer<EcsEvent> > m_ecs_event_buffer;
+        /**
+         * Holds the component payloads of the queued ECS events until they are applied.
+         */
+        std::unique_ptr<Buffer::CommandArena> m_command_arena;
         std::unique_ptr<Buffer::EventBuffer<PhysicsEvent> > m_physics_event_buffer;
         std::unique_ptr<ComponentEventBus> m_component_event_bus;
         std::unique_ptr<PhysicsEventBus> m_physics_event_bus;
-        std::unique_ptr<Buffer::SystemCommandQueue> m_command_queue;
+        std::unique_ptr<CommandBus> m_command_bus;
+
+        /**
+         * Taken exclusively by entity reservation, named entities and component type registration, so systems running
+         * in the same parallel stage can queue structural changes. Lookups reading the entity table, like
+         * GetComponent() and HasComponents(), take it shared, since reserving an entity may grow that table. So do
+         * the views while they bind their pools, since the first component of a new type creates its pool. The
+         * changes themselves are still applied on the main thread by ApplyEngineEvents(), which runs between the
+         * stages and takes no lock.
+         */
+        mutable std::shared_mutex m_structural_mutex;
     };
 }
 
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../src/ComponentPool.hpp"
+
+namespace Engine::Ecs {
+    struct ComponentMemoryStats {
+        std::size_t type_id;
+        /**
+         * The reflected name of the component type, the compiler generated one for types that are not reflected.
+         */
+        std::string name;
+        PoolMemoryUsage usage;
+    };
+
+    /**
+     * Usage of the entity table of a world. The table only grows, destroyed entities leave their index on the free
+     * list.
+     */
+    struct EntityMemoryStats {
+        /**
+         * Entity indices ever handed out, including the reserved index 0.
+         */
+        std::size_t capacity = 0;
+        std::size_t alive = 0;
+        std::size_t pending = 0;
+        std::size_t free_indices = 0;
+        std::size_t named = 0;
+        /**
+         * Bytes reserved for the generations, states, signatures and free list.
+         */
+        std::size_t table_bytes = 0;
+        /**
+         * Estimated bytes of the name lookups, counting the buckets and one node per name.
+         */
+        std::size_t name_bytes = 0;
+    };
+
+    struct EventBufferMemoryStats {
+        std::string name;
+        std::size_t queued = 0;
+        std::size_t capacity = 0;
+        /**
+         * The most events that were queued at once since the world was created.
+         */
+        std::size_t high_water_mark = 0;
+        std::size_t bytes = 0;
+    };
+
+    struct CommandArenaMemoryStats {
+        std::size_t blocks = 0;
+        std::size_t used_bytes = 0;
+        /**
+         * The most bytes that were in use at once since the world was created.
+         */
+        std::size_t high_water_bytes = 0;
+        std::size_t reserved_bytes = 0;
+    };
+
+    /**
+     * @struct WorldMemoryStats
+     * @brief Memory and occupancy of a world at the time it was taken, see World::GetMemoryStats().
+     */
+    struct WorldMemoryStats {
+        /**
+         * One entry per component pool, ordered by type id.
+         */
+        std::vector<ComponentMemoryStats> components;
+        EntityMemoryStats entities;
+        std::vector<EventBufferMemoryStats> event_buffers;
+        CommandArenaMemoryStats command_arena;
+
+        /**
+         * @return The dense, sparse and change log bytes of all pools
+         */
+        [[nodiscard]] std::size_t GetComponentBytes() const;
+
+        /**
+         * @return The bytes of all pools, the entity table, the event buffers and the command arena
+         */
+        [[nodiscard]] std::size_t GetTotalBytes() const;
+
+        /**
+         * @return The stats as a JSON object with a "components" array and "entities", "event_buffers" and
+         * "command_arena" entries
+         */
+        [[nodiscard]] std::string ToJson() const;
+    };
+} // namespace
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Engine::Ecs {
+    /**
+     * @class WorldSnapshot
+     * @brief The entity table and all component pools of a world, serialized into one contiguous binary blob.
+     *
+     * Created by World::Snapshot() and applied by World::Restore(). Pools are identified by the type name of their
+     * component, so a snapshot written to a file can only be restored by the same build of the game.
+     */
+    class WorldSnapshot {
+    public:
+        static constexpr uint32_t MAGIC = 0x4E53574D; // "MWSN"
+        static constexpr uint32_t VERSION = 1;
+
+        WorldSnapshot() = default;
+
+        explicit WorldSnapshot(std::vector<std::byte> data) : m_data(std::move(data)) {
+        }
+
+        [[nodiscard]] std::span<const std::byte> GetData() const { return m_data; }
+
+        [[nodiscard]] std::size_t Size() const { return m_data.size(); }
+
+        [[nodiscard]] bool Empty() const { return m_data.empty(); }
+
+        /**
+         * Write the snapshot to a binary file, replacing it if it exists.
+         * @param path The file to write
+         */
+        void SaveToFile(const std::filesystem::path& path) const;
+
+        /**
+         * Read a snapshot written by SaveToFile().
+         * @param path The file to read
+         * @return The snapshot
+         */
+        static WorldSnapshot LoadFromFile(const std::filesystem::path& path);
+
+    private:
+        std::vector<std::byte> m_data;
+    };
+} // namespace
@@ -0,0 +1,175 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <vector>
+
+#include "Entity.hpp"
+#include "PagedSparseArray.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * @class ChangeLog
+     * @brief Records which entities of a component pool were touched, stamped with the change tick of the world.
+     *
+     * An entity is recorded at most once per tick, and readers only visit the latest record of an entity index, so
+     * every entity shows up once no matter how often it was touched. Records are appended in tick order and trimmed once
+     * per frame. Recording is not synchronized, it requires write access to the component type, which the system
+     * scheduler never grants to two systems of the same stage.
+     */
+    class ChangeLog {
+    public:
+        struct Record {
+            EntityId entity;
+            ChangeTick tick;
+        };
+
+        /**
+         * Make room for an entity index. Only called by structural changes, so recording never grows the log state.
+         * @param entity_index The index of the entity
+         */
+        void Reserve(const uint64_t entity_index) {
+            m_latest.GetOrCreate(entity_index);
+        }
+
+        void Add(const EntityId entity, const ChangeTick tick) {
+            auto& latest = m_latest.GetOrCreate(GetEntityIndex(entity));
+            if (latest.entity == entity && latest.tick == tick) {
+                return;
+            }
+            // A recycled index supersedes the records of its previous generation, like a newer tick does
+            latest = Record{entity, tick};
+            m_records.push_back(latest);
+        }
+
+        /**
+         * Drop all records older than the given tick. The dropped records are skipped by moving the head, the
+         * storage is only compacted once they make up half of it.
+         * @param oldest_tick The oldest tick to keep
+         */
+        void Trim(const ChangeTick oldest_tick) {
+            const auto records = GetRecords();
+            const auto first_kept = std::ranges::partition_point(records, [oldest_tick](const Record& record) {
+                return record.tick < oldest_tick;
+            });
+            m_head += static_cast<std::size_t>(first_kept - records.begin());
+            if (m_head == m_records.size()) {
+                m_records.clear();
+                m_head = 0;
+            } else if (m_head >= m_records.size() / 2) {
+                m_records.erase(m_records.begin(), m_records.begin() + static_cast<std::ptrdiff_t>(m_head));
+                m_head = 0;
+            }
+        }
+
+        /**
+         * Drop all records, keeping the allocated memory.
+         */
+        void Reset() {
+            m_records.clear();
+            m_head = 0;
+            m_latest.Reset();
+        }
+
+        [[nodiscard]] bool IsLatest(const Record& record) const {
+            const auto latest = m_latest.GetUnchecked(GetEntityIndex(record.entity));
+            return latest.entity == record.entity && latest.tick == record.tick;
+        }
+
+        /**
+         * @return The records in tick order, valid until the next Add() or Trim()
+         */
+        [[nodiscard]] std::span<const Record> GetRecords() const {
+            return std::span<const Record>(m_records).subspan(m_head);
+        }
+
+        [[nodiscard]] std::size_t GetMemoryUsage() const {
+            return m_records.capacity() * sizeof(Record) + m_latest.GetMemoryUsage();
+        }
+
+    private:
+        std::vector<Record> m_records;
+        /**
+         * Index of the first record that was not trimmed yet.
+         */
+        std::size_t m_head = 0;
+        /**
+         * The latest record per entity index.
+         */
+        PagedSparseArray<Record, Record{INVALID_ENTITY_ID, 0}> m_latest;
+    };
+
+    /**
+     * @class ChangeLogView
+     * @brief Non-allocating view over the entities of a change log recorded after a given tick.
+     *
+     * Iterating yields the entity of every record that is newer than the tick and the latest record of its entity.
+     */
+    class ChangeLogView {
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = EntityId;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            Iterator() = default;
+
+            Iterator(const ChangeLogView* view, const std::size_t index) : m_view(view), m_index(index) {
+                SkipFiltered();
+            }
+
+            value_type operator*() const { return m_view->m_log->GetRecords()[m_index].entity; }
+
+            Iterator& operator++() {
+                ++m_index;
+                SkipFiltered();
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+
+        private:
+            const ChangeLogView* m_view = nullptr;
+            std::size_t m_index = 0;
+
+            void SkipFiltered() {
+                while (m_index < m_view->m_count && !m_view->Accepts(m_view->m_log->GetRecords()[m_index])) {
+                    ++m_index;
+                }
+            }
+        };
+
+        ChangeLogView() = default;
+
+        ChangeLogView(const ChangeLog* log, const ChangeTick since) : m_log(log),
+                                                                      m_count(log->GetRecords().size()),
+                                                                      m_since(since) {
+        }
+
+        [[nodiscard]] Iterator begin() const { return Iterator(this, 0); }
+
+        [[nodiscard]] Iterator end() const { return Iterator(this, m_count); }
+
+        [[nodiscard]] bool Empty() const { return begin() == end(); }
+
+    private:
+        const ChangeLog* m_log = nullptr;
+        std::size_t m_count = 0;
+        ChangeTick m_since = 0;
+
+        [[nodiscard]] bool Accepts(const ChangeLog::Record& record) const {
+            return record.tick > m_since && m_log->IsLatest(record);
+        }
+    };
+} // namespace
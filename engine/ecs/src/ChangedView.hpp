@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "ChangeLog.hpp"
+
+namespace Engine::Ecs {
+    template<class T>
+    class ComponentPool;
+
+    /**
+     * @class ChangedView
+     * @brief Non-allocating view over the components of a pool that were added or changed after a given tick.
+     *
+     * Iterating yields (component pointer, entity) pairs like a ComponentView, but only visits the entities recorded
+     * in the change log of the pool, so its cost scales with the number of changes and not with the pool size.
+     * Entities that lost the component since they were recorded are skipped.
+     */
+    template<class T>
+    class ChangedView {
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::pair<T*, EntityId>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            Iterator() = default;
+
+            Iterator(ComponentPool<T>* pool, const ChangeLogView::Iterator it,
+                     const ChangeLogView::Iterator end) : m_pool(pool), m_it(it), m_end(end) {
+                SkipRemoved();
+            }
+
+            value_type operator*() const {
+                const auto entity = *m_it;
+                return {&m_pool->GetUnchecked(entity), entity};
+            }
+
+            Iterator& operator++() {
+                ++m_it;
+                SkipRemoved();
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+
+        private:
+            ComponentPool<T>* m_pool = nullptr;
+            ChangeLogView::Iterator m_it;
+            ChangeLogView::Iterator m_end;
+
+            void SkipRemoved() {
+                while (m_it != m_end && !m_pool->Contains(*m_it)) {
+                    ++m_it;
+                }
+            }
+        };
+
+        ChangedView() = default;
+
+        ChangedView(ComponentPool<T>* pool, const ChangeLogView log_view) : m_pool(pool), m_log_view(log_view) {
+        }
+
+        [[nodiscard]] Iterator begin() const { return Iterator(m_pool, m_log_view.begin(), m_log_view.end()); }
+
+        [[nodiscard]] Iterator end() const { return Iterator(m_pool, m_log_view.end(), m_log_view.end()); }
+
+        [[nodiscard]] bool Empty() const { return begin() == end(); }
+
+    private:
+        ComponentPool<T>* m_pool = nullptr;
+        ChangeLogView m_log_view;
+    };
+} // namespace
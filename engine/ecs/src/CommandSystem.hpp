@@ -3,16 +3,15 @@
 //
 
 #pragma once
-#include <unordered_set>
-
 #include "IEngineSystem.hpp"
 
 namespace Engine::Ecs {
+    /**
+     * Hands the commands sent by the systems during this frame to their subscribers.
+     */
     class CommandSystem : public IEngineSystem {
     public:
-        explicit CommandSystem(const std::function<void(std::vector<std::any>)> &cb) {
-            m_commands_callback = cb;
-        }
+        CommandSystem() = default;
 
         ~CommandSystem() override = default;
 
@@ -20,11 +19,7 @@ namespace Engine::Ecs {
         };
 
         void Run(float delta_time) override {
-            const auto commands = EcsWorld()->GetAllCommands();
-            m_commands_callback(commands);
+            EcsWorld()->GetCommandBus()->Dispatch();
         }
-
-    private:
-        std::function<void(std::vector<std::any>)> m_commands_callback;
     };
 }
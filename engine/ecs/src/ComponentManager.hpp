@@ -3,15 +3,28 @@
 //
 
 #pragma once
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 #include <memory>
+#include <span>
 #include <typeindex>
 #include <GL/glew.h>
 
 #include "../include/ComponentEventBus.hpp"
+#include "../include/ComponentReflection.hpp"
+#include "../include/ComponentStorage.hpp"
 #include "ComponentPool.hpp"
+#include "ComponentSignature.hpp"
+#include "ComponentView.hpp"
+#include "EntityView.hpp"
+#include "Query.hpp"
 #include "Entity.hpp"
+#include "archetype/ArchetypeStorage.hpp"
 
 namespace Engine::Ecs {
     using ComponentTypeId = std::size_t;
@@ -23,6 +36,10 @@ namespace Engine::Ecs {
 
         void (*add)(ComponentManager &, EntityId, const void *bytes);
 
+        const void *(*emplace)(ComponentManager &, EntityId, void *bytes);
+
+        void (*emplace_range)(ComponentManager &, std::span<const EntityId>, void *bytes, ComponentEventBus *);
+
         void (*set)(ComponentManager &, EntityId, const void *bytes);
 
         void (*remove)(ComponentManager &, EntityId);
@@ -32,6 +49,48 @@ namespace Engine::Ecs {
         void (*on_add_event)(ComponentEventBus &, EntityId, const void *) = nullptr;
 
         void (*on_remove_event)(ComponentEventBus &, EntityId) = nullptr;
+
+        /**
+         * Name of the component type, identifies its pool in a world snapshot.
+         */
+        const char *type_name = nullptr;
+
+        /**
+         * Readable name of the component type for reports, the reflected name if the type is reflected.
+         */
+        std::string_view display_name;
+
+        /**
+         * Null if the component type can not be serialized, see ComponentSerializer.
+         */
+        void (*serialize)(const ComponentManager &, SnapshotWriter &) = nullptr;
+
+        std::unique_ptr<IComponentPool> (*deserialize)(ComponentManager &, SnapshotReader &) = nullptr;
+
+        void (*restore)(ComponentManager &, IComponentPool &staged) = nullptr;
+
+        void (*raise_add_events)(ComponentManager &, ComponentEventBus &) = nullptr;
+
+        void (*fill_range)(ComponentManager &, std::span<const EntityId>, const void *bytes) = nullptr;
+
+        void (*raise_add_range_events)(ComponentManager &, ComponentEventBus &, std::span<const EntityId>) = nullptr;
+
+        /**
+         * Registers the component type in the archetype storage, only called if the components are stored there.
+         */
+        ArchetypeComponentId (*register_archetype_type)(ComponentManager &) = nullptr;
+    };
+
+    /**
+     * Components of one type added to a batch of entities, see ComponentManager::AddRangesById().
+     */
+    struct ComponentRange {
+        ComponentTypeId component_type_id;
+        /**
+         * Either one component copied to every entity, or one component per entity that is moved from.
+         */
+        void *values;
+        bool per_instance;
     };
 
 
@@ -42,10 +101,12 @@ namespace Engine::Ecs {
      * This class handles the addition, removal, and retrieval of components tied to entities. Components are
      * stored in specialized pools for efficient access and manipulation. ComponentManager ensures
      * type-safe operations and provides utilities to query component associations.
+     * With ComponentStorage::Archetype, components are added, removed, fetched and viewed through an
+     * ArchetypeStorage instead. The pools are still created per type, but stay empty.
      */
     class ComponentManager {
     public:
-        ComponentManager();
+        explicit ComponentManager(ComponentStorage storage = ComponentStorage::SparseSet);
 
         ~ComponentManager();
 
@@ -67,14 +128,118 @@ namespace Engine::Ecs {
         template<typename T>
         std::vector<EntityId> GetEntitiesWithComponent();
 
+        [[nodiscard]] ComponentStorage GetStorage() const {
+            return m_archetypes ? ComponentStorage::Archetype : ComponentStorage::SparseSet;
+        }
+
+        /**
+         * @throws std::logic_error if the components are stored in archetypes
+         */
+        template<typename T>
+        ComponentView<T> GetComponentView();
+
+        template<typename... Ts, typename... Ex>
+        EntityView<Exclude<Ex...>, Ts...> GetEntityView(Exclude<Ex...> exclude = {});
+
+        /**
+         * Bind a registered query entry to the pools of its component types, creating missing pools.
+         * @param entry The entry holding the matching entities
+         * @return A query walking the entities of the entry
+         * @throws std::logic_error if the components are stored in archetypes
+         */
+        template<typename... Ts, typename... Ex>
+        Query<Exclude<Ex...>, Ts...> GetQuery(const QueryRegistry::Entry &entry, Exclude<Ex...> exclude = {});
+
+        /**
+         * @throws std::logic_error if the components are stored in archetypes, which keep no change records
+         */
+        template<typename T>
+        ChangedView<T> GetAddedView(ChangeTick since);
+
+        template<typename T>
+        ChangedView<T> GetChangedView(ChangeTick since);
+
+        template<typename T>
+        ChangeLogView GetRemovedView(ChangeTick since);
+
+        template<typename T>
+        void MarkChanged(EntityId entity);
+
+        /**
+         * Advance the tick changes are stamped with.
+         * @return The new tick
+         */
+        ChangeTick AdvanceChangeTick() { return ++m_change_tick; }
+
+        [[nodiscard]] ChangeTick GetChangeTick() const { return m_change_tick; }
+
+        /**
+         * Drop the change records of all pools older than the given tick.
+         * @param oldest_tick The oldest tick to keep
+         */
+        void TrimChanges(ChangeTick oldest_tick) const;
+
         template<typename T>
         ComponentTypeId RegisterType();
 
         template<typename T>
         ComponentTypeId GetComponentTypeId() const;
 
+        /**
+         * @tparam Ts The component types
+         * @return The signature with the bits of all given types set, built once per type list
+         */
+        template<typename... Ts>
+        static const ComponentSignature &GetSignature();
+
         void AddById(EntityId entity, ComponentTypeId component_type, const void *bytes);
 
+        /**
+         * Move a component into its pool, leaving the source in a moved-from state.
+         * @param entity The entity to add the component to
+         * @param component_type The type id of the component
+         * @param bytes The component to move from
+         * @return The component stored in the pool, or nullptr if the type is not registered
+         */
+        const void *EmplaceById(EntityId entity, ComponentTypeId component_type, void *bytes);
+
+        /**
+         * Move one component per entity into the pool of the component type.
+         * @param entities The entities to add the components to
+         * @param component_type The type id of the components
+         * @param bytes The first of the contiguously stored components to move from
+         * @param event_bus If set, the add events are raised as one batch
+         */
+        void EmplaceRangeById(std::span<const EntityId> entities, ComponentTypeId component_type, void *bytes,
+                              ComponentEventBus *event_bus);
+
+        /**
+         * Add a copy of the same component to every entity. No events are raised, see RaiseAddEventsById().
+         * @param entities The entities to add the component to
+         * @param component_type The type id of the component
+         * @param bytes The component to copy
+         */
+        void FillRangeById(std::span<const EntityId> entities, ComponentTypeId component_type, const void *bytes);
+
+        /**
+         * Add several component types to every entity, e.g. the components of a prefab to its instances. The archetype
+         * storage moves every entity into its final archetype once instead of once per type.
+         * No events are raised, see RaiseAddEventsById().
+         * @param entities The entities to add the components to
+         * @param components The component types and their values
+         */
+        void AddRangesById(std::span<const EntityId> entities, std::span<const ComponentRange> components);
+
+        /**
+         * Raise the add events of the components the given entities own in the pool of the component type, as one
+         * batch.
+         * @param entities The entities that got a component of the type
+         * @param component_type The type id of the component
+         * @param event_bus The bus to raise the events on
+         */
+        void RaiseAddEventsById(std::span<const EntityId> entities, ComponentTypeId component_type,
+                                ComponentEventBus &event_bus);
+
         void SetById(EntityId entity, ComponentTypeId component_type, const void *bytes);
 
         void RemoveById(EntityId entity, ComponentTypeId component_type);
@@ -85,7 +250,83 @@ namespace Engine::Ecs {
 
         ComponentMeta GetComponentMeta(ComponentTypeId component_type_id) const;
 
-        std::vector<ComponentMeta> GetAllComponentsOfEntity(EntityId entity) const;
+        /**
+         * Remove every component of a signature from an entity. The remove events of all components are raised
+         * before the first component is removed.
+         * @param entity The entity to remove the components from
+         * @param signature The component types the entity owns
+         * @param event_bus The bus to raise the remove events on
+         */
+        void RemoveBySignature(EntityId entity, const ComponentSignature &signature,
+                               ComponentEventBus &event_bus) const;
+
+        /**
+         * Raise the remove event of every component of every pool. The entities of each pool are copied first, so
+         * handlers may change the pools.
+         */
+        void RaiseRemoveEvents(ComponentEventBus &event_bus) const;
+
+        /**
+         * Remove all components of all types, keeping the pools and their memory.
+         * @param event_bus If set, the remove event of every component is raised before the pools are cleared
+         * @throws std::logic_error if the components are stored in archetypes
+         */
+        void Clear(ComponentEventBus *event_bus) const;
+
+        /**
+         * Remove all components of all types and drop their change records, keeping the pools and their memory.
+         * No remove events are raised, see World::Reset().
+         */
+        void Reset() const;
+
+        /**
+         * Write every non-empty pool to a snapshot.
+         * @throws std::runtime_error if a pool holds components that can not be serialized
+         * @throws std::logic_error if the components are stored in archetypes
+         */
+        void Serialize(SnapshotWriter &writer) const;
+
+        /**
+         * Decode the pools written by Serialize() into detached pools, leaving the pools of this manager untouched.
+         * Apply them with Restore() once the whole snapshot was read.
+         * @param reader The snapshot to read from
+         * @return The decoded pools
+         * @throws std::runtime_error if a stored component type was never registered in this process or the data
+         * is corrupt
+         */
+        [[nodiscard]] std::vector<std::unique_ptr<IComponentPool>> Deserialize(SnapshotReader &reader);
+
+        /**
+         * Replace the content of all pools with the pools decoded by Deserialize(). Pools missing in the snapshot
+         * are cleared. No events are raised, see RaiseRemoveEvents() and RaiseAddEvents().
+         * @param staged The decoded pools, their components are moved out
+         */
+        void Restore(std::span<const std::unique_ptr<IComponentPool>> staged);
+
+        /**
+         * Raise the add event for every component of every pool, e.g. after the pools were restored.
+         */
+        void RaiseAddEvents(ComponentEventBus &event_bus);
+
+        /**
+         * Call fn(ComponentTypeId, const IComponentPool&) for every pool.
+         */
+        template<class Fn>
+        void ForEachPool(Fn &&fn) const;
+
+        /**
+         * Grow the pool of a registered component type, so it holds capacity components without reallocating.
+         */
+        void ReservePool(ComponentTypeId component_type, std::size_t capacity) const;
+
+        /**
+         * Register the component types of the generated component table for the whole process. Their type ids are
+         * handed out in the order of the table, so they are the same on every run as long as no other component type
+         * was used before. Every manager constructed afterwards creates the pools of these types up front.
+         * @param types The reflected component types
+         * @param capacity The number of components each of these pools is reserved for
+         */
+        static void RegisterReflectedTypes(std::span<const ComponentTypeInfo> types, std::size_t capacity);
 
     private:
         template<typename T>
@@ -97,14 +338,84 @@ namespace Engine::Ecs {
         template<typename T>
         const TypedComponentPool<T> *GetPoolConst() const;
 
+        template<typename T>
+        TypedComponentPool<T> *TryGetPool();
+
         static ComponentTypeId NextComponentTypeId();
+
+        /**
+         * @throws std::logic_error if the components are stored in archetypes, naming the unsupported operation
+         */
+        void RequirePools(const char *operation) const;
+
+        using TypeRegistration = ComponentTypeId (*)(ComponentManager &);
+
+        struct TypeRegistryEntry {
+            ComponentTypeId type_id;
+            // Null if several types share the name, like types in anonymous namespaces of different files
+            TypeRegistration registration;
+        };
+
+        /**
+         * Maps the type names of all component types ever registered in this process to their registration, so a
+         * snapshot can create the pools of types a fresh world has not seen yet.
+         */
+        static void AddTypeRegistration(const char *type_name, ComponentTypeId type_id, TypeRegistration registration);
+
+        /**
+         * @return The registration of the type with this name, or nullptr if the name is unknown or not unique
+         */
+        static TypeRegistration FindTypeRegistration(const std::string &type_name);
+
+        static std::unordered_map<std::string, TypeRegistryEntry> &TypeRegistry() {
+            static std::unordered_map<std::string, TypeRegistryEntry> registry;
+            return registry;
+        }
+
+        struct ReflectedTypeTable {
+            std::vector<ComponentTypeInfo> types;
+            std::size_t capacity = 0;
+        };
+
+        static ReflectedTypeTable &ReflectedTypes() {
+            static ReflectedTypeTable table;
+            return table;
+        }
+
+        static std::mutex &TypeRegistryMutex() {
+            static std::mutex mutex;
+            return mutex;
+        }
         
         template<class T>
         static ComponentTypeId TypeId();
 
+        template<typename T>
+        static void RaiseAddRangeEvents(ComponentManager &cm, ComponentEventBus &event_bus,
+                                        std::span<const EntityId> entities);
+
+        /**
+         * Move one component per entity into the archetype storage, skipping entities that already own one.
+         */
+        template<typename T>
+        static void EmplaceArchetypeRange(ComponentManager &cm, std::span<const EntityId> entities, T *components,
+                                          ComponentEventBus *event_bus);
+
 
         std::vector<std::unique_ptr<IComponentPool>> m_pools;
+        /**
+         * Set if the components are stored in archetypes instead of the pools.
+         */
+        std::unique_ptr<ArchetypeStorage> m_archetypes;
+        /**
+         * Scratch buffer of AddRangesById(), kept to not allocate per batch.
+         */
+        std::vector<ArchetypeComponentRange> m_archetype_ranges;
         std::unordered_map<ComponentTypeId, ComponentMeta> m_component_meta;
+        /**
+         * Read by the pools through a pointer, so the manager must stay at its address.
+         */
+        ChangeTick m_change_tick = 1;
     };
 } // ECS
 
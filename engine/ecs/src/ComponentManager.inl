@@ -4,41 +4,78 @@
 #pragma once
 
 #include <ranges>
+#include <stdexcept>
 #include "../include/ComponentEventBus.hpp"
 
 namespace Engine::Ecs
 {
-    inline ComponentManager::ComponentManager() = default;
+    inline ComponentManager::ComponentManager(const ComponentStorage storage)
+    {
+        if (storage == ComponentStorage::Archetype)
+        {
+            m_archetypes = std::make_unique<ArchetypeStorage>();
+        }
+        ReflectedTypeTable reflected;
+        {
+            std::lock_guard lock(TypeRegistryMutex());
+            reflected = ReflectedTypes();
+        }
+        for (const auto& type : reflected.types)
+        {
+            // The pools of an archetype storage stay empty
+            ReservePool(type.register_type(*this), m_archetypes ? 0 : reflected.capacity);
+        }
+    }
 
     inline ComponentManager::~ComponentManager() = default;
 
     template <typename T>
     T& ComponentManager::AddComponent(EntityId entity, T component)
     {
+        if (m_archetypes)
+        {
+            return m_archetypes->AddComponent(entity, std::move(component));
+        }
         return GetPool<T>().Add(entity, std::move(component));
     }
 
     template <typename T>
     void ComponentManager::RemoveComponent(EntityId entity)
     {
+        if (m_archetypes)
+        {
+            return m_archetypes->RemoveComponent<T>(entity);
+        }
         return GetPool<T>().Remove(entity);
     }
 
     template <typename T>
     T* ComponentManager::GetComponent(EntityId entity)
     {
+        if (m_archetypes)
+        {
+            return m_archetypes->GetComponent<T>(entity);
+        }
         return GetPool<T>().Get(entity);
     }
 
     template <typename T>
     const T& ComponentManager::GetComponent(EntityId entity) const
     {
+        if (m_archetypes)
+        {
+            return *m_archetypes->GetComponent<T>(entity);
+        }
         return GetPool<T>().Get(entity);
     }
 
     template <typename T>
     bool ComponentManager::HasComponent(EntityId entity) const
     {
+        if (m_archetypes)
+        {
+            return m_archetypes->HasComponent<T>(entity);
+        }
         auto pool = GetPoolConst<T>();
         if (pool == nullptr)
         {
@@ -51,6 +88,7 @@ namespace Engine::Ecs
     template <typename T>
     std::vector<EntityId> ComponentManager::GetEntitiesWithComponent()
     {
+        RequirePools("GetEntitiesWithComponent");
         auto& pool = GetPool<T>();
         std::vector<EntityId> entities;
         entities.reserve(pool.Count());
@@ -61,6 +99,102 @@ namespace Engine::Ecs
         return entities;
     }
 
+    template <typename T>
+    ComponentView<T> ComponentManager::GetComponentView()
+    {
+        RequirePools("GetComponentView");
+        const auto pool = TryGetPool<T>();
+        if (pool == nullptr)
+        {
+            return ComponentView<T>();
+        }
+        return pool->GetView();
+    }
+
+    template <typename... Ts, typename... Ex>
+    EntityView<Exclude<Ex...>, Ts...> ComponentManager::GetEntityView(Exclude<Ex...>)
+    {
+        if (m_archetypes)
+        {
+            const auto& match = m_archetypes->Match(ArchetypeTypes<std::remove_const_t<Ts>...>{},
+                                                    ArchetypeTypes<std::remove_const_t<Ex>...>{});
+            return EntityView<Exclude<Ex...>, Ts...>(m_archetypes.get(), &match);
+        }
+        return EntityView<Exclude<Ex...>, Ts...>(
+            std::make_tuple(TryGetPool<std::remove_const_t<Ts>>()...),
+            std::make_tuple(GetPoolConst<std::remove_const_t<Ex>>()...)
+        );
+    }
+
+    template <typename... Ts, typename... Ex>
+    Query<Exclude<Ex...>, Ts...> ComponentManager::GetQuery(const QueryRegistry::Entry& entry, Exclude<Ex...>)
+    {
+        RequirePools("GetQuery");
+        (RegisterType<std::remove_const_t<Ts>>(), ...);
+        return Query<Exclude<Ex...>, Ts...>(&entry, std::make_tuple(&GetPool<std::remove_const_t<Ts>>()...));
+    }
+
+    template <typename T>
+    ChangedView<T> ComponentManager::GetAddedView(const ChangeTick since)
+    {
+        RequirePools("GetAddedView");
+        const auto pool = TryGetPool<T>();
+        if (pool == nullptr)
+        {
+            return ChangedView<T>();
+        }
+        return pool->GetAdded(since);
+    }
+
+    template <typename T>
+    ChangedView<T> ComponentManager::GetChangedView(const ChangeTick since)
+    {
+        RequirePools("GetChangedView");
+        const auto pool = TryGetPool<T>();
+        if (pool == nullptr)
+        {
+            return ChangedView<T>();
+        }
+        return pool->GetChanged(since);
+    }
+
+    template <typename T>
+    ChangeLogView ComponentManager::GetRemovedView(const ChangeTick since)
+    {
+        RequirePools("GetRemovedView");
+        const auto pool = TryGetPool<T>();
+        if (pool == nullptr)
+        {
+            return ChangeLogView();
+        }
+        return pool->GetRemoved(since);
+    }
+
+    template <typename T>
+    void ComponentManager::MarkChanged(const EntityId entity)
+    {
+        // Archetypes keep no change records
+        if (m_archetypes)
+        {
+            return;
+        }
+        if (const auto pool = TryGetPool<T>())
+        {
+            pool->MarkChanged(entity);
+        }
+    }
+
+    inline void ComponentManager::TrimChanges(const ChangeTick oldest_tick) const
+    {
+        for (const auto& pool : m_pools)
+        {
+            if (pool)
+            {
+                pool->TrimChanges(oldest_tick);
+            }
+        }
+    }
+
     template <typename T>
     ComponentTypeId ComponentManager::RegisterType()
     {
@@ -77,28 +211,50 @@ namespace Engine::Ecs
                                      [](ComponentManager& cm, EntityId entity, const void* p)
                                      {
                                          const T& val = *static_cast<const T*>(p);
-                                         cm.GetPool<T>().Add(entity, val);
+                                         cm.AddComponent<T>(entity, val);
+                                     },
+                                     [](ComponentManager& cm, EntityId entity, void* p) -> const void*
+                                     {
+                                         return &cm.AddComponent<T>(entity, std::move(*static_cast<T*>(p)));
+                                     },
+                                     [](ComponentManager& cm, std::span<const EntityId> entities, void* p,
+                                        ComponentEventBus* event_bus)
+                                     {
+                                         if (cm.m_archetypes)
+                                         {
+                                             EmplaceArchetypeRange<T>(cm, entities, static_cast<T*>(p), event_bus);
+                                             return;
+                                         }
+                                         auto& pool = cm.GetPool<T>();
+                                         const auto added = pool.AddRange(
+                                             entities, std::span<T>(static_cast<T*>(p), entities.size()));
+                                         // Entities that already owned the component got no new one, so no event
+                                         if (event_bus != nullptr)
+                                         {
+                                             RaiseAddRangeEvents<T>(cm, *event_bus, added);
+                                         }
                                      },
                                      [](ComponentManager& cm, EntityId entity, const void* p)
                                      {
                                          const T& val = *static_cast<const T*>(p);
-                                         auto* t = cm.GetPool<T>().Get(entity);
+                                         auto* t = cm.GetComponent<T>(entity);
                                          if (t)
                                          {
                                              *t = val;
+                                             cm.MarkChanged<T>(entity);
                                          }
                                          else
                                          {
-                                             cm.GetPool<T>().Add(entity, val);
+                                             cm.AddComponent<T>(entity, val);
                                          }
                                      },
                                      [](ComponentManager& cm, EntityId entity)
                                      {
-                                         cm.GetPool<T>().Remove(entity);
+                                         cm.RemoveComponent<T>(entity);
                                      },
                                      [](ComponentManager& cm, EntityId entity)
                                      {
-                                         return cm.GetPool<T>().Contains(entity);
+                                         return cm.HasComponent<T>(entity);
                                      },
                                      [](ComponentEventBus& event_bus, EntityId entity, const void* data)
                                      {
@@ -107,8 +263,59 @@ namespace Engine::Ecs
                                      [](ComponentEventBus& event_bus, EntityId entity)
                                      {
                                          event_bus.RaiseRemoveComponentEvent<T>(entity);
-                                     }
+                                     },
+                                     typeid(T).name()
                                  });
+
+        if constexpr (SerializableComponent<T>)
+        {
+            auto& meta = m_component_meta.at(id);
+            meta.serialize = [](const ComponentManager& cm, SnapshotWriter& writer)
+            {
+                cm.GetPoolConst<T>()->Serialize(writer);
+            };
+            meta.deserialize = [](ComponentManager& cm, SnapshotReader& reader) -> std::unique_ptr<IComponentPool>
+            {
+                auto staged = std::make_unique<TypedComponentPool<T>>(TypeId<T>(), &cm.m_change_tick);
+                staged->Deserialize(reader);
+                return staged;
+            };
+            meta.restore = [](ComponentManager& cm, IComponentPool& staged)
+            {
+                cm.GetPool<T>().Restore(static_cast<TypedComponentPool<T>&>(staged));
+            };
+        }
+        auto& meta = m_component_meta.at(id);
+        if constexpr (ReflectedComponent<T>)
+        {
+            meta.display_name = ComponentReflection<T>::name;
+        }
+        else
+        {
+            meta.display_name = typeid(T).name();
+        }
+        meta.raise_add_events = [](ComponentManager& cm, ComponentEventBus& event_bus)
+        {
+            RaiseAddRangeEvents<T>(cm, event_bus, cm.GetPool<T>().GetEntities());
+        };
+        meta.fill_range = [](ComponentManager& cm, const std::span<const EntityId> entities, const void* p)
+        {
+            const T& val = *static_cast<const T*>(p);
+            if (cm.m_archetypes)
+            {
+                // A shared value is only copied from
+                const ArchetypeComponentRange range{cm.m_archetypes->RegisterType<T>(), const_cast<T*>(&val), false};
+                cm.m_archetypes->AddComponents(entities, std::span(&range, 1));
+                return;
+            }
+            cm.GetPool<T>().FillRange(entities, val);
+        };
+        meta.raise_add_range_events = &RaiseAddRangeEvents<T>;
+        meta.register_archetype_type = [](ComponentManager& cm)
+        {
+            return cm.m_archetypes->RegisterType<T>();
+        };
+        AddTypeRegistration(typeid(T).name(), id, [](ComponentManager& cm) { return cm.RegisterType<T>(); });
         return id;
     }
 
@@ -135,6 +342,101 @@ namespace Engine::Ecs
         it->second.add(*this, entity, bytes);
     }
 
+    inline const void* ComponentManager::EmplaceById(const EntityId entity, const ComponentTypeId component_type,
+                                                     void* bytes)
+    {
+        const auto it = m_component_meta.find(component_type);
+        if (it == m_component_meta.end())
+        {
+            return nullptr;
+        }
+        return it->second.emplace(*this, entity, bytes);
+    }
+
+    inline void ComponentManager::EmplaceRangeById(const std::span<const EntityId> entities,
+                                                   const ComponentTypeId component_type, void* bytes,
+                                                   ComponentEventBus* event_bus)
+    {
+        const auto it = m_component_meta.find(component_type);
+        if (it == m_component_meta.end())
+        {
+            return;
+        }
+        it->second.emplace_range(*this, entities, bytes, event_bus);
+    }
+
+    inline void ComponentManager::FillRangeById(const std::span<const EntityId> entities,
+                                                const ComponentTypeId component_type, const void* bytes)
+    {
+        const auto it = m_component_meta.find(component_type);
+        if (it == m_component_meta.end())
+        {
+            return;
+        }
+        it->second.fill_range(*this, entities, bytes);
+    }
+
+    inline void ComponentManager::AddRangesById(const std::span<const EntityId> entities,
+                                                const std::span<const ComponentRange> components)
+    {
+        if (!m_archetypes)
+        {
+            for (const auto& [id, values, per_instance] : components)
+            {
+                if (per_instance)
+                {
+                    EmplaceRangeById(entities, id, values, nullptr);
+                }
+                else
+                {
+                    FillRangeById(entities, id, values);
+                }
+            }
+            return;
+        }
+
+        m_archetype_ranges.clear();
+        for (const auto& [id, values, per_instance] : components)
+        {
+            if (const auto it = m_component_meta.find(id); it != m_component_meta.end())
+            {
+                m_archetype_ranges.push_back({it->second.register_archetype_type(*this), values, per_instance});
+            }
+        }
+        m_archetypes->AddComponents(entities, m_archetype_ranges);
+    }
+
+    inline void ComponentManager::RaiseAddEventsById(const std::span<const EntityId> entities,
+                                                     const ComponentTypeId component_type,
+                                                     ComponentEventBus& event_bus)
+    {
+        const auto it = m_component_meta.find(component_type);
+        if (it == m_component_meta.end())
+        {
+            return;
+        }
+        it->second.raise_add_range_events(*this, event_bus, entities);
+    }
+
+    template <typename T>
+    void ComponentManager::RaiseAddRangeEvents(ComponentManager& cm, ComponentEventBus& event_bus,
+                                               const std::span<const EntityId> entities)
+    {
+        if (cm.m_archetypes)
+        {
+            event_bus.RaiseAddComponentsEvent<T>(entities, [&cm](const EntityId entity) -> const T&
+            {
+                return *cm.m_archetypes->GetComponent<T>(entity);
+            });
+            return;
+        }
+        auto& pool = cm.GetPool<T>();
+        event_bus.RaiseAddComponentsEvent<T>(entities, [&pool](const EntityId entity) -> const T&
+        {
+            return *pool.Get(entity);
+        });
+    }
+
     inline void ComponentManager::SetById(const EntityId entity, const ComponentTypeId component_type,
                                           const void* bytes)
     {
@@ -169,6 +471,11 @@ namespace Engine::Ecs
 
     inline void ComponentManager::OnDestroyEntity(const EntityId entity) const
     {
+        if (m_archetypes)
+        {
+            m_archetypes->OnDestroyEntity(entity);
+            return;
+        }
         for (const auto& component_pool : m_pools)
         {
             if (!component_pool) continue;
@@ -194,7 +501,7 @@ namespace Engine::Ecs
         }
         if (!m_pools[id])
         {
-            m_pools[id] = std::make_unique<TypedComponentPool<T>>(id);
+            m_pools[id] = std::make_unique<TypedComponentPool<T>>(id, &m_change_tick);
         }
     }
 
@@ -224,26 +531,254 @@ namespace Engine::Ecs
     }
 
 
-    inline std::vector<ComponentMeta> ComponentManager::GetAllComponentsOfEntity(EntityId entity) const
+    template <typename T>
+    TypedComponentPool<T>* ComponentManager::TryGetPool()
     {
-        std::vector<ComponentMeta> components;
-        for (const auto& pool : m_pools)
+        const auto component_id = TypeId<T>();
+        if (m_pools.size() <= component_id)
         {
-            if (!pool) continue;
-            if (!pool->Contains(entity))
+            return nullptr;
+        }
+        return static_cast<TypedComponentPool<T>*>(m_pools[component_id].get());
+    }
+
+    inline void ComponentManager::RemoveBySignature(const EntityId entity, const ComponentSignature& signature,
+                                                    ComponentEventBus& event_bus) const
+    {
+        signature.ForEach([&](const ComponentTypeId component_type)
+        {
+            if (const auto it = m_component_meta.find(component_type);
+                it != m_component_meta.end() && it->second.on_remove_event)
+            {
+                it->second.on_remove_event(event_bus, entity);
+            }
+        });
+        if (m_archetypes)
+        {
+            m_archetypes->OnDestroyEntity(entity);
+            return;
+        }
+        signature.ForEach([&](const ComponentTypeId component_type)
+        {
+            if (component_type < m_pools.size() && m_pools[component_type])
+            {
+                m_pools[component_type]->Remove(entity);
+            }
+        });
+    }
+
+    inline void ComponentManager::RaiseRemoveEvents(ComponentEventBus& event_bus) const
+    {
+        std::vector<EntityId> entities;
+        for (const auto& [id, meta] : m_component_meta)
+        {
+            if (!meta.on_remove_event || id >= m_pools.size() || !m_pools[id])
             {
                 continue;
             }
-            auto component_id = pool->GetComponentTypeId();
-            components.push_back(m_component_meta.at(component_id));
+            const auto pool_entities = m_pools[id]->GetEntities();
+            entities.assign(pool_entities.begin(), pool_entities.end());
+            for (const auto entity : entities)
+            {
+                meta.on_remove_event(event_bus, entity);
+            }
+        }
+    }
+
+    inline void ComponentManager::Clear(ComponentEventBus* event_bus) const
+    {
+        RequirePools("Clear");
+        if (event_bus != nullptr)
+        {
+            RaiseRemoveEvents(*event_bus);
+        }
+        for (const auto& pool : m_pools)
+        {
+            if (pool)
+            {
+                pool->Clear();
+            }
         }
-        return components;
+    }
+
+    inline void ComponentManager::Reset() const
+    {
+        if (m_archetypes)
+        {
+            m_archetypes->Clear();
+        }
+        for (const auto& pool : m_pools)
+        {
+            if (pool)
+            {
+                pool->Reset();
+            }
+        }
+    }
+
+    inline void ComponentManager::Serialize(SnapshotWriter& writer) const
+    {
+        RequirePools("Serialize");
+        std::vector<ComponentTypeId> stored_types;
+        for (ComponentTypeId id = 0; id < m_pools.size(); ++id)
+        {
+            if (m_pools[id] && !m_pools[id]->GetEntities().empty())
+            {
+                stored_types.push_back(id);
+            }
+        }
+
+        writer.Write<uint64_t>(stored_types.size());
+        for (const auto id : stored_types)
+        {
+            const auto& meta = m_component_meta.at(id);
+            if (meta.serialize == nullptr)
+            {
+                throw std::runtime_error(std::string("ComponentManager::Serialize: Component type ") + meta.type_name +
+                                         " can not be serialized, specialize ComponentSerializer for it");
+            }
+            if (FindTypeRegistration(meta.type_name) == nullptr)
+            {
+                throw std::runtime_error(std::string("ComponentManager::Serialize: Component type name ") +
+                                         meta.type_name + " is used by several types and can not be restored");
+            }
+            writer.WriteString(meta.type_name);
+            meta.serialize(*this, writer);
+        }
+    }
+
+    inline std::vector<std::unique_ptr<IComponentPool>> ComponentManager::Deserialize(SnapshotReader& reader)
+    {
+        RequirePools("Deserialize");
+        std::vector<std::unique_ptr<IComponentPool>> staged;
+        const auto type_count = reader.Read<uint64_t>();
+        for (uint64_t i = 0; i < type_count; ++i)
+        {
+            const auto type_name = reader.ReadString();
+            const auto registration = FindTypeRegistration(type_name);
+            if (registration == nullptr)
+            {
+                throw std::runtime_error("ComponentManager::Deserialize: Unknown or ambiguous component type " + type_name);
+            }
+            const auto id = registration(*this);
+            staged.push_back(m_component_meta.at(id).deserialize(*this, reader));
+        }
+        return staged;
+    }
+
+    inline void ComponentManager::Restore(const std::span<const std::unique_ptr<IComponentPool>> staged)
+    {
+        Clear(nullptr);
+        for (const auto& pool : staged)
+        {
+            const auto id = pool->GetComponentTypeId();
+            m_component_meta.at(id).restore(*this, *pool);
+        }
+    }
+
+    inline void ComponentManager::RaiseAddEvents(ComponentEventBus& event_bus)
+    {
+        for (const auto& meta : m_component_meta | std::views::values)
+        {
+            meta.raise_add_events(*this, event_bus);
+        }
+    }
+
+    template <class Fn>
+    void ComponentManager::ForEachPool(Fn&& fn) const
+    {
+        for (ComponentTypeId id = 0; id < m_pools.size(); ++id)
+        {
+            if (m_pools[id])
+            {
+                fn(id, *m_pools[id]);
+            }
+        }
+    }
+
+    inline void ComponentManager::ReservePool(const ComponentTypeId component_type, const std::size_t capacity) const
+    {
+        if (component_type < m_pools.size() && m_pools[component_type])
+        {
+            m_pools[component_type]->Reserve(capacity);
+        }
+    }
+
+    inline void ComponentManager::RegisterReflectedTypes(const std::span<const ComponentTypeInfo> types,
+                                                         const std::size_t capacity)
+    {
+        {
+            std::lock_guard lock(TypeRegistryMutex());
+            ReflectedTypes() = ReflectedTypeTable{std::vector(types.begin(), types.end()), 0};
+        }
+        // Registering the types in table order hands out their type ids
+        ComponentManager type_id_assignment;
+        std::lock_guard lock(TypeRegistryMutex());
+        ReflectedTypes().capacity = capacity;
+    }
+
+    inline void ComponentManager::AddTypeRegistration(const char* type_name, const ComponentTypeId type_id,
+                                                      const TypeRegistration registration)
+    {
+        std::lock_guard lock(TypeRegistryMutex());
+        const auto [it, inserted] = TypeRegistry().try_emplace(type_name, TypeRegistryEntry{type_id, registration});
+        if (!inserted && it->second.type_id != type_id)
+        {
+            it->second.registration = nullptr;
+        }
+    }
+
+    inline ComponentManager::TypeRegistration ComponentManager::FindTypeRegistration(const std::string& type_name)
+    {
+        std::lock_guard lock(TypeRegistryMutex());
+        const auto it = TypeRegistry().find(type_name);
+        return it != TypeRegistry().end() ? it->second.registration : nullptr;
+    }
+
+    template <typename... Ts>
+    const ComponentSignature& ComponentManager::GetSignature()
+    {
+        static const ComponentSignature signature = []
+        {
+            ComponentSignature result;
+            (result.Set(TypeId<Ts>()), ...);
+            return result;
+        }();
+        return signature;
     }
 
     inline ComponentTypeId ComponentManager::NextComponentTypeId()
     {
-        static ComponentTypeId next = 0;
-        return next++;
+        // Systems of a parallel stage may hit the first use of a component type at the same time.
+        static std::atomic<ComponentTypeId> next = 0;
+        const auto id = next.fetch_add(1);
+        if (id >= MAX_COMPONENT_TYPES)
+        {
+            throw std::length_error("ComponentManager: More component types than MAX_COMPONENT_TYPES are used");
+        }
+        return id;
+    }
+
+    inline void ComponentManager::RequirePools(const char* operation) const
+    {
+        if (m_archetypes)
+        {
+            throw std::logic_error(std::string("ComponentManager::") + operation +
+                                   ": Not supported by the archetype storage, use ComponentStorage::SparseSet");
+        }
+    }
+
+    template <typename T>
+    void ComponentManager::EmplaceArchetypeRange(ComponentManager& cm, const std::span<const EntityId> entities,
+                                                 T* components, ComponentEventBus* event_bus)
+    {
+        const ArchetypeComponentRange range{cm.m_archetypes->RegisterType<T>(), components, true};
+        // Entities that already own the component keep it, like in the pools
+        const auto added = cm.m_archetypes->AddComponents(entities, std::span(&range, 1));
+        if (event_bus != nullptr)
+        {
+            RaiseAddRangeEvents<T>(cm, *event_bus, added);
+        }
     }
 
     template <class T>
@@ -1,8 +1,16 @@
 #pragma once
 #include <vector>
+#include <limits>
 #include <memory>
+#include <span>
 #include <stdexcept>
+#include "ChangedView.hpp"
+#include "../include/ComponentSerializer.hpp"
+#include "ComponentView.hpp"
 #include "EntityManager.hpp"
+#include "JobSystem.hpp"
+#include "PagedSparseArray.hpp"
+#include "ParallelIteration.hpp"
 
 
 namespace Engine::Ecs {
@@ -12,41 +20,128 @@ namespace Engine::Ecs {
     // template<class T>
     // concept Component = std::is_trivially_destructible_v<T>;
 
+    /**
+     * Memory report of a single component pool.
+     */
+    struct PoolMemoryUsage {
+        std::size_t component_count = 0;
+        std::size_t component_capacity = 0;
+        /**
+         * Bytes reserved for the components and their entities.
+         */
+        std::size_t dense_bytes = 0;
+        std::size_t sparse_pages = 0;
+        /**
+         * Bytes of the allocated sparse pages and the page table.
+         */
+        std::size_t sparse_bytes = 0;
+        std::size_t change_log_bytes = 0;
+    };
+
     class IComponentPool {
     public:
         virtual ~IComponentPool() = default;
 
         virtual void Remove(EntityId entity) = 0;
 
+        /**
+         * Remove all components, keeping the allocated memory.
+         */
+        virtual void Clear() = 0;
+
+        /**
+         * Remove all components and drop all change records at once, keeping the allocated memory. Nothing is
+         * recorded as removed, the world raises a single reset event instead.
+         */
+        virtual void Reset() = 0;
+
+        /**
+         * Grow the dense arrays, so the pool holds at least capacity components without reallocating.
+         */
+        virtual void Reserve(std::size_t capacity) = 0;
+
+        [[nodiscard]] virtual std::span<const EntityId> GetEntities() const = 0;
+
         [[nodiscard]] virtual bool Contains(EntityId entity) const = 0;
 
         [[nodiscard]] virtual std::size_t GetComponentTypeId() const = 0;
+
+        [[nodiscard]] virtual PoolMemoryUsage GetMemoryUsage() const = 0;
+
+        virtual void MarkChanged(EntityId entity) = 0;
+
+        virtual void TrimChanges(ChangeTick oldest_tick) = 0;
     };
 
     template<class T>
     class TypedComponentPool final : public IComponentPool {
     public:
-        explicit TypedComponentPool(std::size_t component_type_id) {
-            m_pool = std::make_unique<ComponentPool<T>>(component_type_id);
+        explicit TypedComponentPool(std::size_t component_type_id, const ChangeTick *change_tick = nullptr) {
+            m_pool = std::make_unique<ComponentPool<T>>(component_type_id, change_tick);
         }
 
-        T &Add(EntityId entity, T value) { return m_pool->Add(entity, value); }
+        T &Add(EntityId entity, T value) { return m_pool->Add(entity, std::move(value)); }
+
+        std::span<const EntityId> AddRange(std::span<const EntityId> entities, std::span<T> values) {
+            return m_pool->AddRange(entities, values);
+        }
+
+        std::span<const EntityId> FillRange(std::span<const EntityId> entities, const T &value) {
+            return m_pool->FillRange(entities, value);
+        }
 
         void Remove(EntityId entity) override { return m_pool->Remove(entity); };
 
+        void Clear() override { m_pool->Clear(); }
+
+        void Reset() override { m_pool->Reset(); }
+
+        void Reserve(std::size_t capacity) override { m_pool->Reserve(capacity); }
+
         [[nodiscard]] std::size_t GetComponentTypeId() const override { return m_pool->GetComponentTypeId(); }
 
         [[nodiscard]] bool Contains(EntityId entity) const override { return m_pool->Contains(entity); };
 
+        void MarkChanged(EntityId entity) override { m_pool->MarkChanged(entity); }
+
+        void TrimChanges(ChangeTick oldest_tick) override { m_pool->TrimChanges(oldest_tick); }
+
+        [[nodiscard]] PoolMemoryUsage GetMemoryUsage() const override { return m_pool->GetMemoryUsage(); }
+
+        [[nodiscard]] ChangedView<T> GetAdded(ChangeTick since) { return m_pool->GetAdded(since); }
+
+        [[nodiscard]] ChangedView<T> GetChanged(ChangeTick since) { return m_pool->GetChanged(since); }
+
+        [[nodiscard]] ChangeLogView GetRemoved(ChangeTick since) const { return m_pool->GetRemoved(since); }
+
         T *Get(EntityId entity) { return m_pool->Get(entity); };
 
         const T &Get(EntityId entity) const { return m_pool->Get(entity); };
 
+        T &GetUnchecked(EntityId entity) { return m_pool->GetUnchecked(entity); }
+
         template<class Fn>
         void ForEach(Fn &&fn) { m_pool->ForEach(std::forward<Fn>(fn)); };
 
+        template<class Fn>
+        void ParallelForEach(Jobs::JobSystem &job_system, Fn &&fn, std::size_t grain_size = 0) {
+            m_pool->ParallelForEach(job_system, std::forward<Fn>(fn), grain_size);
+        }
+
         [[nodiscard]] std::size_t Count() const { return m_pool->Count(); };
 
+        [[nodiscard]] ComponentView<T> GetView() { return m_pool->GetView(); }
+
+        [[nodiscard]] std::span<const EntityId> GetEntities() const override { return m_pool->GetEntities(); }
+
+        void Serialize(SnapshotWriter &writer) const requires SerializableComponent<T> { m_pool->Serialize(writer); }
+
+        void Deserialize(SnapshotReader &reader) requires SerializableComponent<T> { m_pool->Deserialize(reader); }
+
+        void Restore(TypedComponentPool &staged) { m_pool->Restore(*staged.m_pool); }
+
+        [[nodiscard]] const IterationGuard *GetIterationGuard() const { return m_pool->GetIterationGuard(); }
+
     private:
         std::unique_ptr<ComponentPool<T>> m_pool;
     };
@@ -54,14 +149,73 @@ namespace Engine::Ecs {
     template<class T>
     class ComponentPool {
     public:
-        explicit ComponentPool(std::size_t component_type_id);
+        /**
+         * @param component_type_id The type id of the components in this pool
+         * @param change_tick The current change tick of the world, used to stamp changes. If null, every change is
+         * stamped with tick 1.
+         */
+        explicit ComponentPool(std::size_t component_type_id, const ChangeTick *change_tick = nullptr);
 
         ~ComponentPool();
 
         T &Add(EntityId entity, T value);
 
+        /**
+         * Move one component per entity into the pool. The dense and sparse arrays grow once for the whole range.
+         * Entities that already own a component of this type keep their current component.
+         * @param entities The entities to add the components to
+         * @param values The components to move from, one per entity
+         * @return The entities that got a component, valid until the pool changes again
+         */
+        std::span<const EntityId> AddRange(std::span<const EntityId> entities, std::span<T> values);
+
+        /**
+         * Add a copy of the same component to every entity, growing the dense and sparse arrays once for the range.
+         * Entities that already own a component of this type keep their current component.
+         * @param entities The entities to add the component to
+         * @param value The component to copy
+         * @return The entities that got a component, valid until the pool changes again
+         */
+        std::span<const EntityId> FillRange(std::span<const EntityId> entities, const T &value);
+
         void Remove(EntityId entity);
 
+        /**
+         * Remove all components, keeping the allocated memory. Every removed entity is recorded as removed.
+         */
+        void Clear();
+
+        /**
+         * Remove all components and drop all change records, keeping the allocated memory. Unlike Clear(), the
+         * entities are not visited one by one and nothing is recorded as removed.
+         */
+        void Reset();
+
+        /**
+         * Grow the dense arrays, so the pool holds at least capacity components without reallocating.
+         */
+        void Reserve(std::size_t capacity);
+
+        /**
+         * Write the entities and components of this pool. Trivially copyable components are written as one block.
+         * @param writer The snapshot to write to
+         */
+        void Serialize(SnapshotWriter &writer) const requires SerializableComponent<T>;
+
+        /**
+         * Replace the content of this pool with the entities and components written by Serialize().
+         * Every restored component is recorded as added.
+         * @param reader The snapshot to read from
+         */
+        void Deserialize(SnapshotReader &reader) requires SerializableComponent<T>;
+
+        /**
+         * Replace the content of this pool with the components of a pool decoded by Deserialize(), keeping the
+         * allocated memory. The current components are recorded as removed and the restored ones as added.
+         * @param staged The decoded pool, its components are moved out
+         */
+        void Restore(ComponentPool &staged);
+
         [[nodiscard]] std::size_t GetComponentTypeId() const { return m_component_type_id; }
 
         [[nodiscard]] bool Contains(EntityId entity) const;
@@ -70,17 +224,109 @@ namespace Engine::Ecs {
 
         const T &Get(EntityId entity) const;
 
+        /**
+         * Get the component of an entity without checking if it exists.
+         * Only call this after Contains() returned true for the entity.
+         * @param entity The entity owning the component
+         * @return The component of the entity
+         */
+        T &GetUnchecked(EntityId entity);
+
         template<class Fn>
         void ForEach(Fn &&fn);
 
+        /**
+         * Call fn(entity, component) for every component, split into cache line aligned chunks that run on the job
+         * system. Blocks until all chunks are processed. Adding or removing components while the iteration runs is
+         * asserted against in debug builds.
+         * @param job_system The job system executing the chunks
+         * @param fn The function to call per component, must only write to the component it is called with
+         * @param grain_size The minimum number of components per chunk, 0 picks a size based on the thread count
+         */
+        template<class Fn>
+        void ParallelForEach(Jobs::JobSystem &job_system, Fn &&fn, std::size_t grain_size = 0);
+
         [[nodiscard]] std::size_t Count() const;
 
+        /**
+         * Get a non-allocating view over the dense component and entity arrays of this pool.
+         * @return A view that is valid until the next structural change of this pool.
+         */
+        [[nodiscard]] ComponentView<T> GetView();
+
+        /**
+         * Get the entities owning a component of this pool in dense order.
+         * @return A span that is valid until the next structural change of this pool.
+         */
+        [[nodiscard]] std::span<const EntityId> GetEntities() const;
+
+        [[nodiscard]] const IterationGuard *GetIterationGuard() const { return &m_iteration_guard; }
+
+        /**
+         * Record a write to the component of an entity. Adding a component records it as added and changed,
+         * removing records it as removed. Writes through views and pointers have to be recorded with this function.
+         * @param entity The entity whose component changed, ignored if it has no component in this pool
+         */
+        void MarkChanged(EntityId entity);
+
+        /**
+         * Drop all change records older than the given tick.
+         * @param oldest_tick The oldest tick to keep
+         */
+        void TrimChanges(ChangeTick oldest_tick);
+
+        /**
+         * @param since The tick the caller last looked at the changes
+         * @return A view over the components added after the tick
+         */
+        [[nodiscard]] ChangedView<T> GetAdded(ChangeTick since);
+
+        /**
+         * @param since The tick the caller last looked at the changes
+         * @return A view over the components added or changed after the tick
+         */
+        [[nodiscard]] ChangedView<T> GetChanged(ChangeTick since);
+
+        /**
+         * @param since The tick the caller last looked at the changes
+         * @return A view over the entities whose component was removed after the tick
+         */
+        [[nodiscard]] ChangeLogView GetRemoved(ChangeTick since) const;
+
+        /**
+         * @return The memory reserved by the dense arrays, the sparse pages and the change logs of this pool
+         */
+        [[nodiscard]] PoolMemoryUsage GetMemoryUsage() const;
+
     private:
-        const uint64_t m_none;
-        std::vector<T> m_denseComponents;
+        using DenseIndex = uint32_t;
+        static constexpr DenseIndex NONE = std::numeric_limits<DenseIndex>::max();
+
+        std::vector<T, CacheLineAllocator<T>> m_denseComponents;
         std::vector<EntityId> m_denseEntities;
-        std::vector<uint64_t> m_sparseToDense;
+        /**
+         * Entity index to dense index. Pages are allocated on demand, so rare component types only pay for the
+         * index ranges their entities live in.
+         */
+        PagedSparseArray<DenseIndex, NONE> m_sparseToDense;
         std::size_t m_component_type_id;
+        IterationGuard m_iteration_guard;
+        const ChangeTick *m_change_tick;
+        ChangeLog m_added;
+        ChangeLog m_changed;
+        ChangeLog m_removed;
+
+        [[nodiscard]] ChangeTick CurrentTick() const { return m_change_tick != nullptr ? *m_change_tick : 1; }
+
+        void RecordAdded(EntityId entity);
+
+        /**
+         * Shared by AddRange and FillRange, value_at(i) yields the component of the i-th entity.
+         */
+        template<class ValueAt>
+        std::span<const EntityId> AddRangeWith(std::span<const EntityId> entities, ValueAt &&value_at);
+
+        [[nodiscard]] DenseIndex NextDenseIndex() const;
     };
 } // namespace
 #include "ComponentPool.inl"
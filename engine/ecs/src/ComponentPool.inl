@@ -1,13 +1,15 @@
 #pragma once
 
 #include "ComponentPool.hpp"
+#include <algorithm>
+#include <iterator>
 #include <limits>
 
 namespace Engine::Ecs {
     template<class T>
     ComponentPool<
-        T>::ComponentPool(const std::size_t component_type_id) : m_none(std::numeric_limits<uint64_t>::max()),
-                                                                     m_sparseToDense(1, m_none) {
+        T>::ComponentPool(const std::size_t component_type_id,
+                          const ChangeTick *change_tick) : m_change_tick(change_tick) {
         m_component_type_id = component_type_id;
     }
 
@@ -19,47 +21,232 @@ namespace Engine::Ecs {
         if (entity == INVALID_ENTITY_ID) {
             throw std::invalid_argument("Cannot add component with invalid EntityId");
         }
-        const uint64_t idx = GetEntityIndex(entity);
-        if (idx >= m_sparseToDense.size()) {
-            m_sparseToDense.resize(idx + 1, m_none);
-        }
-
-        if (Contains(entity)) {
-            return m_denseComponents[m_sparseToDense[idx]];
+        m_iteration_guard.AssertNotIterating();
+        auto& dense_index = m_sparseToDense.GetOrCreate(GetEntityIndex(entity));
+        if (dense_index != NONE) {
+            return m_denseComponents[dense_index];
         }
 
-        const auto componentIndex = static_cast<uint64_t>(m_denseComponents.size());
+        const auto componentIndex = NextDenseIndex();
         m_denseComponents.emplace_back(std::move(value));
         m_denseEntities.push_back(entity);
-        m_sparseToDense[idx] = componentIndex;
+        dense_index = componentIndex;
+        RecordAdded(entity);
         return m_denseComponents.back();
     }
 
+    template<class T>
+    std::span<const EntityId> ComponentPool<T>::AddRange(const std::span<const EntityId> entities,
+                                                         const std::span<T> values) {
+        if (entities.size() != values.size()) {
+            throw std::invalid_argument("Cannot add components, the number of entities and components differs");
+        }
+        return AddRangeWith(entities, [values](const std::size_t i) -> T&& { return std::move(values[i]); });
+    }
+
+    template<class T>
+    std::span<const EntityId> ComponentPool<T>::FillRange(const std::span<const EntityId> entities, const T &value) {
+        return AddRangeWith(entities, [&value](std::size_t) -> const T& { return value; });
+    }
+
+    template<class T>
+    template<class ValueAt>
+    std::span<const EntityId> ComponentPool<T>::AddRangeWith(const std::span<const EntityId> entities,
+                                                             ValueAt &&value_at) {
+        m_iteration_guard.AssertNotIterating();
+
+        for (const auto entity: entities) {
+            if (entity == INVALID_ENTITY_ID) {
+                throw std::invalid_argument("Cannot add component with invalid EntityId");
+            }
+        }
+        m_denseComponents.reserve(m_denseComponents.size() + entities.size());
+        m_denseEntities.reserve(m_denseEntities.size() + entities.size());
+
+        // New components are appended, so the added entities end up at the back of the dense array
+        const auto first_added = m_denseEntities.size();
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            auto& dense_index = m_sparseToDense.GetOrCreate(GetEntityIndex(entities[i]));
+            if (dense_index != NONE) {
+                continue;
+            }
+            dense_index = NextDenseIndex();
+            m_denseComponents.emplace_back(value_at(i));
+            m_denseEntities.push_back(entities[i]);
+            RecordAdded(entities[i]);
+        }
+        return std::span<const EntityId>(m_denseEntities).subspan(first_added);
+    }
+
     template<class T>
     void ComponentPool<T>::Remove(EntityId entity) {
         if (!Contains(entity)) {
             return;
         }
+        m_iteration_guard.AssertNotIterating();
         const uint64_t idx = GetEntityIndex(entity);
-        uint64_t componentIndex = m_sparseToDense[idx];
-        uint64_t lastComponentIndex = m_denseComponents.size() - 1;
+        const DenseIndex componentIndex = m_sparseToDense.GetUnchecked(idx);
+        const auto lastComponentIndex = static_cast<DenseIndex>(m_denseComponents.size() - 1);
 
         if (componentIndex != lastComponentIndex) {
             std::swap(m_denseComponents[componentIndex], m_denseComponents[lastComponentIndex]);
             std::swap(m_denseEntities[componentIndex], m_denseEntities[lastComponentIndex]);
 
             const uint64_t swappedIndex = GetEntityIndex(m_denseEntities[componentIndex]);
-            m_sparseToDense[swappedIndex] = componentIndex;
+            m_sparseToDense.SetUnchecked(swappedIndex, componentIndex);
         }
         m_denseComponents.pop_back();
         m_denseEntities.pop_back();
-        m_sparseToDense[idx] = m_none;
+        m_sparseToDense.SetUnchecked(idx, NONE);
+        m_removed.Add(entity, CurrentTick());
+    }
+
+    template<class T>
+    void ComponentPool<T>::Clear() {
+        m_iteration_guard.AssertNotIterating();
+        const auto tick = CurrentTick();
+        for (const auto entity: m_denseEntities) {
+            m_sparseToDense.SetUnchecked(GetEntityIndex(entity), NONE);
+            m_removed.Add(entity, tick);
+        }
+        m_denseComponents.clear();
+        m_denseEntities.clear();
+    }
+
+    template<class T>
+    void ComponentPool<T>::Reset() {
+        m_iteration_guard.AssertNotIterating();
+        m_sparseToDense.Reset();
+        m_denseComponents.clear();
+        m_denseEntities.clear();
+        m_added.Reset();
+        m_changed.Reset();
+        m_removed.Reset();
+    }
+
+    template<class T>
+    void ComponentPool<T>::Reserve(const std::size_t capacity) {
+        m_denseComponents.reserve(capacity);
+        m_denseEntities.reserve(capacity);
+    }
+
+    template<class T>
+    void ComponentPool<T>::Serialize(SnapshotWriter &writer) const requires SerializableComponent<T> {
+        writer.WriteArray<EntityId>(m_denseEntities);
+        if constexpr (CustomSerializedComponent<T>) {
+            for (const auto &component: m_denseComponents) {
+                ComponentSerializer<T>::Write(writer, component);
+            }
+        } else {
+            writer.WriteBytes(m_denseComponents.data(), m_denseComponents.size() * sizeof(T));
+        }
+    }
+
+    template<class T>
+    void ComponentPool<T>::Deserialize(SnapshotReader &reader) requires SerializableComponent<T> {
+        Clear();
+        reader.ReadArray(m_denseEntities);
+        if (m_denseEntities.size() >= NONE) {
+            throw std::length_error("Component pool is full, dense indices are limited to 32 bit");
+        }
+
+        if constexpr (CustomSerializedComponent<T>) {
+            m_denseComponents.reserve(m_denseEntities.size());
+            for (std::size_t i = 0; i < m_denseEntities.size(); ++i) {
+                m_denseComponents.push_back(ComponentSerializer<T>::Read(reader));
+            }
+        } else {
+            m_denseComponents.resize(m_denseEntities.size());
+            reader.ReadBytes(m_denseComponents.data(), m_denseComponents.size() * sizeof(T));
+        }
+
+        for (std::size_t i = 0; i < m_denseEntities.size(); ++i) {
+            auto &dense_index = m_sparseToDense.GetOrCreate(GetEntityIndex(m_denseEntities[i]));
+            if (dense_index != NONE) {
+                throw std::runtime_error("Cannot restore component pool, an entity is stored twice");
+            }
+            dense_index = static_cast<DenseIndex>(i);
+            RecordAdded(m_denseEntities[i]);
+        }
+    }
+
+    template<class T>
+    void ComponentPool<T>::Restore(ComponentPool &staged) {
+        Clear();
+        m_denseEntities.assign(staged.m_denseEntities.begin(), staged.m_denseEntities.end());
+        m_denseComponents.assign(std::make_move_iterator(staged.m_denseComponents.begin()),
+                                 std::make_move_iterator(staged.m_denseComponents.end()));
+        // The staged pool already rejected entities stored twice
+        for (std::size_t i = 0; i < m_denseEntities.size(); ++i) {
+            m_sparseToDense.GetOrCreate(GetEntityIndex(m_denseEntities[i])) = static_cast<DenseIndex>(i);
+            RecordAdded(m_denseEntities[i]);
+        }
+    }
+
+    template<class T>
+    void ComponentPool<T>::MarkChanged(const EntityId entity) {
+        if (!Contains(entity)) {
+            return;
+        }
+        m_changed.Add(entity, CurrentTick());
+    }
+
+    template<class T>
+    void ComponentPool<T>::TrimChanges(const ChangeTick oldest_tick) {
+        m_added.Trim(oldest_tick);
+        m_changed.Trim(oldest_tick);
+        m_removed.Trim(oldest_tick);
+    }
+
+    template<class T>
+    ChangedView<T> ComponentPool<T>::GetAdded(const ChangeTick since) {
+        return ChangedView<T>(this, ChangeLogView(&m_added, since));
+    }
+
+    template<class T>
+    ChangedView<T> ComponentPool<T>::GetChanged(const ChangeTick since) {
+        return ChangedView<T>(this, ChangeLogView(&m_changed, since));
+    }
+
+    template<class T>
+    ChangeLogView ComponentPool<T>::GetRemoved(const ChangeTick since) const {
+        return ChangeLogView(&m_removed, since);
+    }
+
+    template<class T>
+    void ComponentPool<T>::RecordAdded(const EntityId entity) {
+        const auto idx = GetEntityIndex(entity);
+        const auto tick = CurrentTick();
+        m_added.Reserve(idx);
+        m_changed.Reserve(idx);
+        m_removed.Reserve(idx);
+        m_added.Add(entity, tick);
+        m_changed.Add(entity, tick);
+    }
+
+    template<class T>
+    PoolMemoryUsage ComponentPool<T>::GetMemoryUsage() const {
+        return PoolMemoryUsage{
+            .component_count = m_denseComponents.size(),
+            .component_capacity = m_denseComponents.capacity(),
+            .dense_bytes = m_denseComponents.capacity() * sizeof(T) + m_denseEntities.capacity() * sizeof(EntityId),
+            .sparse_pages = m_sparseToDense.GetAllocatedPageCount(),
+            .sparse_bytes = m_sparseToDense.GetMemoryUsage(),
+            .change_log_bytes = m_added.GetMemoryUsage() + m_changed.GetMemoryUsage() + m_removed.GetMemoryUsage(),
+        };
+    }
+
+    template<class T>
+    typename ComponentPool<T>::DenseIndex ComponentPool<T>::NextDenseIndex() const {
+        if (m_denseComponents.size() >= NONE) {
+            throw std::length_error("Component pool is full, dense indices are limited to 32 bit");
+        }
+        return static_cast<DenseIndex>(m_denseComponents.size());
     }
 
     template<class T>
     bool ComponentPool<T>::Contains(const EntityId entity) const {
-        const uint64_t idx = GetEntityIndex(entity);
-        return idx < m_sparseToDense.size() && m_sparseToDense[idx] != m_none;
+        return m_sparseToDense.Get(GetEntityIndex(entity)) != NONE;
     }
 
 
@@ -68,8 +255,7 @@ namespace Engine::Ecs {
         if (!Contains(entity)) {
             throw std::out_of_range("Component for entity does not exist");
         }
-        const uint64_t idx = GetEntityIndex(entity);
-        return &m_denseComponents[m_sparseToDense[idx]];
+        return &m_denseComponents[m_sparseToDense.GetUnchecked(GetEntityIndex(entity))];
     }
 
     template<class T>
@@ -77,8 +263,12 @@ namespace Engine::Ecs {
         if (!Contains(entity)) {
             throw std::out_of_range("Component for entity does not exist");
         }
-        const uint64_t idx = GetEntityIndex(entity);
-        return m_denseComponents[m_sparseToDense[idx]];
+        return m_denseComponents[m_sparseToDense.GetUnchecked(GetEntityIndex(entity))];
+    }
+
+    template<class T>
+    T &ComponentPool<T>::GetUnchecked(const EntityId entity) {
+        return m_denseComponents[m_sparseToDense.GetUnchecked(GetEntityIndex(entity))];
     }
 
     template<class T>
@@ -86,6 +276,17 @@ namespace Engine::Ecs {
         return m_denseComponents.size();
     }
 
+    template<class T>
+    ComponentView<T> ComponentPool<T>::GetView() {
+        return ComponentView<T>(m_denseComponents.data(), m_denseEntities.data(), m_denseComponents.size(),
+                                &m_iteration_guard);
+    }
+
+    template<class T>
+    std::span<const EntityId> ComponentPool<T>::GetEntities() const {
+        return m_denseEntities;
+    }
+
     template<class T>
     template<class Fn>
     void ComponentPool<T>::ForEach(Fn &&fn) {
@@ -93,4 +294,10 @@ namespace Engine::Ecs {
             fn(m_denseEntities[i], m_denseComponents[i]);
         }
     }
+
+    template<class T>
+    template<class Fn>
+    void ComponentPool<T>::ParallelForEach(Jobs::JobSystem &job_system, Fn &&fn, const std::size_t grain_size) {
+        GetView().ParallelForEach(job_system, std::forward<Fn>(fn), grain_size);
+    }
 } // namespace
@@ -0,0 +1,105 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine::Ecs {
+    /**
+     * The maximum number of component types the engine can register. Bounded so a signature fits a few words.
+     */
+    inline constexpr std::size_t MAX_COMPONENT_TYPES = 128;
+
+    /**
+     * @class ComponentSignature
+     * @brief Bitset of the component types an entity owns, indexed by component type id.
+     *
+     * Besides constant time checks for several types at once, the set bits can be visited directly, so work per
+     * entity scales with the components it owns instead of all registered types.
+     */
+    class ComponentSignature {
+    public:
+        void Set(const std::size_t component_type) {
+            m_words[component_type / WORD_BITS] |= Bit(component_type);
+        }
+
+        void Reset(const std::size_t component_type) {
+            m_words[component_type / WORD_BITS] &= ~Bit(component_type);
+        }
+
+        void Clear() { m_words = {}; }
+
+        [[nodiscard]] bool Test(const std::size_t component_type) const {
+            return (m_words[component_type / WORD_BITS] & Bit(component_type)) != 0;
+        }
+
+        /**
+         * @param other The required component types
+         * @return True if every type of other is set in this signature
+         */
+        [[nodiscard]] bool ContainsAll(const ComponentSignature& other) const {
+            for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+                if ((m_words[i] & other.m_words[i]) != other.m_words[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @param other The component types to check
+         * @return True if any type of other is set in this signature
+         */
+        [[nodiscard]] bool Intersects(const ComponentSignature& other) const {
+            for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+                if ((m_words[i] & other.m_words[i]) != 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] bool Empty() const {
+            for (const auto word: m_words) {
+                if (word != 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        [[nodiscard]] std::size_t Count() const {
+            std::size_t count = 0;
+            for (const auto word: m_words) {
+                count += std::popcount(word);
+            }
+            return count;
+        }
+
+        /**
+         * Call fn(component_type) for every set bit, in ascending type order.
+         */
+        template<class Fn>
+        void ForEach(Fn&& fn) const {
+            for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+                auto word = m_words[i];
+                while (word != 0) {
+                    fn(i * WORD_BITS + static_cast<std::size_t>(std::countr_zero(word)));
+                    word &= word - 1;
+                }
+            }
+        }
+
+        bool operator==(const ComponentSignature& other) const = default;
+
+    private:
+        static constexpr std::size_t WORD_BITS = 64;
+        static constexpr std::size_t WORD_COUNT = MAX_COMPONENT_TYPES / WORD_BITS;
+
+        std::array<uint64_t, WORD_COUNT> m_words{};
+
+        static uint64_t Bit(const std::size_t component_type) {
+            return uint64_t{1} << (component_type % WORD_BITS);
+        }
+    };
+} // namespace
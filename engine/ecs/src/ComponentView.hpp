@@ -0,0 +1,108 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "Entity.hpp"
+#include "JobSystem.hpp"
+#include "ParallelIteration.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * @class ComponentView
+     * @brief Non-owning, non-allocating view over the dense arrays of a single component pool.
+     *
+     * Iterating yields (component pointer, entity) pairs in dense order, so the cost of a pass depends only on
+     * the number of components of this type and not on the total number of entities in the world.
+     * Structural changes are deferred through the world's event buffer, therefore a view stays valid until the
+     * next call to World::ApplyEngineEvents().
+     */
+    template<class T>
+    class ComponentView {
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::pair<T*, EntityId>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            Iterator() = default;
+
+            Iterator(T* component, const EntityId* entity) : m_component(component), m_entity(entity) {
+            }
+
+            value_type operator*() const { return {m_component, *m_entity}; }
+
+            Iterator& operator++() {
+                ++m_component;
+                ++m_entity;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const { return m_entity == other.m_entity; }
+
+        private:
+            T* m_component = nullptr;
+            const EntityId* m_entity = nullptr;
+        };
+
+        ComponentView() = default;
+
+        ComponentView(T* components, const EntityId* entities, const std::size_t count,
+                      const IterationGuard* guard = nullptr) : m_components(components), m_entities(entities),
+                                                               m_count(count), m_guard(guard) {
+        }
+
+        [[nodiscard]] Iterator begin() const { return Iterator(m_components, m_entities); }
+
+        [[nodiscard]] Iterator end() const { return Iterator(m_components + m_count, m_entities + m_count); }
+
+        [[nodiscard]] std::size_t Size() const { return m_count; }
+
+        [[nodiscard]] bool Empty() const { return m_count == 0; }
+
+        /**
+         * Get the component / entity pair at the given dense index.
+         * @param index The dense index, must be smaller than Size()
+         * @return The component pointer and the entity owning it
+         */
+        [[nodiscard]] std::pair<T*, EntityId> operator[](const std::size_t index) const {
+            return {m_components + index, m_entities[index]};
+        }
+
+        /**
+         * Call fn(entity, component) for every component of the view, split into cache line aligned chunks that run
+         * on the job system. Blocks until all chunks are processed. fn must only touch the component it is called
+         * with, or otherwise synchronize its writes. Adding or removing components of this type during the
+         * iteration is asserted against in debug builds.
+         * @param job_system The job system executing the chunks
+         * @param fn The function to call per component
+         * @param grain_size The minimum number of components per chunk, 0 picks a size based on the thread count
+         */
+        template<class Fn>
+        void ParallelForEach(Jobs::JobSystem& job_system, Fn&& fn, const std::size_t grain_size = 0) const {
+            const IterationGuard::Scope scope(m_guard);
+            const auto chunk_size = GetParallelChunkSize<T>(m_count, grain_size, job_system.GetThreadCount());
+            job_system.ParallelFor(m_count, chunk_size, [this, &fn](const std::size_t begin, const std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    fn(m_entities[i], m_components[i]);
+                }
+            });
+        }
+
+    private:
+        T* m_components = nullptr;
+        const EntityId* m_entities = nullptr;
+        std::size_t m_count = 0;
+        const IterationGuard* m_guard = nullptr;
+    };
+} // namespace
@@ -1,13 +1,28 @@
 #include "EntityManager.hpp"
 
+#include <algorithm>
 #include <ranges>
 
+#include "NameTable.hpp"
+#include "../include/WorldMemoryStats.hpp"
+
 namespace Engine::Ecs {
+    namespace {
+        /**
+         * Node based hash maps allocate one node per element, holding the element and the link to the next node.
+         */
+        template<class Map>
+        std::size_t EstimateHashMapBytes(const Map& map) {
+            return map.bucket_count() * sizeof(void*) + map.size() * (sizeof(typename Map::value_type) + sizeof(void*));
+        }
+    }
+
     EntityManager::EntityManager() {
         // Never use index 0 since it is the indicator for a non-existing entity
         m_generations.push_back(1);
         m_alive_entities.push_back(0);
         m_pending_entities.push_back(0);
+        m_signatures.emplace_back();
         m_alive_count = 0;
         m_next_idx = 1;
     }
@@ -16,11 +31,25 @@ namespace Engine::Ecs {
         m_generations.clear();
         m_alive_entities.clear();
         m_pending_entities.clear();
+        m_signatures.clear();
         m_free_entity_indices.clear();
     }
 
 
     EntityId EntityManager::ReserveEntity(const std::string &name) {
+        const auto name_id = NameTable::Global().Intern(name);
+        if (m_entities_lookup.contains(name_id)) {
+            throw std::runtime_error("Entity with the name " + name + " already exists");
+        }
+
+        const auto entity = ReserveEntity();
+        m_entities_lookup.emplace(name_id, entity);
+        m_reverse_lookup.emplace(entity, name_id);
+
+        return entity;
+    }
+
+    EntityId EntityManager::ReserveEntity() {
         uint64_t idx;
         if (!m_free_entity_indices.empty()) {
             idx = GetEntityIndex(m_free_entity_indices.back());
@@ -33,15 +62,26 @@ namespace Engine::Ecs {
         m_pending_entities[idx] = 1;
 
         const uint64_t generation = m_generations[idx] & GENRATION_MASK;
-        const auto entity = (generation << INDEX_BITS) | (idx & INDEX_MASK);
+        return (generation << INDEX_BITS) | (idx & INDEX_MASK);
+    }
 
-        if (m_entities_lookup.contains(name)) {
-            throw std::runtime_error("Entity with the name " + name + " already exists");
+    void EntityManager::ReserveEntities(const std::span<EntityId> out) {
+        std::size_t reserved = 0;
+        while (reserved < out.size() && !m_free_entity_indices.empty()) {
+            out[reserved++] = ReserveEntity();
+        }
+        if (reserved == out.size()) {
+            return;
         }
-        m_entities_lookup.emplace(name, entity);
-        m_reverse_lookup.emplace(entity, name);
 
-        return entity;
+        const uint64_t first_idx = m_next_idx;
+        m_next_idx += out.size() - reserved;
+        EnsureCapacity(m_next_idx - 1);
+        for (uint64_t idx = first_idx; idx < m_next_idx; ++idx) {
+            m_pending_entities[idx] = 1;
+            const uint64_t generation = m_generations[idx] & GENRATION_MASK;
+            out[reserved++] = (generation << INDEX_BITS) | (idx & INDEX_MASK);
+        }
     }
 
     void EntityManager::CommitEntity(const EntityId entity) {
@@ -68,6 +108,12 @@ namespace Engine::Ecs {
         }
     }
 
+    void EntityManager::CommitEntities(const std::span<const EntityId> entities) {
+        for (const auto entity: entities) {
+            CommitEntity(entity);
+        }
+    }
+
     void EntityManager::DestroyEntity(const EntityId entity) {
         if (!IsEntityAlive(entity) && !IsEntityPending(entity)) {
             return;
@@ -84,6 +130,7 @@ namespace Engine::Ecs {
         if (m_pending_entities[idx]) {
             m_pending_entities[idx] = 0;
         }
+        m_signatures[idx].Clear();
 
         uint64_t gen = m_generations[idx] & GENRATION_MASK;
         gen = (gen + 1u) & GENRATION_MASK;
@@ -91,9 +138,26 @@ namespace Engine::Ecs {
         m_generations[idx] = static_cast<uint32_t>(gen);
         m_free_entity_indices.push_back(entity);
 
-        const auto name = m_reverse_lookup.find(entity)->second;
-        m_entities_lookup.erase(name);
-        m_reverse_lookup.erase(entity);
+        if (const auto name = m_reverse_lookup.find(entity); name != m_reverse_lookup.end()) {
+            m_entities_lookup.erase(name->second);
+            m_reverse_lookup.erase(name);
+        }
+    }
+
+    void EntityManager::Reset() {
+        for (uint64_t idx = 1; idx < m_next_idx; ++idx) {
+            m_generations[idx] = static_cast<uint32_t>((m_generations[idx] + 1u) & GENRATION_MASK);
+        }
+        std::ranges::fill(m_alive_entities, 0);
+        std::ranges::fill(m_pending_entities, 0);
+        for (auto& signature: m_signatures) {
+            signature.Clear();
+        }
+        m_free_entity_indices.clear();
+        m_alive_count = 0;
+        m_next_idx = 1;
+        m_entities_lookup.clear();
+        m_reverse_lookup.clear();
     }
 
     bool EntityManager::IsEntityAlive(const EntityId entity) const {
@@ -126,11 +190,77 @@ namespace Engine::Ecs {
         return m_pending_entities[idx] != 0;
     }
 
-    EntityId EntityManager::GetEntityByName(const std::string &name) const {
-        if (m_entities_lookup.contains(name)) {
-            return m_entities_lookup.at(name);
+    EntityId EntityManager::GetEntityByName(const std::string_view name) const {
+        return GetEntityByName(HashName(name));
+    }
+
+    EntityId EntityManager::GetEntityByName(const NameId name) const {
+        const auto it = m_entities_lookup.find(name);
+        if (it == m_entities_lookup.end()) {
+            return INVALID_ENTITY_ID;
+        }
+        return it->second;
+    }
+
+    void EntityManager::AddToSignature(const EntityId entity, const std::size_t component_type) {
+        if (!IsEntityAlive(entity) && !IsEntityPending(entity)) {
+            return;
+        }
+        m_signatures[GetEntityIndex(entity)].Set(component_type);
+    }
+
+    void EntityManager::RemoveFromSignature(const EntityId entity, const std::size_t component_type) {
+        if (!IsEntityAlive(entity) && !IsEntityPending(entity)) {
+            return;
+        }
+        m_signatures[GetEntityIndex(entity)].Reset(component_type);
+    }
+
+    const ComponentSignature& EntityManager::GetSignature(const EntityId entity) const {
+        static const ComponentSignature empty;
+        if (!IsEntityAlive(entity) && !IsEntityPending(entity)) {
+            return empty;
+        }
+        return m_signatures[GetEntityIndex(entity)];
+    }
+
+    void EntityManager::Serialize(SnapshotWriter& writer) const {
+        writer.WriteArray<uint32_t>(m_generations);
+        writer.WriteArray<uint8_t>(m_alive_entities);
+        writer.WriteArray<uint8_t>(m_pending_entities);
+        writer.WriteArray<uint64_t>(m_free_entity_indices);
+        writer.Write<uint64_t>(m_alive_count);
+        writer.Write<uint64_t>(m_next_idx);
+
+        writer.Write<uint64_t>(m_reverse_lookup.size());
+        for (const auto& [entity, name]: m_reverse_lookup) {
+            writer.Write<EntityId>(entity);
+            writer.WriteString(NameTable::Global().GetName(name));
+        }
+    }
+
+    void EntityManager::Deserialize(SnapshotReader& reader) {
+        reader.ReadArray(m_generations);
+        reader.ReadArray(m_alive_entities);
+        reader.ReadArray(m_pending_entities);
+        reader.ReadArray(m_free_entity_indices);
+        m_alive_count = reader.Read<uint64_t>();
+        m_next_idx = reader.Read<uint64_t>();
+        if (m_alive_entities.size() != m_generations.size() || m_pending_entities.size() != m_generations.size() ||
+            m_generations.empty() || m_next_idx > m_generations.size()) {
+            throw std::runtime_error("EntityManager::Deserialize: Entity tables do not match");
+        }
+        m_signatures.assign(m_generations.size(), ComponentSignature());
+
+        m_entities_lookup.clear();
+        m_reverse_lookup.clear();
+        const auto name_count = reader.ReadCount(sizeof(EntityId));
+        for (std::size_t i = 0; i < name_count; ++i) {
+            const auto entity = reader.Read<EntityId>();
+            const auto name_id = NameTable::Global().Intern(reader.ReadString());
+            m_entities_lookup.emplace(name_id, entity);
+            m_reverse_lookup.emplace(entity, name_id);
         }
-        return INVALID_ENTITY_ID;
     }
 
     std::vector<EntityId> EntityManager::GetAllActiveEntities() const {
@@ -148,6 +278,22 @@ namespace Engine::Ecs {
         return result;
     }
 
+    EntityMemoryStats EntityManager::GetMemoryStats() const {
+        EntityMemoryStats stats{};
+        stats.capacity = m_generations.size();
+        stats.alive = m_alive_count;
+        stats.pending = static_cast<std::size_t>(std::ranges::count(m_pending_entities, 1));
+        stats.free_indices = m_free_entity_indices.size();
+        stats.named = m_entities_lookup.size();
+        stats.table_bytes = m_generations.capacity() * sizeof(uint32_t) +
+                            m_free_entity_indices.capacity() * sizeof(uint64_t) +
+                            m_alive_entities.capacity() * sizeof(uint8_t) +
+                            m_pending_entities.capacity() * sizeof(uint8_t) +
+                            m_signatures.capacity() * sizeof(ComponentSignature);
+        stats.name_bytes = EstimateHashMapBytes(m_entities_lookup) + EstimateHashMapBytes(m_reverse_lookup);
+        return stats;
+    }
+
     void EntityManager::EnsureCapacity(const uint64_t idx) {
         const auto need = static_cast<size_t>(idx + 1);
         const auto size = m_generations.size();
@@ -156,6 +302,7 @@ namespace Engine::Ecs {
             m_generations.resize(new_size, 0);
             m_alive_entities.resize(new_size, 0);
             m_pending_entities.resize(new_size, 0);
+            m_signatures.resize(new_size);
         }
     }
 } // namespace
@@ -1,12 +1,19 @@
 #pragma once
+#include <span>
 #include <vector>
 #include <unordered_map>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include "ComponentSignature.hpp"
 #include "Entity.hpp"
+#include "Ecs/NameId.hpp"
+#include "../include/SnapshotStream.hpp"
 
 
 namespace Engine::Ecs {
+    struct EntityMemoryStats;
+
     /**
      * @brief Manages the creation, destruction, and querying of entity IDs.
      *
@@ -27,12 +34,31 @@ namespace Engine::Ecs {
          */
         EntityId ReserveEntity(const std::string &name);
 
+        /**
+         * Reserve an anonymous entity. It can not be fetched by name and skips the name lookup entirely.
+         * @return The EntityID of the newly reserved entity.
+         */
+        EntityId ReserveEntity();
+
+        /**
+         * Reserve anonymous entities in one go. Free indices are reused first, the remaining entities get a
+         * contiguous range of new indices.
+         * @param out Receives one reserved entity per element
+         */
+        void ReserveEntities(std::span<EntityId> out);
+
         /**
          * Commit the entity to the world and enable it. It is now available for queries in world.
          * @param entity The entity to commit.
          */
         void CommitEntity(EntityId entity);
 
+        /**
+         * Commit several entities at once.
+         * @param entities The entities to commit.
+         */
+        void CommitEntities(std::span<const EntityId> entities);
+
         /**
          * Get all entities that are alive in the world. Pending and inactive entities are not included.
          * @return
@@ -45,6 +71,12 @@ namespace Engine::Ecs {
          */
         void DestroyEntity(EntityId entity);
 
+        /**
+         * Destroy all entities at once while keeping the capacity of the tables. The generation of every used index is
+         * increased, so handles from before the reset are no longer alive.
+         */
+        void Reset();
+
         /**
          * Check if an entity is alive in the world.
          * @param entity The entity to check.
@@ -64,7 +96,54 @@ namespace Engine::Ecs {
          * @param name The name of the entity
          * @return The requested entity; InvalidEntityID if the name was invalid or the entity not found
          */
-        [[nodiscard]] EntityId GetEntityByName(const std::string &name) const;
+        [[nodiscard]] EntityId GetEntityByName(std::string_view name) const;
+
+        /**
+         * Fetch an entity by the id of its name, without hashing the name again.
+         * @param name The id of the entity name
+         * @return The requested entity; InvalidEntityID if no entity with this name exists
+         */
+        [[nodiscard]] EntityId GetEntityByName(NameId name) const;
+
+        /**
+         * Record that an entity owns a component type. Ignored for entities that are neither alive nor pending.
+         * @param entity The entity that got the component
+         * @param component_type The type id of the component
+         */
+        void AddToSignature(EntityId entity, std::size_t component_type);
+
+        /**
+         * Record that an entity lost a component type.
+         * @param entity The entity that lost the component
+         * @param component_type The type id of the component
+         */
+        void RemoveFromSignature(EntityId entity, std::size_t component_type);
+
+        /**
+         * Get the component types an entity owns. The signature is cleared when the entity is destroyed.
+         * @param entity The entity to check
+         * @return The signature, empty for entities that are neither alive nor pending
+         */
+        [[nodiscard]] const ComponentSignature& GetSignature(EntityId entity) const;
+
+        /**
+         * Write the generations, states, free indices and names of all entities. Signatures are not written, since
+         * component type ids are only valid within one process. They are rebuilt from the restored pools.
+         * @param writer The snapshot to write to
+         */
+        void Serialize(SnapshotWriter& writer) const;
+
+        /**
+         * Replace all entities with the ones written by Serialize(). The signatures of all entities are cleared.
+         * @param reader The snapshot to read from
+         */
+        void Deserialize(SnapshotReader& reader);
+
+        /**
+         * Count the entities per state and the memory held by the entity table and the name lookups.
+         * @return The usage of the entity table
+         */
+        [[nodiscard]] EntityMemoryStats GetMemoryStats() const;
 
     private:
         /**
@@ -85,11 +164,16 @@ namespace Engine::Ecs {
          * Contains all entity indices with the information if they are pending or not.
          */
         std::vector<uint8_t> m_pending_entities;
+
+        /**
+         * Contains the component signature of each entity index.
+         */
+        std::vector<ComponentSignature> m_signatures;
         uint64_t m_alive_count;
         uint64_t m_next_idx;
 
-        std::unordered_map<std::string, EntityId> m_entities_lookup;
-        std::unordered_map<EntityId, std::string> m_reverse_lookup;
+        std::unordered_map<NameId, EntityId> m_entities_lookup;
+        std::unordered_map<EntityId, NameId> m_reverse_lookup;
 
         void EnsureCapacity(uint64_t idx);
     };
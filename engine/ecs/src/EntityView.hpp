@@ -0,0 +1,299 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ComponentPool.hpp"
+#include "Entity.hpp"
+#include "JobSystem.hpp"
+#include "ParallelIteration.hpp"
+#include "archetype/ArchetypeStorage.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * Filter for entity views. Entities owning any of the listed components are skipped.
+     * @tparam Ts The component types to exclude
+     */
+    template<class... Ts>
+    struct Exclude {
+    };
+
+    template<class ExcludeList, class... Ts>
+    class EntityView;
+
+    /**
+     * @class EntityView
+     * @brief Non-allocating join over multiple component pools.
+     *
+     * The view iterates the dense entity array of the smallest required pool and probes all other pools through
+     * their sparse arrays. Iterating yields (EntityId, Ts&...) tuples, so it can be used with structured bindings.
+     * Const qualified component types are yielded as const references. If any of the required pools does not
+     * exist, the view is empty. Like ComponentView, it stays valid until the next call to
+     * World::ApplyEngineEvents().
+     * In a world using ComponentStorage::Archetype, the view walks the chunks of the matching archetypes instead,
+     * reading the component arrays of every chunk side by side without probing anything.
+     */
+    template<class... Ex, class... Ts>
+    class EntityView<Exclude<Ex...>, Ts...> {
+        static_assert(sizeof...(Ts) > 0, "EntityView requires at least one component type");
+
+    public:
+        using Pools = std::tuple<TypedComponentPool<std::remove_const_t<Ts> >*...>;
+        using ExcludedPools = std::tuple<const TypedComponentPool<std::remove_const_t<Ex> >*...>;
+        using Columns = std::tuple<Ts*...>;
+
+        class Iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::tuple<EntityId, Ts&...>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            Iterator() = default;
+
+            Iterator(const EntityView* view, const EntityId* current, const EntityId* end) : m_view(view),
+                m_current(current), m_end(end) {
+                SkipUnmatched();
+            }
+
+            /**
+             * Iterator over the matching archetypes, starting at the first non-empty chunk of the given archetype.
+             */
+            Iterator(const EntityView* view, const std::size_t archetype) : m_view(view), m_archetype(archetype) {
+                NextChunk();
+            }
+
+            value_type operator*() const {
+                if (m_view->m_match != nullptr) {
+                    return std::apply([this](auto*... column) { return value_type(*m_current, *column...); },
+                                      m_columns
+                            );
+                }
+                return m_view->Fetch(*m_current, std::index_sequence_for<Ts...>{});
+            }
+
+            Iterator& operator++() {
+                ++m_current;
+                if (m_view->m_match == nullptr) {
+                    SkipUnmatched();
+                } else if (m_current != m_end) {
+                    std::apply([](auto*&... column) { (++column, ...); }, m_columns);
+                } else {
+                    ++m_chunk;
+                    NextChunk();
+                }
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const { return m_current == other.m_current; }
+
+        private:
+            void SkipUnmatched() {
+                while (m_current != m_end && !m_view->Matches(*m_current)) {
+                    ++m_current;
+                }
+            }
+
+            /**
+             * Move to the first non-empty chunk at or after the current one. Rows are packed, so an empty chunk
+             * means the rest of the archetype is empty as well. Past the last archetype, the iterator equals end().
+             */
+            void NextChunk() {
+                const auto& archetypes = m_view->m_match->archetypes;
+                for (; m_archetype < archetypes.size(); ++m_archetype, m_chunk = 0) {
+                    const Archetype* archetype = archetypes[m_archetype];
+                    if (m_chunk < archetype->GetChunkCount() && archetype->GetRowCount(m_chunk) > 0) {
+                        m_current = archetype->GetEntities(m_chunk);
+                        m_end = m_current + archetype->GetRowCount(m_chunk);
+                        m_columns = m_view->GetColumns(m_archetype, m_chunk, std::index_sequence_for<Ts...>{});
+                        return;
+                    }
+                }
+                m_current = nullptr;
+                m_end = nullptr;
+            }
+
+            const EntityView* m_view = nullptr;
+            const EntityId* m_current = nullptr;
+            const EntityId* m_end = nullptr;
+            std::size_t m_archetype = 0;
+            std::size_t m_chunk = 0;
+            Columns m_columns{};
+        };
+
+        EntityView() = default;
+
+        EntityView(Pools pools, ExcludedPools excluded_pools) : m_pools(pools), m_excluded_pools(excluded_pools) {
+            const bool all_pools_exist = std::apply([](auto*... pool) { return ((pool != nullptr) && ...); }, m_pools);
+            if (!all_pools_exist) {
+                return;
+            }
+
+            std::size_t smallest = std::numeric_limits<std::size_t>::max();
+            const auto select_driver = [this, &smallest](auto* pool) {
+                if (pool->Count() < smallest) {
+                    smallest = pool->Count();
+                    m_driver = pool->GetEntities();
+                }
+            };
+            std::apply([&select_driver](auto*... pool) { (select_driver(pool), ...); }, m_pools);
+        }
+
+        /**
+         * View over the archetypes of an archetype storage.
+         * @param storage The storage owning the archetypes
+         * @param match The archetypes owning all required and none of the excluded components
+         */
+        EntityView(const ArchetypeStorage* storage, const ArchetypeMatch* match) : m_storage(storage), m_match(match) {
+            for (const auto* archetype: m_match->archetypes) {
+                m_match_rows += archetype->GetRowCount();
+            }
+        }
+
+        [[nodiscard]] Iterator begin() const {
+            if (m_match != nullptr) {
+                return Iterator(this, 0);
+            }
+            return Iterator(this, m_driver.data(), m_driver.data() + m_driver.size());
+        }
+
+        [[nodiscard]] Iterator end() const {
+            if (m_match != nullptr) {
+                return Iterator(this, m_match->archetypes.size());
+            }
+            const auto end = m_driver.data() + m_driver.size();
+            return Iterator(this, end, end);
+        }
+
+        /**
+         * Get the number of entities the view walks over. This is the size of the smallest required pool and
+         * therefore an upper bound of the matching entities. Over archetypes, it is the exact number of matches.
+         * @return The number of candidate entities
+         */
+        [[nodiscard]] std::size_t SizeHint() const { return m_match != nullptr ? m_match_rows : m_driver.size(); }
+
+        /**
+         * Check if an entity owns all required components and none of the excluded ones.
+         * @param entity The entity to check
+         * @return True if the entity would be visited by this view
+         */
+        [[nodiscard]] bool Matches(const EntityId entity) const {
+            if (m_match != nullptr) {
+                const auto* archetype = m_storage->GetArchetype(entity);
+                return archetype != nullptr &&
+                       std::ranges::find(m_match->archetypes, archetype) != m_match->archetypes.end();
+            }
+            const bool has_required = std::apply([entity](auto*... pool) { return (pool->Contains(entity) && ...); },
+                                                 m_pools
+                    );
+            if (!has_required) {
+                return false;
+            }
+            return std::apply([entity](auto*... pool) {
+                return ((pool == nullptr || !pool->Contains(entity)) && ...);
+            }, m_excluded_pools);
+        }
+
+        /**
+         * Call fn(entity, components...) for every matching entity. The candidate entities are split into cache line
+         * aligned chunks that run on the job system, the call blocks until all chunks are processed. fn must only
+         * write to the components it is called with. Adding or removing components of the required types during the
+         * iteration is asserted against in debug builds. Over archetypes, every job processes whole archetype chunks.
+         * @param job_system The job system executing the chunks
+         * @param fn The function to call per matching entity
+         * @param grain_size The minimum number of candidates per chunk, 0 picks a size based on the thread count
+         */
+        template<class Fn>
+        void ParallelForEach(Jobs::JobSystem& job_system, Fn&& fn, const std::size_t grain_size = 0) const {
+            if (m_match != nullptr) {
+                ParallelForEachChunk(job_system, fn, grain_size);
+                return;
+            }
+            if (m_driver.empty()) {
+                return;
+            }
+            std::apply([&](auto*... pool) {
+                [[maybe_unused]] const IterationGuard::Scope scopes[] = {IterationGuard::Scope(pool->GetIterationGuard())...};
+                const auto chunk_size = GetParallelChunkSize<EntityId>(m_driver.size(), grain_size,
+                                                                       job_system.GetThreadCount()
+                        );
+                job_system.ParallelFor(m_driver.size(), chunk_size,
+                                       [this, &fn](const std::size_t begin, const std::size_t end) {
+                                           for (std::size_t i = begin; i < end; ++i) {
+                                               const auto entity = m_driver[i];
+                                               if (Matches(entity)) {
+                                                   std::apply(fn, Fetch(entity, std::index_sequence_for<Ts...>{}));
+                                               }
+                                           }
+                                       }
+                        );
+            }, m_pools);
+        }
+
+    private:
+        template<std::size_t... I>
+        std::tuple<EntityId, Ts&...> Fetch(const EntityId entity, std::index_sequence<I...>) const {
+            return std::tuple<EntityId, Ts&...>(entity, std::get<I>(m_pools)->GetUnchecked(entity)...);
+        }
+
+        /**
+         * @return The first component of every required type in a chunk of a matching archetype
+         */
+        template<std::size_t... I>
+        Columns GetColumns(const std::size_t archetype, const std::size_t chunk, std::index_sequence<I...>) const {
+            const Archetype* matched = m_match->archetypes[archetype];
+            const auto* columns = m_match->columns.data() + archetype * sizeof...(Ts);
+            return Columns(static_cast<Ts*>(matched->GetColumnData(chunk, columns[I]))...);
+        }
+
+        template<class Fn>
+        void ParallelForEachChunk(Jobs::JobSystem& job_system, Fn& fn, const std::size_t grain_size) const {
+            for (std::size_t index = 0; index < m_match->archetypes.size(); ++index) {
+                const Archetype* archetype = m_match->archetypes[index];
+                const auto capacity = archetype->GetChunkCapacity();
+                const auto chunk_count = (archetype->GetRowCount() + capacity - 1) / capacity;
+                if (chunk_count == 0) {
+                    continue;
+                }
+                job_system.ParallelFor(chunk_count, std::max<std::size_t>(1, grain_size / capacity),
+                                       [this, &fn, archetype, index](const std::size_t begin, const std::size_t end) {
+                                           for (std::size_t chunk = begin; chunk < end; ++chunk) {
+                                               const auto rows = archetype->GetRowCount(chunk);
+                                               const EntityId* entities = archetype->GetEntities(chunk);
+                                               const auto columns = GetColumns(index, chunk,
+                                                                               std::index_sequence_for<Ts...>{});
+                                               std::apply([&](auto*... column) {
+                                                   for (std::size_t row = 0; row < rows; ++row) {
+                                                       fn(entities[row], column[row]...);
+                                                   }
+                                               }, columns);
+                                           }
+                                       }
+                        );
+            }
+        }
+
+        Pools m_pools{};
+        ExcludedPools m_excluded_pools{};
+        std::span<const EntityId> m_driver;
+        const ArchetypeStorage* m_storage = nullptr;
+        /**
+         * Set if the view walks archetypes instead of pools.
+         */
+        const ArchetypeMatch* m_match = nullptr;
+        std::size_t m_match_rows = 0;
+    };
+} // namespace
@@ -1,14 +1,16 @@
-#include <utility>
-
 #include "Ecs/ISystem.hpp"
 #include "EngineBindToken.hpp"
 #include "SystemWorld.hpp"
 #include "World.hpp"
 
 namespace Engine::Ecs {
-    void ISystem::Bind(EngineBindToken, Input::IInput& input, SystemWorld& world, CommandEvent command_event) {
+    void ISystem::Bind(EngineBindToken, Input::IInput& input, SystemWorld& world, CommandBus& command_bus) {
         m_input = &input;
         m_world = &world;
-        m_command_event = std::move(command_event);
+        m_command_bus = &command_bus;
+    }
+
+    void ISystem::SetLastRunTick(EngineBindToken, const ChangeTick tick) {
+        m_last_run_tick = tick;
     }
 }
@@ -0,0 +1,29 @@
+#include "NameTable.hpp"
+
+#include <stdexcept>
+
+namespace Engine::Ecs {
+    NameTable& NameTable::Global() {
+        static NameTable table;
+        return table;
+    }
+
+    NameId NameTable::Intern(const std::string_view name) {
+        const auto name_id = HashName(name);
+        std::lock_guard lock(m_mutex);
+        const auto [it, inserted] = m_names.try_emplace(name_id, name);
+        if (!inserted && it->second != name) {
+            throw std::runtime_error("The names " + it->second + " and " + std::string(name) + " share the same id");
+        }
+        return name_id;
+    }
+
+    std::string_view NameTable::GetName(const NameId name_id) const {
+        std::lock_guard lock(m_mutex);
+        const auto it = m_names.find(name_id);
+        if (it == m_names.end()) {
+            return {};
+        }
+        return it->second;
+    }
+} // namespace
@@ -0,0 +1,43 @@
+#pragma once
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Ecs/NameId.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * @class NameTable
+     * @brief Global table of all interned entity names.
+     *
+     * Entities are looked up by the NameId of their name only. The table keeps the strings behind the ids, so names
+     * can be shown in messages and debug output, and it detects two different names hashing to the same id.
+     */
+    class NameTable {
+    public:
+        /**
+         * @return The table shared by all worlds
+         */
+        static NameTable& Global();
+
+        /**
+         * Store a name, if it is not already known.
+         * @param name The name to intern
+         * @return The id of the name
+         * @throws std::runtime_error If a different name with the same id was interned before
+         */
+        NameId Intern(std::string_view name);
+
+        /**
+         * Get the name behind an id.
+         * @param name_id The id of the name
+         * @return The interned name, or an empty string if the id was never interned
+         */
+        [[nodiscard]] std::string_view GetName(NameId name_id) const;
+
+    private:
+        std::unordered_map<NameId, std::string> m_names;
+        mutable std::mutex m_mutex;
+    };
+} // namespace
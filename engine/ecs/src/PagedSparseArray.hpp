@@ -0,0 +1,96 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine::Ecs {
+    /**
+     * @class PagedSparseArray
+     * @brief Maps entity indices to values, allocating fixed size pages only for the index ranges in use.
+     *
+     * Reading an index on a missing page yields the empty value without allocating, so a component type owned by a
+     * handful of entities only pays for the pages its entities fall into instead of one slot per entity index.
+     * @tparam V The stored value type, a small trivially copyable type like a dense index or a tick
+     * @tparam Empty The value of slots that were never written
+     * @tparam PageSize The number of entries per page, must be a power of two
+     */
+    template<class V, V Empty, std::size_t PageSize = 4096>
+    class PagedSparseArray {
+        static_assert(std::has_single_bit(PageSize), "PagedSparseArray: The page size must be a power of two");
+
+    public:
+        static constexpr std::size_t PAGE_SIZE = PageSize;
+
+        /**
+         * @param index The entity index
+         * @return The stored value, or the empty value if nothing was stored at the index
+         */
+        [[nodiscard]] V Get(const uint64_t index) const {
+            const auto page = index / PageSize;
+            if (page >= m_pages.size() || !m_pages[page]) {
+                return Empty;
+            }
+            return m_pages[page][index % PageSize];
+        }
+
+        /**
+         * Access an index whose page is known to exist, e.g. because Contains() returned true for it.
+         */
+        [[nodiscard]] V GetUnchecked(const uint64_t index) const {
+            return m_pages[index / PageSize][index % PageSize];
+        }
+
+        /**
+         * Get the slot of an index for writing, allocating its page if needed.
+         * @param index The entity index
+         * @return The slot, holding the empty value if nothing was stored yet
+         */
+        V& GetOrCreate(const uint64_t index) {
+            const auto page = index / PageSize;
+            if (page >= m_pages.size()) {
+                m_pages.resize(page + 1);
+            }
+            if (!m_pages[page]) {
+                m_pages[page] = std::make_unique<V[]>(PageSize);
+                std::fill_n(m_pages[page].get(), PageSize, Empty);
+                m_allocated_pages++;
+            }
+            return m_pages[page][index % PageSize];
+        }
+
+        /**
+         * Write to an index whose page is known to exist.
+         */
+        void SetUnchecked(const uint64_t index, const V value) {
+            m_pages[index / PageSize][index % PageSize] = value;
+        }
+
+        /**
+         * Set every slot back to the empty value, keeping the allocated pages. Costs one fill per page, independent
+         * of the number of stored values.
+         */
+        void Reset() {
+            for (const auto& page: m_pages) {
+                if (page) {
+                    std::fill_n(page.get(), PageSize, Empty);
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t GetAllocatedPageCount() const { return m_allocated_pages; }
+
+        /**
+         * @return The bytes used by the allocated pages and the page table
+         */
+        [[nodiscard]] std::size_t GetMemoryUsage() const {
+            return m_allocated_pages * PageSize * sizeof(V) + m_pages.capacity() * sizeof(std::unique_ptr<V[]>);
+        }
+
+    private:
+        std::vector<std::unique_ptr<V[]> > m_pages;
+        std::size_t m_allocated_pages = 0;
+    };
+} // namespace
@@ -0,0 +1,111 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <numeric>
+
+namespace Engine::Ecs {
+    /**
+     * Assumed size of a cache line. Dense component arrays are allocated on this boundary and parallel iteration
+     * splits them into chunks of whole cache lines, so two threads never write to the same line.
+     */
+    constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * Minimal allocator that places every allocation on a cache line boundary.
+     * @tparam T The element type
+     */
+    template<class T>
+    struct CacheLineAllocator {
+        using value_type = T;
+
+        CacheLineAllocator() = default;
+
+        template<class U>
+        CacheLineAllocator(const CacheLineAllocator<U>&) noexcept {
+        }
+
+        T* allocate(const std::size_t count) {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{CACHE_LINE_SIZE}));
+        }
+
+        void deallocate(T* pointer, std::size_t) noexcept {
+            ::operator delete(pointer, std::align_val_t{CACHE_LINE_SIZE});
+        }
+
+        template<class U>
+        bool operator==(const CacheLineAllocator<U>&) const noexcept { return true; }
+    };
+
+    /**
+     * Calculate the number of elements per parallel chunk. A chunk always covers whole cache lines of T.
+     * @tparam T The element type
+     * @param count The number of elements to iterate
+     * @param grain_size The requested number of elements per chunk, 0 picks four chunks per thread
+     * @param thread_count The number of threads taking part in the iteration
+     * @return The number of elements per chunk
+     */
+    template<class T>
+    std::size_t GetParallelChunkSize(const std::size_t count, std::size_t grain_size, const std::size_t thread_count) {
+        constexpr std::size_t elements_per_step = CACHE_LINE_SIZE / std::gcd(CACHE_LINE_SIZE, sizeof(T));
+        if (grain_size == 0) {
+            grain_size = count / (std::max<std::size_t>(thread_count, 1) * 4);
+        }
+        grain_size = std::max(grain_size, elements_per_step);
+        return (grain_size + elements_per_step - 1) / elements_per_step * elements_per_step;
+    }
+
+    /**
+     * @class IterationGuard
+     * @brief Tracks parallel iterations over a component pool in debug builds.
+     *
+     * Adding or removing components while worker threads walk the dense arrays would move the elements under their
+     * feet. The pool asserts on such structural changes while a guard scope is active. In release builds the guard
+     * is empty and all checks compile away.
+     */
+    class IterationGuard {
+    public:
+        class Scope {
+        public:
+            explicit Scope(const IterationGuard* guard) : m_guard(guard) {
+#ifndef NDEBUG
+                if (m_guard != nullptr) {
+                    m_guard->m_active_iterations.fetch_add(1, std::memory_order_relaxed);
+                }
+#endif
+            }
+
+            ~Scope() {
+#ifndef NDEBUG
+                if (m_guard != nullptr) {
+                    m_guard->m_active_iterations.fetch_sub(1, std::memory_order_relaxed);
+                }
+#endif
+            }
+
+            Scope(const Scope&) = delete;
+
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            [[maybe_unused]] const IterationGuard* m_guard;
+        };
+
+        /**
+         * Assert that no parallel iteration is running. Call before every structural change of the guarded pool.
+         */
+        void AssertNotIterating() const {
+#ifndef NDEBUG
+            assert(m_active_iterations.load(std::memory_order_relaxed) == 0 &&
+                "Component pool changed structurally during a parallel iteration");
+#endif
+        }
+
+    private:
+#ifndef NDEBUG
+        mutable std::atomic<std::size_t> m_active_iterations{0};
+#endif
+    };
+} // namespace
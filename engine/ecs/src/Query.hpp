@@ -0,0 +1,141 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ComponentPool.hpp"
+#include "EntityView.hpp"
+#include "JobSystem.hpp"
+#include "ParallelIteration.hpp"
+#include "QueryCounter.hpp"
+#include "QueryRegistry.hpp"
+
+namespace Engine::Ecs {
+    template<class ExcludeList, class... Ts>
+    class Query;
+
+    /**
+     * @class Query
+     * @brief Persistent join over multiple component pools, registered once and iterated every frame.
+     *
+     * Unlike EntityView, the matching entities are not searched for on every iteration. The world keeps them in a
+     * dense list sorted by entity index, which only changes when components are added or removed while the events
+     * are applied. Iterating walks that list and fetches the components through the sparse arrays, without probing
+     * other pools and without allocating. Iterating yields (EntityId, Ts&...) tuples like EntityView.
+     * The handle stays valid as long as the world, the list it walks is invalidated by the next call to
+     * World::ApplyEngineEvents().
+     */
+    template<class... Ex, class... Ts>
+    class Query<Exclude<Ex...>, Ts...> {
+        static_assert(sizeof...(Ts) > 0, "Query requires at least one component type");
+
+    public:
+        using Pools = std::tuple<TypedComponentPool<std::remove_const_t<Ts> >*...>;
+
+        class Iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::tuple<EntityId, Ts&...>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            Iterator() = default;
+
+            Iterator(const Query* query, const EntityId* current) : m_query(query), m_current(current) {
+            }
+
+            value_type operator*() const { return m_query->Fetch(*m_current, std::index_sequence_for<Ts...>{}); }
+
+            Iterator& operator++() {
+                ++m_current;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const { return m_current == other.m_current; }
+
+        private:
+            const Query* m_query = nullptr;
+            const EntityId* m_current = nullptr;
+        };
+
+        /**
+         * An unregistered query, which is always empty.
+         */
+        Query() = default;
+
+        Query(const QueryRegistry::Entry* entry, Pools pools) : m_entry(entry), m_pools(pools) {
+        }
+
+        [[nodiscard]] Iterator begin() const {
+            const auto entities = GetEntities();
+            QueryCounter::Add(entities.size());
+            return Iterator(this, entities.data());
+        }
+
+        [[nodiscard]] Iterator end() const {
+            const auto entities = GetEntities();
+            return Iterator(this, entities.data() + entities.size());
+        }
+
+        /**
+         * @return The matching entities, sorted by entity index
+         */
+        [[nodiscard]] std::span<const EntityId> GetEntities() const {
+            return m_entry != nullptr ? std::span<const EntityId>(m_entry->entities) : std::span<const EntityId>();
+        }
+
+        [[nodiscard]] std::size_t Size() const { return GetEntities().size(); }
+
+        [[nodiscard]] bool Empty() const { return GetEntities().empty(); }
+
+        /**
+         * Call fn(entity, components...) for every matching entity, split into cache line aligned chunks that run
+         * on the job system. Blocks until all chunks are processed. fn must only write to the components it is
+         * called with.
+         * @param job_system The job system executing the chunks
+         * @param fn The function to call per matching entity
+         * @param grain_size The minimum number of entities per chunk, 0 picks a size based on the thread count
+         */
+        template<class Fn>
+        void ParallelForEach(Jobs::JobSystem& job_system, Fn&& fn, const std::size_t grain_size = 0) const {
+            const auto entities = GetEntities();
+            if (entities.empty()) {
+                return;
+            }
+            QueryCounter::Add(entities.size());
+            std::apply([&](auto*... pool) {
+                [[maybe_unused]] const IterationGuard::Scope scopes[] = {IterationGuard::Scope(pool->GetIterationGuard())...};
+                const auto chunk_size = GetParallelChunkSize<EntityId>(entities.size(), grain_size,
+                                                                       job_system.GetThreadCount()
+                        );
+                job_system.ParallelFor(entities.size(), chunk_size,
+                                       [this, &fn, entities](const std::size_t begin, const std::size_t end) {
+                                           for (std::size_t i = begin; i < end; ++i) {
+                                               std::apply(fn, Fetch(entities[i], std::index_sequence_for<Ts...>{}));
+                                           }
+                                       }
+                        );
+            }, m_pools);
+        }
+
+    private:
+        template<std::size_t... I>
+        std::tuple<EntityId, Ts&...> Fetch(const EntityId entity, std::index_sequence<I...>) const {
+            return std::tuple<EntityId, Ts&...>(entity, std::get<I>(m_pools)->GetUnchecked(entity)...);
+        }
+
+        const QueryRegistry::Entry* m_entry = nullptr;
+        Pools m_pools{};
+    };
+} // namespace
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+
+namespace Engine::Ecs
+{
+    /**
+     * Counts the entities matched by the views requested on the calling thread while a scope is active. The
+     * system manager opens one around every system run, so the count belongs to exactly one system even when
+     * several systems run in parallel.
+     */
+    class QueryCounter
+    {
+    public:
+        /**
+         * Activates a counter for the calling thread. Scopes nest, since a thread waiting for jobs may run
+         * another system in between.
+         */
+        class Scope
+        {
+        public:
+            explicit Scope(std::size_t& counter) : m_previous(Current())
+            {
+                Current() = &counter;
+            }
+
+            ~Scope() { Current() = m_previous; }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            std::size_t* m_previous;
+        };
+
+        static void Add(const std::size_t entities)
+        {
+            if (auto* counter = Current())
+            {
+                *counter += entities;
+            }
+        }
+
+    private:
+        static std::size_t*& Current()
+        {
+            thread_local std::size_t* current = nullptr;
+            return current;
+        }
+    };
+} // namespace
@@ -0,0 +1,144 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "ComponentSignature.hpp"
+#include "Entity.hpp"
+#include "PagedSparseArray.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * @class QueryRegistry
+     * @brief Keeps the matching entities of every registered query, so iterating a query walks a prebuilt array.
+     *
+     * Queries are stored per pair of required and excluded signature, so systems asking for the same components
+     * share one entity list. The lists are only touched when the signature of an entity changes while the world
+     * applies its events, and are sorted by entity index once afterwards. Entries live as long as the world, their
+     * addresses are stable.
+     */
+    class QueryRegistry {
+    public:
+        struct Entry {
+            ComponentSignature required;
+            ComponentSignature excluded;
+            std::vector<EntityId> entities;
+            /**
+             * Position of every listed entity in entities, by entity index.
+             */
+            PagedSparseArray<uint32_t, std::numeric_limits<uint32_t>::max()> positions;
+            bool sorted = true;
+
+            [[nodiscard]] bool Matches(const ComponentSignature& signature) const {
+                return signature.ContainsAll(required) && !signature.Intersects(excluded);
+            }
+        };
+
+        static constexpr uint32_t NO_POSITION = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * Find the entry of a signature pair.
+         * @return The entry, or nullptr if no query with these signatures was registered
+         */
+        [[nodiscard]] Entry* Find(const ComponentSignature& required, const ComponentSignature& excluded) const {
+            const auto it = std::ranges::find_if(m_entries, [&](const auto& entry) {
+                return entry->required == required && entry->excluded == excluded;
+            });
+            return it != m_entries.end() ? it->get() : nullptr;
+        }
+
+        /**
+         * Create an empty entry, fill it with Add() and Sort() afterwards.
+         */
+        Entry& Create(const ComponentSignature& required, const ComponentSignature& excluded) {
+            auto& entry = *m_entries.emplace_back(std::make_unique<Entry>());
+            entry.required = required;
+            entry.excluded = excluded;
+            return entry;
+        }
+
+        [[nodiscard]] bool Empty() const { return m_entries.empty(); }
+
+        /**
+         * Add the entity to or remove it from every query, depending on its new signature.
+         * @param entity The entity whose components changed
+         * @param signature The current signature of the entity, empty if it was destroyed
+         */
+        void OnSignatureChanged(const EntityId entity, const ComponentSignature& signature) const {
+            for (const auto& entry: m_entries) {
+                if (entry->Matches(signature)) {
+                    Add(*entry, entity);
+                } else {
+                    Remove(*entry, entity);
+                }
+            }
+        }
+
+        /**
+         * Sort the lists that changed since the last call by entity index.
+         */
+        void Sort() const {
+            for (const auto& entry: m_entries) {
+                Sort(*entry);
+            }
+        }
+
+        /**
+         * Empty the lists of all queries, keeping the queries and their memory.
+         */
+        void ClearEntities() const {
+            for (const auto& entry: m_entries) {
+                entry->entities.clear();
+                entry->positions.Reset();
+                entry->sorted = true;
+            }
+        }
+
+        static void Add(Entry& entry, const EntityId entity) {
+            auto& position = entry.positions.GetOrCreate(GetEntityIndex(entity));
+            if (position != NO_POSITION) {
+                // Updated in place, the index might have been reused by a new generation
+                entry.entities[position] = entity;
+                return;
+            }
+            if (!entry.entities.empty() && GetEntityIndex(entry.entities.back()) > GetEntityIndex(entity)) {
+                entry.sorted = false;
+            }
+            position = static_cast<uint32_t>(entry.entities.size());
+            entry.entities.push_back(entity);
+        }
+
+        static void Sort(Entry& entry) {
+            if (entry.sorted) {
+                return;
+            }
+            std::ranges::sort(entry.entities, {}, [](const EntityId entity) { return GetEntityIndex(entity); });
+            for (uint32_t i = 0; i < entry.entities.size(); ++i) {
+                entry.positions.SetUnchecked(GetEntityIndex(entry.entities[i]), i);
+            }
+            entry.sorted = true;
+        }
+
+    private:
+        std::vector<std::unique_ptr<Entry> > m_entries;
+
+        static void Remove(Entry& entry, const EntityId entity) {
+            const auto index = GetEntityIndex(entity);
+            const auto position = entry.positions.Get(index);
+            if (position == NO_POSITION || entry.entities[position] != entity) {
+                return;
+            }
+            const auto last = entry.entities.back();
+            if (position + 1 != entry.entities.size()) {
+                entry.entities[position] = last;
+                entry.positions.SetUnchecked(GetEntityIndex(last), position);
+                entry.sorted = false;
+            }
+            entry.entities.pop_back();
+            entry.positions.SetUnchecked(index, NO_POSITION);
+        }
+    };
+} // namespace
@@ -0,0 +1,141 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Ecs/Types.hpp"
+
+namespace Engine::Ecs {
+    using ResourceTypeId = std::size_t;
+
+    /**
+     * @class ResourceStorage
+     * @brief Holds at most one value per type, e.g. the active camera or the player, next to the component pools.
+     *
+     * Slots are looked up by a per type id, so accessing a resource is a single index into a vector. Every slot
+     * remembers the change tick of its last write, removing a resource counts as a write as well.
+     * Setting and removing resources is not synchronized, it only happens on the main thread outside of the system
+     * updates. Systems get and modify existing resources.
+     */
+    class ResourceStorage {
+    public:
+        template<class T>
+        void Set(T value, const ChangeTick tick) {
+            auto& slot = GetOrCreateSlot<T>();
+            slot.value = std::move(value);
+            slot.tick = tick;
+        }
+
+        /**
+         * @return The resource, or nullptr if it was never set or removed
+         */
+        template<class T>
+        [[nodiscard]] T* Get() const {
+            auto* slot = FindSlot<T>();
+            return slot != nullptr && slot->value ? &*slot->value : nullptr;
+        }
+
+        /**
+         * Get a resource for writing and stamp the slot with the tick.
+         * @return The resource, or nullptr if it was never set or removed
+         */
+        template<class T>
+        T* Modify(const ChangeTick tick) {
+            auto* slot = FindSlot<T>();
+            if (slot == nullptr || !slot->value) {
+                return nullptr;
+            }
+            slot->tick = tick;
+            return &*slot->value;
+        }
+
+        template<class T>
+        void Remove(const ChangeTick tick) {
+            auto* slot = FindSlot<T>();
+            if (slot == nullptr || !slot->value) {
+                return;
+            }
+            slot->value.reset();
+            slot->tick = tick;
+        }
+
+        /**
+         * @return True if the resource was set, modified or removed after the tick
+         */
+        template<class T>
+        [[nodiscard]] bool IsChanged(const ChangeTick since) const {
+            const auto* slot = FindSlot<T>();
+            return slot != nullptr && slot->tick > since;
+        }
+
+        /**
+         * Remove all resources, keeping their slots. Every removed resource is stamped with the tick, so
+         * IsChanged() reports it like a single Remove().
+         */
+        void Clear(const ChangeTick tick) const {
+            for (const auto& slot: m_slots) {
+                if (slot) {
+                    slot->Reset(tick);
+                }
+            }
+        }
+
+        template<class T>
+        static ResourceTypeId TypeId() {
+            static const ResourceTypeId id = NextTypeId();
+            return id;
+        }
+
+    private:
+        struct ISlot {
+            virtual ~ISlot() = default;
+
+            virtual void Reset(ChangeTick tick) = 0;
+        };
+
+        template<class T>
+        struct Slot final : ISlot {
+            std::optional<T> value;
+            ChangeTick tick = 0;
+
+            void Reset(const ChangeTick reset_tick) override {
+                if (!value) {
+                    return;
+                }
+                value.reset();
+                tick = reset_tick;
+            }
+        };
+
+        std::vector<std::unique_ptr<ISlot> > m_slots;
+
+        static ResourceTypeId NextTypeId() {
+            static std::atomic<ResourceTypeId> next{0};
+            return next++;
+        }
+
+        template<class T>
+        Slot<T>* FindSlot() const {
+            const auto type_id = TypeId<T>();
+            if (type_id >= m_slots.size() || !m_slots[type_id]) {
+                return nullptr;
+            }
+            return static_cast<Slot<T>*>(m_slots[type_id].get());
+        }
+
+        template<class T>
+        Slot<T>& GetOrCreateSlot() {
+            const auto type_id = TypeId<T>();
+            if (type_id >= m_slots.size()) {
+                m_slots.resize(type_id + 1);
+            }
+            if (!m_slots[type_id]) {
+                m_slots[type_id] = std::make_unique<Slot<T> >();
+            }
+            return static_cast<Slot<T>&>(*m_slots[type_id]);
+        }
+    };
+} // namespace
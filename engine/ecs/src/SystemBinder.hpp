@@ -13,10 +13,15 @@ namespace Engine::Ecs {
                 ISystem& system,
                 Input::IInput& input,
                 SystemWorld& game_world,
-                const std::function<void(const std::any& command)>& func
+                CommandBus& command_bus
                 ) {
             constexpr EngineBindToken token;
-            system.Bind(token, input, game_world, func);
+            system.Bind(token, input, game_world, command_bus);
+        }
+
+        static void SetLastRunTick(ISystem& system, const ChangeTick tick) {
+            constexpr EngineBindToken token;
+            system.SetLastRunTick(token, tick);
         }
     };
 }
@@ -1,11 +1,27 @@
 #include "SystemManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <ranges>
 #include <utility>
 #include "CommandSystem.hpp"
+#include "QueryCounter.hpp"
 #include "SystemBinder.hpp"
 #include "SystemMetaSorter.hpp"
+#include "SystemScheduler.hpp"
 
 namespace Engine::Ecs
 {
+    namespace
+    {
+        /**
+         * Used for systems registered without a generated dispatch, e.g. by hand written metas.
+         */
+        void RunVirtual(ISystem& system, const float delta_time)
+        {
+            system.Run(delta_time);
+        }
+    }
+
     SystemManager::SystemManager(const std::vector<SystemMeta>& system_metas,
                                  IServiceToEcsProvider* service_provider, Systems::ICacheManager* cache_manager)
     {
@@ -21,12 +37,23 @@ namespace Engine::Ecs
         m_system_metas = system_metas;
         m_service_provider = service_provider;
         m_cache_manager = reinterpret_cast<Systems::CacheManager*>(cache_manager);
+
+        if (m_service_provider != nullptr)
+        {
+            m_job_system = m_service_provider->GetService<Jobs::JobSystem>();
+        }
+        if (m_job_system == nullptr)
+        {
+            m_owned_job_system = std::make_unique<Jobs::JobSystem>();
+            m_job_system = m_owned_job_system.get();
+        }
     }
 
     SystemManager::~SystemManager()
     {
         m_service_provider = nullptr;
         m_cache_manager = nullptr;
+        m_job_system = nullptr;
         m_phase_execution_order.clear();
         m_system_metas.clear();
     }
@@ -34,52 +61,24 @@ namespace Engine::Ecs
 
     void SystemManager::RegisterSystems(World* world, Input::IInput* input)
     {
+        m_world = world;
         m_game_world = std::make_unique<SystemWorld>(world);
         m_phase_map.clear();
+        for (auto& stages : m_phase_stages)
+        {
+            stages.clear();
+        }
 
         BuildCommandSystem(world);
-        auto push_command_func = [world](const std::any& command)
-        {
-            world->PushCommand(command);
-        };
         const auto sorted_metas = SystemMetaSorter::SortSystemMetasByPhaseAndDependencies(m_system_metas);
+        std::vector<ScheduledSystem> sorted_systems;
+        sorted_systems.reserve(sorted_metas.size());
         for (const auto& sys_meta : sorted_metas)
         {
             auto system = sys_meta.factory();
 
-            SystemBinder::BindSystem(*system, *input, *m_game_world, push_command_func);
-            auto system_ptr = system.get();
-            world->GetPhysicsEventBus()->SubscribeToOnCollisionEnter(
-                                                                     [system_ptr](
-                                                                     const EntityId target, const EntityId other)
-                                                                     {
-                                                                         system_ptr->OnCollisionEnter(target, other);
-                                                                     }
-                                                                    );
-
-            world->GetPhysicsEventBus()->SubscribeToOnCollisionExit(
-                                                                    [system_ptr](
-                                                                    const EntityId target, const EntityId other)
-                                                                    {
-                                                                        system_ptr->OnCollisionExit(target, other);
-                                                                    }
-                                                                   );
-
-            world->GetPhysicsEventBus()->SubscribeToOnTriggerEnter(
-                                                                   [system_ptr](
-                                                                   const EntityId target, const EntityId other)
-                                                                   {
-                                                                       system_ptr->OnTriggerEnter(target, other);
-                                                                   }
-                                                                  );
-
-            world->GetPhysicsEventBus()->SubscribeToOnTriggerExit(
-                                                                  [system_ptr](
-                                                                  const EntityId target, const EntityId other)
-                                                                  {
-                                                                      system_ptr->OnTriggerExit(target, other);
-                                                                  }
-                                                                 );
+            SystemBinder::BindSystem(*system, *input, *m_game_world, *world->GetCommandBus());
+            SubscribePhysicsCallbacks(*system, sys_meta.dispatch);
 
             if (std::ranges::find(sys_meta.tags, "ENGINE") != sys_meta.tags.end())
             {
@@ -88,28 +87,115 @@ namespace Engine::Ecs
                     engine_sys->m_service_locator = m_service_provider;
                     engine_sys->m_world = world;
                     engine_sys->m_cache_manager = m_cache_manager;
+                    engine_sys->m_job_system = m_job_system;
                 }
             }
             system->Initialize();
+            sorted_systems.push_back(ScheduledSystem{
+                .system = system.get(),
+                .run = sys_meta.dispatch.run != nullptr ? sys_meta.dispatch.run : &RunVirtual,
+                .profile = GetOrCreateProfile(sys_meta.name, sys_meta.phase),
+            });
             m_phase_map[sys_meta.phase].push_back(std::move(system));
         }
+        BuildPhaseStages(sorted_metas, sorted_systems);
+    }
+
+    void SystemManager::SubscribePhysicsCallbacks(ISystem& system, const SystemDispatch& dispatch) const
+    {
+        auto* physics_events = m_world->GetPhysicsEventBus();
+        ISystem* system_ptr = &system;
+        if (dispatch.run == nullptr)
+        {
+            physics_events->SubscribeToOnCollisionEnter([system_ptr](const EntityId target, const EntityId other)
+            {
+                system_ptr->OnCollisionEnter(target, other);
+            });
+            physics_events->SubscribeToOnCollisionExit([system_ptr](const EntityId target, const EntityId other)
+            {
+                system_ptr->OnCollisionExit(target, other);
+            });
+            physics_events->SubscribeToOnTriggerEnter([system_ptr](const EntityId target, const EntityId other)
+            {
+                system_ptr->OnTriggerEnter(target, other);
+            });
+            physics_events->SubscribeToOnTriggerExit([system_ptr](const EntityId target, const EntityId other)
+            {
+                system_ptr->OnTriggerExit(target, other);
+            });
+            return;
+        }
+
+        const auto direct = [system_ptr](const SystemCollisionFn callback)
+        {
+            return [system_ptr, callback](const EntityId target, const EntityId other)
+            {
+                callback(*system_ptr, target, other);
+            };
+        };
+        if (dispatch.on_collision_enter != nullptr)
+        {
+            physics_events->SubscribeToOnCollisionEnter(direct(dispatch.on_collision_enter));
+        }
+        if (dispatch.on_collision_exit != nullptr)
+        {
+            physics_events->SubscribeToOnCollisionExit(direct(dispatch.on_collision_exit));
+        }
+        if (dispatch.on_trigger_enter != nullptr)
+        {
+            physics_events->SubscribeToOnTriggerEnter(direct(dispatch.on_trigger_enter));
+        }
+        if (dispatch.on_trigger_exit != nullptr)
+        {
+            physics_events->SubscribeToOnTriggerExit(direct(dispatch.on_trigger_exit));
+        }
     }
 
     void SystemManager::BuildCommandSystem(World* world)
     {
-        auto command_system = std::make_unique<CommandSystem>([this](const std::vector<std::any>& commands)
-                                                              {
-                                                                  this->RaiseCommandsEvent(commands);
-                                                              }
-                                                             );
+        auto command_system = std::make_unique<CommandSystem>();
 
         command_system->m_world = world;
         command_system->m_service_locator = m_service_provider;
+        command_system->m_job_system = m_job_system;
         command_system->Initialize();
 
+        m_phase_stages[static_cast<std::size_t>(Phase::Commands)].push_back({
+            ScheduledSystem{
+                .system = command_system.get(),
+                .run = MakeSystemDispatch<CommandSystem>().run,
+                .profile = GetOrCreateProfile("CommandSystem", Phase::Commands),
+            }
+        });
         m_phase_map[Phase::Commands].push_back(std::move(command_system));
     }
 
+    void SystemManager::BuildPhaseStages(const std::vector<SystemMeta>& sorted_metas,
+                                         const std::vector<ScheduledSystem>& sorted_systems)
+    {
+        std::size_t phase_begin = 0;
+        while (phase_begin < sorted_metas.size())
+        {
+            const auto phase = sorted_metas[phase_begin].phase;
+            auto phase_end = phase_begin;
+            while (phase_end < sorted_metas.size() && sorted_metas[phase_end].phase == phase)
+            {
+                phase_end++;
+            }
+
+            const std::vector phase_metas(sorted_metas.begin() + phase_begin, sorted_metas.begin() + phase_end);
+            for (const auto& stage_indices : SystemScheduler::BuildStages(phase_metas))
+            {
+                auto& stage = m_phase_stages[static_cast<std::size_t>(phase)].emplace_back();
+                for (const auto index : stage_indices)
+                {
+                    stage.push_back(sorted_systems[phase_begin + index]);
+                }
+            }
+            phase_begin = phase_end;
+        }
+    }
+
     void SystemManager::PreFixed(const float delta_time)
     {
         RunPhase(Phase::Input, delta_time);
@@ -126,32 +212,116 @@ namespace Engine::Ecs
         {
             RunPhase(phase, delta_time);
         }
+        TrimChanges();
+    }
+
+    SystemTimingReport SystemManager::GetTimingReport() const
+    {
+        SystemTimingReport report;
+        for (const auto phase : m_profiled_phases)
+        {
+            report.phases.push_back(PhaseTimingStats{.phase = phase, .time = m_phase_timings.at(phase).GetStats()});
+        }
+        for (const auto& profile : m_system_profiles)
+        {
+            report.systems.push_back(SystemTimingStats{
+                .name = profile->name,
+                .phase = profile->phase,
+                .time = profile->time.GetStats(),
+                .queried_entities = profile->queried_entities,
+            });
+        }
+        // Phases are numbered in execution order, systems of a phase keep their registration order
+        std::ranges::stable_sort(report.phases, {}, &PhaseTimingStats::phase);
+        std::ranges::stable_sort(report.systems, {}, &SystemTimingStats::phase);
+        return report;
     }
 
-    void SystemManager::RegisterForSystemCommands(std::string subscriber_name,
-                                                  std::function<void(std::vector<std::any>)> command_callback)
+    void SystemManager::RunPhase(const Phase phase, const float delta_time)
     {
-        m_command_callback_subscriber.emplace(subscriber_name, std::move(command_callback));
+        const auto phase_start = std::chrono::steady_clock::now();
+        for (const auto& stage : m_phase_stages[static_cast<std::size_t>(phase)])
+        {
+            // Every stage gets its own tick, so a system sees the changes of all stages that ran since its last run
+            const auto tick = m_world != nullptr ? m_world->AdvanceChangeTick() : 0;
+            if (stage.size() == 1)
+            {
+                RunProfiled(stage.front(), delta_time);
+            }
+            else
+            {
+                Jobs::JobCounter counter;
+                for (const auto& scheduled : stage)
+                {
+                    m_job_system->Schedule([scheduled, delta_time]
+                    {
+                        RunProfiled(scheduled, delta_time);
+                    }, &counter);
+                }
+                m_job_system->Wait(counter);
+            }
+
+            for (const auto& scheduled : stage)
+            {
+                SystemBinder::SetLastRunTick(*scheduled.system, tick);
+            }
+        }
+
+        const std::chrono::duration<float, std::milli> phase_time = std::chrono::steady_clock::now() - phase_start;
+        auto [timing, inserted] = m_phase_timings.try_emplace(phase);
+        if (inserted)
+        {
+            m_profiled_phases.push_back(phase);
+        }
+        timing->second.Record(phase_time.count());
     }
 
-    void SystemManager::DeregisterForSystemCommands(const std::string& subscriber_name)
+    SystemManager::SystemProfile* SystemManager::GetOrCreateProfile(const std::string& name, const Phase phase)
     {
-        m_command_callback_subscriber.erase(subscriber_name);
+        if (const auto it = m_system_profiles_by_name.find(name); it != m_system_profiles_by_name.end())
+        {
+            return it->second;
+        }
+        auto& profile = m_system_profiles.emplace_back(std::make_unique<SystemProfile>());
+        profile->name = name;
+        profile->phase = phase;
+        m_system_profiles_by_name.emplace(name, profile.get());
+        return profile.get();
     }
 
-    void SystemManager::RunPhase(const Phase phase, const float delta_time)
+    void SystemManager::RunProfiled(const ScheduledSystem& scheduled, const float delta_time)
     {
-        for (const auto& system : m_phase_map[phase])
+        // Only the job running this system writes its profile, so parallel systems need no synchronization
+        std::size_t queried_entities = 0;
+        const auto start = std::chrono::steady_clock::now();
         {
-            system->Run(delta_time);
+            QueryCounter::Scope scope(queried_entities);
+            scheduled.run(*scheduled.system, delta_time);
         }
+        const std::chrono::duration<float, std::milli> run_time = std::chrono::steady_clock::now() - start;
+        scheduled.profile->time.Record(run_time.count());
+        scheduled.profile->queried_entities = queried_entities;
     }
 
-    void SystemManager::RaiseCommandsEvent(const std::vector<std::any>& commands) const
+    void SystemManager::TrimChanges() const
     {
-        for (const auto& subscriber : m_command_callback_subscriber | std::ranges::views::values)
+        if (m_world == nullptr)
+        {
+            return;
+        }
+
+        auto oldest_tick = m_world->GetChangeTick();
+        for (const auto& systems : m_phase_map | std::views::values)
         {
-            subscriber(commands);
+            for (const auto& system : systems)
+            {
+                // Systems that never ran yet have not seen anything, they start with the records still stored
+                if (system->GetLastRunTick() != 0)
+                {
+                    oldest_tick = std::min(oldest_tick, system->GetLastRunTick());
+                }
+            }
         }
+        m_world->TrimChanges(oldest_tick + 1);
     }
 } // namespace
@@ -0,0 +1,48 @@
+#include "SystemScheduler.hpp"
+
+#include <algorithm>
+
+namespace Engine::Ecs {
+    namespace {
+        bool Contains(const std::vector<std::string>& values, const std::string& value) {
+            return std::ranges::find(values, value) != values.end();
+        }
+
+        bool WritesTouch(const SystemAccess& writer, const SystemAccess& other) {
+            return std::ranges::any_of(writer.writes, [&other](const std::string& type) {
+                return Contains(other.reads, type) || Contains(other.writes, type);
+            });
+        }
+    }
+
+    std::vector<std::vector<std::size_t> > SystemScheduler::BuildStages(const std::vector<SystemMeta>& phase_metas) {
+        std::vector<std::size_t> stage_of_system(phase_metas.size(), 0);
+        std::vector<std::vector<std::size_t> > stages;
+
+        for (std::size_t i = 0; i < phase_metas.size(); ++i) {
+            std::size_t stage = 0;
+            for (std::size_t j = 0; j < i; ++j) {
+                if (Conflicts(phase_metas[i], phase_metas[j])) {
+                    stage = std::max(stage, stage_of_system[j] + 1);
+                }
+            }
+            stage_of_system[i] = stage;
+
+            if (stages.size() <= stage) {
+                stages.resize(stage + 1);
+            }
+            stages[stage].push_back(i);
+        }
+        return stages;
+    }
+
+    bool SystemScheduler::Conflicts(const SystemMeta& lhs, const SystemMeta& rhs) {
+        if (!lhs.access.has_value() || !rhs.access.has_value()) {
+            return true;
+        }
+        if (Contains(lhs.dependencies, rhs.name) || Contains(rhs.dependencies, lhs.name)) {
+            return true;
+        }
+        return WritesTouch(*lhs.access, *rhs.access) || WritesTouch(*rhs.access, *lhs.access);
+    }
+} // namespace
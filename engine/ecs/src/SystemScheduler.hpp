@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+
+#include "ISystemManager.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * @class SystemScheduler
+     * @brief Groups the systems of a single phase into stages of systems that can run concurrently.
+     *
+     * Two systems conflict if one of them has no declared access, if one depends on the other, or if one writes a
+     * type the other reads or writes. A system is placed into the first stage after every earlier conflicting
+     * system, so executing the stages in order keeps the relative order of the SystemMetaSorter for all systems
+     * that touch the same data.
+     */
+    class SystemScheduler {
+    public:
+        /**
+         * Split the systems of one phase into stages.
+         * @param phase_metas The systems of one phase in the order produced by the SystemMetaSorter
+         * @return The stages in execution order, each holding indices into phase_metas
+         */
+        static std::vector<std::vector<std::size_t> > BuildStages(const std::vector<SystemMeta>& phase_metas);
+
+        /**
+         * Check if two systems must not run at the same time.
+         * @param lhs The first system
+         * @param rhs The second system
+         * @return True if both systems need to run one after another
+         */
+        static bool Conflicts(const SystemMeta& lhs, const SystemMeta& rhs);
+    };
+} // namespace
@@ -0,0 +1,81 @@
+#include "SystemTimingStats.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+namespace Engine::Ecs
+{
+    namespace
+    {
+        void WriteCsvRow(std::ostringstream& out, const std::string_view kind, const std::string_view name,
+                         const Phase phase, const TimingStats& time, const std::size_t entities)
+        {
+            out << kind << ',' << name << ',' << GetPhaseName(phase) << ',' << time.samples << ',' << time.min_ms
+                << ',' << time.avg_ms << ',' << time.max_ms << ',' << time.p99_ms << ',' << entities << '\n';
+        }
+
+        void WriteJsonString(std::ostringstream& out, const std::string_view value)
+        {
+            out << '"';
+            for (const auto c : value)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    out << '\\';
+                }
+                out << c;
+            }
+            out << '"';
+        }
+
+        void WriteJsonTiming(std::ostringstream& out, const TimingStats& time)
+        {
+            out << "\"samples\": " << time.samples << ", \"min_ms\": " << time.min_ms << ", \"avg_ms\": "
+                << time.avg_ms << ", \"max_ms\": " << time.max_ms << ", \"p99_ms\": " << time.p99_ms;
+        }
+    }
+
+    std::string SystemTimingReport::ToCsv() const
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(4);
+        out << "kind,name,phase,samples,min_ms,avg_ms,max_ms,p99_ms,entities\n";
+        for (const auto& [phase, time] : phases)
+        {
+            WriteCsvRow(out, "phase", GetPhaseName(phase), phase, time, 0);
+        }
+        for (const auto& [name, phase, time, queried_entities] : systems)
+        {
+            WriteCsvRow(out, "system", name, phase, time, queried_entities);
+        }
+        return out.str();
+    }
+
+    std::string SystemTimingReport::ToJson() const
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(4);
+        out << "{\n  \"phases\": [";
+        for (std::size_t i = 0; i < phases.size(); ++i)
+        {
+            out << (i == 0 ? "\n" : ",\n") << "    {\"phase\": ";
+            WriteJsonString(out, GetPhaseName(phases[i].phase));
+            out << ", ";
+            WriteJsonTiming(out, phases[i].time);
+            out << '}';
+        }
+        out << "\n  ],\n  \"systems\": [";
+        for (std::size_t i = 0; i < systems.size(); ++i)
+        {
+            out << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+            WriteJsonString(out, systems[i].name);
+            out << ", \"phase\": ";
+            WriteJsonString(out, GetPhaseName(systems[i].phase));
+            out << ", ";
+            WriteJsonTiming(out, systems[i].time);
+            out << ", \"entities\": " << systems[i].queried_entities << '}';
+        }
+        out << "\n  ]\n}\n";
+        return out.str();
+    }
+} // namespace
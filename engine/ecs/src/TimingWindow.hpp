@@ -0,0 +1,73 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "../include/SystemTimingStats.hpp"
+
+namespace Engine::Ecs
+{
+    /**
+     * @class TimingWindow
+     * @brief Ring buffer of the most recent duration samples. Recording is constant time, the statistics are only
+     * computed when requested.
+     */
+    class TimingWindow
+    {
+    public:
+        /**
+         * Five seconds at 60 frames per second.
+         */
+        static constexpr std::size_t DEFAULT_CAPACITY = 300;
+
+        explicit TimingWindow(const std::size_t capacity = DEFAULT_CAPACITY)
+        {
+            m_samples.reserve(capacity);
+            m_capacity = std::max<std::size_t>(capacity, 1);
+        }
+
+        void Record(const float milliseconds)
+        {
+            if (m_samples.size() < m_capacity)
+            {
+                m_samples.push_back(milliseconds);
+                return;
+            }
+            m_samples[m_next] = milliseconds;
+            m_next = (m_next + 1) % m_capacity;
+        }
+
+        [[nodiscard]] std::size_t Size() const { return m_samples.size(); }
+
+        [[nodiscard]] TimingStats GetStats() const
+        {
+            TimingStats stats{};
+            if (m_samples.empty())
+            {
+                return stats;
+            }
+
+            std::vector<float> sorted = m_samples;
+            std::ranges::sort(sorted);
+            float sum = 0.0f;
+            for (const auto sample : sorted)
+            {
+                sum += sample;
+            }
+            // Nearest rank: the smallest sample that is at least as large as 99% of all samples
+            const auto p99_rank = (sorted.size() * 99 + 99) / 100;
+
+            stats.min_ms = sorted.front();
+            stats.max_ms = sorted.back();
+            stats.avg_ms = sum / static_cast<float>(sorted.size());
+            stats.p99_ms = sorted[p99_rank - 1];
+            stats.samples = sorted.size();
+            return stats;
+        }
+
+    private:
+        std::vector<float> m_samples;
+        std::size_t m_capacity;
+        std::size_t m_next = 0;
+    };
+} // namespace
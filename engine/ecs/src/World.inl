@@ -1,31 +1,134 @@
 #pragma once
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
 #include "ComponentManager.hpp"
+#include "QueryCounter.hpp"
+#include "QueryRegistry.hpp"
+#include "ResourceStorage.hpp"
 
 namespace Engine::Ecs {
     struct World::WorldImpl {
         std::unique_ptr<EntityManager> entity_manager;
         std::unique_ptr<ComponentManager> component_manager;
+        std::unique_ptr<ResourceStorage> resources;
+        std::unique_ptr<QueryRegistry> queries;
+
+        /**
+         * Move the entity into or out of the registered queries after its signature changed.
+         */
+        void UpdateQueries(const EntityId entity) const {
+            if (!queries->Empty()) {
+                queries->OnSignatureChanged(entity, entity_manager->GetSignature(entity));
+            }
+        }
     };
 
-    inline World::World() : m_impl(std::make_unique<WorldImpl>()) {
+    inline World::World(const ComponentStorage storage) : m_impl(std::make_unique<WorldImpl>()) {
         m_impl->entity_manager = std::make_unique<EntityManager>();
-        m_impl->component_manager = std::make_unique<ComponentManager>();
+        m_impl->component_manager = std::make_unique<ComponentManager>(storage);
+        m_impl->resources = std::make_unique<ResourceStorage>();
+        m_impl->queries = std::make_unique<QueryRegistry>();
         m_ecs_event_buffer = std::make_unique<Buffer::EventBuffer<EcsEvent> >();
+        m_command_arena = std::make_unique<Buffer::CommandArena>();
         m_physics_event_buffer = std::make_unique<Buffer::EventBuffer<PhysicsEvent> >();
         m_component_event_bus = std::make_unique<ComponentEventBus>();
         m_physics_event_bus = std::make_unique<PhysicsEventBus>();
-        m_command_queue = std::make_unique<Buffer::SystemCommandQueue>();
+        m_command_bus = std::make_unique<CommandBus>();
     }
 
     inline World::~World() = default;
 
+    inline void World::RegisterComponentTypes(const std::span<const ComponentTypeInfo> types, const std::size_t capacity) {
+        ComponentManager::RegisterReflectedTypes(types, capacity);
+    }
+
     inline EntityId World::CreateEntity(const std::string& name) const {
+        std::lock_guard lock(m_structural_mutex);
         const auto entity = m_impl->entity_manager->ReserveEntity(name);
         const EcsEvent cmd{EcsEventType::CreateEntity, entity};
         m_ecs_event_buffer->EnqueueEvent(cmd);
         return entity;
     }
 
+    inline EntityId World::CreateEntity() const {
+        std::lock_guard lock(m_structural_mutex);
+        const auto entity = m_impl->entity_manager->ReserveEntity();
+        const EcsEvent cmd{EcsEventType::CreateEntity, entity};
+        m_ecs_event_buffer->EnqueueEvent(cmd);
+        return entity;
+    }
+
+    inline void World::CreateEntities(const std::size_t count, const std::span<EntityId> out) const {
+        if (out.size() < count) {
+            throw std::invalid_argument("World::CreateEntities: Output span is smaller than the entity count");
+        }
+        if (count == 0) {
+            return;
+        }
+
+        std::lock_guard lock(m_structural_mutex);
+        const auto entities = out.first(count);
+        m_impl->entity_manager->ReserveEntities(entities);
+
+        EcsEvent cmd{EcsEventType::CreateEntities};
+        cmd.entities = m_command_arena->CreateRange<EntityId>(entities);
+        cmd.count = count;
+        m_ecs_event_buffer->EnqueueEvent(cmd);
+    }
+
+    inline void World::Instantiate(const Prefab& prefab, const std::size_t count, const std::span<EntityId> out,
+                                   const PrefabOverrides& overrides) const {
+        if (out.size() < count) {
+            throw std::invalid_argument("World::Instantiate: Output span is smaller than the instance count");
+        }
+        for (const auto& component_override: overrides.m_overrides) {
+            if (component_override.count < count) {
+                throw std::invalid_argument("World::Instantiate: An override holds less values than instances");
+            }
+        }
+        if (count == 0) {
+            return;
+        }
+
+        std::lock_guard lock(m_structural_mutex);
+        const auto entities = out.first(count);
+        m_impl->entity_manager->ReserveEntities(entities);
+
+        std::vector<PrefabBatch::Component> components;
+        components.reserve(prefab.m_components.size() + overrides.m_overrides.size());
+        for (const auto& component: prefab.m_components) {
+            const auto is_overridden = std::ranges::any_of(overrides.m_overrides, [&component](const auto& value) {
+                return value.type == component.type;
+            });
+            if (!is_overridden) {
+                components.push_back({
+                    component.type->register_type(*m_impl->component_manager),
+                    component.type->copy_to_arena(*m_command_arena, component.value.get(), 1),
+                    false
+                });
+            }
+        }
+        for (const auto& [type, values, _]: overrides.m_overrides) {
+            components.push_back({
+                type->register_type(*m_impl->component_manager),
+                type->copy_to_arena(*m_command_arena, values, count),
+                true
+            });
+        }
+
+        PrefabBatch batch{};
+        batch.components = m_command_arena->CreateRange<PrefabBatch::Component>(components);
+        batch.component_count = components.size();
+
+        EcsEvent cmd{EcsEventType::InstantiatePrefab};
+        cmd.entities = m_command_arena->CreateRange<EntityId>(entities);
+        cmd.count = count;
+        cmd.payload = m_command_arena->Create(batch);
+        m_ecs_event_buffer->EnqueueEvent(cmd);
+    }
+
     inline void World::DestroyEntity(const EntityId entity) const {
         const EcsEvent cmd{EcsEventType::DestroyEntity, entity};
         m_ecs_event_buffer->EnqueueEvent(cmd);
@@ -39,13 +142,51 @@ namespace Engine::Ecs {
         ApplyEngineEvents();
     }
 
-    inline EntityId World::GetEntityByName(const std::string& name) const {
+    inline void World::Reset() const {
+        {
+            std::lock_guard lock(m_structural_mutex);
+            m_ecs_event_buffer->ClearEvents();
+            m_physics_event_buffer->ClearEvents();
+            m_command_bus->ClearPending();
+            m_command_arena->Reset();
+            m_impl->component_manager->Reset();
+            m_impl->entity_manager->Reset();
+            m_impl->resources->Clear(GetChangeTick());
+            m_impl->queries->ClearEntities();
+        }
+        m_component_event_bus->RaiseWorldResetEvent();
+    }
+
+    inline void World::ClearSubscriptions() const {
+        m_component_event_bus->Clear();
+        m_physics_event_bus->Clear();
+    }
+
+    inline EntityId World::GetEntityByName(const std::string_view name) const {
+        return GetEntityByName(HashName(name));
+    }
+
+    inline EntityId World::GetEntityByName(const NameId name) const {
+        std::shared_lock lock(m_structural_mutex);
         return m_impl->entity_manager->GetEntityByName(name);
     }
 
+    inline EntityId World::Resolve(NamedEntity& handle) const {
+        const auto cached = handle.m_entity;
+        {
+            std::shared_lock lock(m_structural_mutex);
+            if (m_impl->entity_manager->IsEntityAlive(cached) || m_impl->entity_manager->IsEntityPending(cached)) {
+                return cached;
+            }
+        }
+        handle.m_entity = GetEntityByName(handle.m_name);
+        return handle.m_entity;
+    }
+
 
     template<typename T>
     void World::AddComponent(EntityId entity, T component) {
+        std::lock_guard lock(m_structural_mutex);
         if (!m_impl->entity_manager->IsEntityAlive(entity) &&
             !m_impl->entity_manager->IsEntityPending(entity)) {
             return;
@@ -53,14 +194,49 @@ namespace Engine::Ecs {
 
         const auto id = m_impl->component_manager->RegisterType<T>();
 
-        EcsEvent cmd{EcsEventType::AddComponent, entity, id};
-        cmd.payload = std::vector<std::byte>(sizeof(T));
-        new(cmd.payload.data()) T(component);
-        m_ecs_event_buffer->EnqueueEvent(std::move(cmd));
+        const EcsEvent cmd{EcsEventType::AddComponent, entity, id, m_command_arena->Create<T>(std::move(component))};
+        m_ecs_event_buffer->EnqueueEvent(cmd);
+    }
+
+    template<typename T>
+    void World::AddComponents(const std::span<const EntityId> entities, const std::span<const T> components) {
+        if (entities.size() != components.size()) {
+            throw std::invalid_argument("World::AddComponents: The number of entities and components differs");
+        }
+        if (entities.empty()) {
+            return;
+        }
+
+        std::lock_guard lock(m_structural_mutex);
+        const auto is_known = [this](const EntityId entity) {
+            return m_impl->entity_manager->IsEntityAlive(entity) || m_impl->entity_manager->IsEntityPending(entity);
+        };
+        const auto id = m_impl->component_manager->RegisterType<T>();
+
+        EcsEvent cmd{EcsEventType::AddComponents, INVALID_ENTITY_ID, id};
+        if (std::ranges::all_of(entities, is_known)) {
+            cmd.entities = m_command_arena->CreateRange(entities);
+            cmd.payload = m_command_arena->CreateRange(components);
+            cmd.count = entities.size();
+        } else {
+            std::vector<EntityId> known_entities;
+            std::vector<T> known_components;
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                if (is_known(entities[i])) {
+                    known_entities.push_back(entities[i]);
+                    known_components.push_back(components[i]);
+                }
+            }
+            cmd.entities = m_command_arena->CreateRange<EntityId>(known_entities);
+            cmd.payload = m_command_arena->CreateRange<T>(known_components);
+            cmd.count = known_entities.size();
+        }
+        m_ecs_event_buffer->EnqueueEvent(cmd);
     }
 
     template<typename T>
     void World::RemoveComponent(const EntityId entity) const {
+        std::lock_guard lock(m_structural_mutex);
         if (!m_impl->entity_manager->IsEntityAlive(entity) &&
             !m_impl->entity_manager->IsEntityPending(entity)) {
             return;
@@ -90,28 +266,29 @@ namespace Engine::Ecs {
         }
         m_physics_event_buffer->ClearEvents();
 
-        for (const auto& [type, entity, component_type_id, payload]: m_ecs_event_buffer->Get()) {
+        for (const auto& [type, entity, component_type_id, payload, entities, count]: m_ecs_event_buffer->Get()) {
             switch (type) {
                 case EcsEventType::CreateEntity: {
                     m_impl->entity_manager->CommitEntity(entity);
                     break;
                 }
                 case EcsEventType::DestroyEntity: {
-                    auto components_of_entity = m_impl->component_manager->GetAllComponentsOfEntity(entity);
-                    for (const auto& component: components_of_entity) {
-                        if (component.on_remove_event) {
-                            component.on_remove_event(*m_component_event_bus, entity);
-                        }
-                    }
-                    m_impl->component_manager->OnDestroyEntity(entity);
+                    // Copied, destroying the entity clears its signature
+                    const auto signature = m_impl->entity_manager->GetSignature(entity);
+                    m_impl->component_manager->RemoveBySignature(entity, signature, *m_component_event_bus);
                     m_impl->entity_manager->DestroyEntity(entity);
+                    m_impl->UpdateQueries(entity);
                     break;
                 }
                 case EcsEventType::AddComponent: {
                     const ComponentMeta component_meta = m_impl->component_manager->GetComponentMeta(component_type_id);
-                    m_impl->component_manager->AddById(entity, component_type_id, payload.data());
+                    const void* component = m_impl->component_manager->EmplaceById(entity, component_type_id, payload);
+                    if (component != nullptr) {
+                        m_impl->entity_manager->AddToSignature(entity, component_type_id);
+                        m_impl->UpdateQueries(entity);
+                    }
                     if (component_meta.on_add_event) {
-                        component_meta.on_add_event(*m_component_event_bus, entity, payload.data());
+                        component_meta.on_add_event(*m_component_event_bus, entity, component);
                     }
 
                     break;
@@ -119,23 +296,133 @@ namespace Engine::Ecs {
                 case EcsEventType::RemoveComponent: {
                     const ComponentMeta component_meta = m_impl->component_manager->GetComponentMeta(component_type_id);
                     m_impl->component_manager->RemoveById(entity, component_type_id);
+                    m_impl->entity_manager->RemoveFromSignature(entity, component_type_id);
+                    m_impl->UpdateQueries(entity);
                     if (component_meta.on_remove_event) {
                         component_meta.on_remove_event(*m_component_event_bus, entity);
                     }
                     break;
                 }
                 case EcsEventType::UpdateComponent: {
-                    m_impl->component_manager->SetById(entity, component_type_id, payload.data());
+                    m_impl->component_manager->SetById(entity, component_type_id, payload);
+                    m_impl->entity_manager->AddToSignature(entity, component_type_id);
+                    m_impl->UpdateQueries(entity);
+                    break;
+                }
+                case EcsEventType::CreateEntities: {
+                    m_impl->entity_manager->CommitEntities({entities, count});
+                    break;
+                }
+                case EcsEventType::AddComponents: {
+                    m_impl->component_manager->EmplaceRangeById({entities, count}, component_type_id, payload,
+                                                                m_component_event_bus.get());
+                    for (std::size_t i = 0; i < count; ++i) {
+                        m_impl->entity_manager->AddToSignature(entities[i], component_type_id);
+                        m_impl->UpdateQueries(entities[i]);
+                    }
+                    break;
+                }
+                case EcsEventType::InstantiatePrefab: {
+                    const std::span instances(entities, count);
+                    m_impl->entity_manager->CommitEntities(instances);
+                    const auto& batch = *static_cast<const PrefabBatch*>(payload);
+                    const std::span components(batch.components, batch.component_count);
+                    m_impl->component_manager->AddRangesById(instances, components);
+                    for (const auto& component: components) {
+                        for (const auto instance: instances) {
+                            m_impl->entity_manager->AddToSignature(instance, component.component_type_id);
+                        }
+                    }
+                    for (const auto instance: instances) {
+                        m_impl->UpdateQueries(instance);
+                    }
+                    // Raised once all pools are written, so subscribers can fetch the other components of the
+                    // instances
+                    for (const auto& component: components) {
+                        m_impl->component_manager->RaiseAddEventsById(instances, component.component_type_id,
+                                                                      *m_component_event_bus);
+                    }
+                    break;
                 }
                 default:
                     throw std::runtime_error("Unhandled command type");
             }
         }
         m_ecs_event_buffer->ClearEvents();
+        m_command_arena->Reset();
+        m_impl->queries->Sort();
+    }
+
+    inline WorldSnapshot World::Snapshot() const {
+        std::lock_guard lock(m_structural_mutex);
+        if (!m_ecs_event_buffer->Get().empty()) {
+            throw std::logic_error("World::Snapshot: Structural changes are queued, apply the engine events first");
+        }
+
+        std::vector<std::byte> data;
+        SnapshotWriter writer(data);
+        writer.Write<uint32_t>(WorldSnapshot::MAGIC);
+        writer.Write<uint32_t>(WorldSnapshot::VERSION);
+        m_impl->entity_manager->Serialize(writer);
+        m_impl->component_manager->Serialize(writer);
+        return WorldSnapshot(std::move(data));
+    }
+
+    inline void World::Restore(const WorldSnapshot& snapshot) const {
+        if (m_impl->component_manager->GetStorage() == ComponentStorage::Archetype) {
+            throw std::logic_error("World::Restore: Snapshots are not supported by the archetype storage");
+        }
+        SnapshotReader reader(snapshot.GetData());
+        if (reader.Read<uint32_t>() != WorldSnapshot::MAGIC) {
+            throw std::runtime_error("World::Restore: Data is not a world snapshot");
+        }
+        if (reader.Read<uint32_t>() != WorldSnapshot::VERSION) {
+            throw std::runtime_error("World::Restore: Snapshot was written by another version");
+        }
+
+        // Decode everything before touching the world, so a corrupt snapshot leaves it unchanged
+        auto entity_manager = std::make_unique<EntityManager>();
+        std::vector<std::unique_ptr<IComponentPool>> pools;
+        {
+            std::lock_guard lock(m_structural_mutex);
+            entity_manager->Deserialize(reader);
+            pools = m_impl->component_manager->Deserialize(reader);
+        }
+        if (!reader.AtEnd()) {
+            throw std::runtime_error("World::Restore: Snapshot has trailing data");
+        }
+
+        m_impl->component_manager->RaiseRemoveEvents(*m_component_event_bus);
+        {
+            std::lock_guard lock(m_structural_mutex);
+            m_ecs_event_buffer->ClearEvents();
+            m_command_arena->Reset();
+            m_impl->component_manager->Restore(pools);
+            m_impl->entity_manager = std::move(entity_manager);
+            m_impl->component_manager->ForEachPool([this](const ComponentTypeId id, const IComponentPool& pool) {
+                for (const auto entity: pool.GetEntities()) {
+                    m_impl->entity_manager->AddToSignature(entity, id);
+                }
+            });
+            m_impl->queries->ClearEntities();
+            for (const auto entity: m_impl->entity_manager->GetAllActiveEntities()) {
+                m_impl->UpdateQueries(entity);
+            }
+            m_impl->queries->Sort();
+        }
+        m_impl->component_manager->RaiseAddEvents(*m_component_event_bus);
+    }
+
+    template<typename... Ts>
+    bool World::HasComponents(const EntityId entity) const {
+        std::shared_lock lock(m_structural_mutex);
+        return m_impl->entity_manager->GetSignature(entity).ContainsAll(
+            ComponentManager::GetSignature<std::remove_const_t<Ts>...>());
     }
 
     template<typename T>
     T* World::GetComponent(const EntityId entity) {
+        std::shared_lock lock(m_structural_mutex);
         if (!m_impl->entity_manager->IsEntityAlive(entity)) {
             return nullptr;
         }
@@ -148,15 +435,153 @@ namespace Engine::Ecs {
     }
 
     template<typename T>
-    std::vector<std::pair<T*, EntityId> > World::GetComponentsOfType() {
-        const auto entities = m_impl->entity_manager->GetAllActiveEntities();
-        std::vector<std::pair<T*, EntityId> > components;
-        for (const auto& entity: entities) {
-            if (m_impl->component_manager->HasComponent<T>(entity)) {
-                auto component = m_impl->component_manager->GetComponent<T>(entity);
-                components.emplace_back(std::make_pair(component, entity));
+    ComponentView<T> World::GetComponentView() {
+        std::shared_lock lock(m_structural_mutex);
+        auto view = m_impl->component_manager->GetComponentView<T>();
+        QueryCounter::Add(view.Size());
+        return view;
+    }
+
+    template<typename... Ts, typename... Ex>
+    EntityView<Exclude<Ex...>, Ts...> World::View(Exclude<Ex...> exclude) {
+        std::shared_lock lock(m_structural_mutex);
+        auto view = m_impl->component_manager->GetEntityView<Ts...>(exclude);
+        QueryCounter::Add(view.SizeHint());
+        return view;
+    }
+
+    template<typename... Ts, typename... Ex>
+    Query<Exclude<Ex...>, Ts...> World::RegisterQuery(Exclude<Ex...> exclude) {
+        if (m_impl->component_manager->GetStorage() == ComponentStorage::Archetype) {
+            throw std::logic_error("World::RegisterQuery: Queries are not supported by the archetype storage");
+        }
+        std::lock_guard lock(m_structural_mutex);
+        const auto& required = ComponentManager::GetSignature<std::remove_const_t<Ts>...>();
+        const auto& excluded = ComponentManager::GetSignature<std::remove_const_t<Ex>...>();
+        auto* entry = m_impl->queries->Find(required, excluded);
+        if (entry == nullptr) {
+            entry = &m_impl->queries->Create(required, excluded);
+            for (const auto& tuple: m_impl->component_manager->GetEntityView<Ts...>(exclude)) {
+                QueryRegistry::Add(*entry, std::get<0>(tuple));
             }
+            QueryRegistry::Sort(*entry);
         }
-        return components;
+        return m_impl->component_manager->GetQuery<Ts...>(*entry, exclude);
+    }
+
+    template<typename T>
+    std::vector<std::pair<T*, EntityId> > World::GetComponentsOfType() {
+        const auto view = GetComponentView<T>();
+        return {view.begin(), view.end()};
+    }
+
+    template<typename T>
+    T* World::Modify(const EntityId entity) {
+        std::shared_lock lock(m_structural_mutex);
+        if (!m_impl->entity_manager->IsEntityAlive(entity) || !m_impl->component_manager->HasComponent<T>(entity)) {
+            return nullptr;
+        }
+        m_impl->component_manager->MarkChanged<T>(entity);
+        return m_impl->component_manager->GetComponent<T>(entity);
+    }
+
+    template<typename T>
+    void World::MarkChanged(const EntityId entity) {
+        std::shared_lock lock(m_structural_mutex);
+        if (!m_impl->entity_manager->IsEntityAlive(entity)) {
+            return;
+        }
+        m_impl->component_manager->MarkChanged<T>(entity);
+    }
+
+    template<typename T>
+    ChangedView<T> World::Added(const ChangeTick since) {
+        std::shared_lock lock(m_structural_mutex);
+        return m_impl->component_manager->GetAddedView<T>(since);
+    }
+
+    template<typename T>
+    ChangedView<T> World::Changed(const ChangeTick since) {
+        std::shared_lock lock(m_structural_mutex);
+        return m_impl->component_manager->GetChangedView<T>(since);
+    }
+
+    template<typename T>
+    ChangeLogView World::Removed(const ChangeTick since) {
+        std::shared_lock lock(m_structural_mutex);
+        return m_impl->component_manager->GetRemovedView<T>(since);
+    }
+
+    inline ChangeTick World::AdvanceChangeTick() const {
+        return m_impl->component_manager->AdvanceChangeTick();
+    }
+
+    inline ChangeTick World::GetChangeTick() const {
+        return m_impl->component_manager->GetChangeTick();
+    }
+
+    inline void World::TrimChanges(const ChangeTick oldest_tick) const {
+        m_impl->component_manager->TrimChanges(oldest_tick);
+    }
+
+    template<typename T>
+    void World::SetResource(T resource) const {
+        m_impl->resources->Set<T>(std::move(resource), GetChangeTick());
+    }
+
+    template<typename T>
+    const T* World::GetResource() const {
+        return m_impl->resources->Get<T>();
+    }
+
+    template<typename T>
+    T* World::ModifyResource() const {
+        return m_impl->resources->Modify<T>(GetChangeTick());
+    }
+
+    template<typename T>
+    void World::RemoveResource() const {
+        m_impl->resources->Remove<T>(GetChangeTick());
+    }
+
+    template<typename T>
+    bool World::IsResourceChanged(const ChangeTick since) const {
+        return m_impl->resources->IsChanged<T>(since);
+    }
+
+    inline WorldMemoryStats World::GetMemoryStats() const {
+        std::lock_guard lock(m_structural_mutex);
+        WorldMemoryStats stats{};
+        const auto& component_manager = *m_impl->component_manager;
+        component_manager.ForEachPool([&](const ComponentTypeId id, const IComponentPool& pool) {
+            stats.components.push_back(ComponentMemoryStats{
+                .type_id = id,
+                .name = std::string(component_manager.GetComponentMeta(id).display_name),
+                .usage = pool.GetMemoryUsage(),
+            });
+        });
+        stats.entities = m_impl->entity_manager->GetMemoryStats();
+
+        const auto add_event_buffer = [&stats]<typename T>(const std::string& name,
+                                                           const Buffer::EventBuffer<T>& event_buffer) {
+            const auto& events = event_buffer.Get();
+            stats.event_buffers.push_back(EventBufferMemoryStats{
+                .name = name,
+                .queued = events.size(),
+                .capacity = events.capacity(),
+                .high_water_mark = event_buffer.GetHighWaterMark(),
+                .bytes = events.capacity() * sizeof(T),
+            });
+        };
+        add_event_buffer("ecs_events", *m_ecs_event_buffer);
+        add_event_buffer("physics_events", *m_physics_event_buffer);
+
+        stats.command_arena = CommandArenaMemoryStats{
+            .blocks = m_command_arena->GetBlockCount(),
+            .used_bytes = m_command_arena->GetUsedBytes(),
+            .high_water_bytes = m_command_arena->GetHighWaterBytes(),
+            .reserved_bytes = m_command_arena->GetReservedBytes(),
+        };
+        return stats;
     }
 } // namespace
@@ -0,0 +1,65 @@
+#include "WorldMemoryStats.hpp"
+
+#include <sstream>
+
+namespace Engine::Ecs {
+    namespace {
+        void WriteJsonString(std::ostringstream& out, const std::string_view value) {
+            out << '"';
+            for (const auto c: value) {
+                if (c == '"' || c == '\\') {
+                    out << '\\';
+                }
+                out << c;
+            }
+            out << '"';
+        }
+    }
+
+    std::size_t WorldMemoryStats::GetComponentBytes() const {
+        std::size_t bytes = 0;
+        for (const auto& component: components) {
+            bytes += component.usage.dense_bytes + component.usage.sparse_bytes + component.usage.change_log_bytes;
+        }
+        return bytes;
+    }
+
+    std::size_t WorldMemoryStats::GetTotalBytes() const {
+        std::size_t bytes = GetComponentBytes() + entities.table_bytes + entities.name_bytes +
+                            command_arena.reserved_bytes;
+        for (const auto& event_buffer: event_buffers) {
+            bytes += event_buffer.bytes;
+        }
+        return bytes;
+    }
+
+    std::string WorldMemoryStats::ToJson() const {
+        std::ostringstream out;
+        out << "{\n  \"total_bytes\": " << GetTotalBytes() << ",\n  \"components\": [";
+        for (std::size_t i = 0; i < components.size(); ++i) {
+            const auto& [type_id, name, usage] = components[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"type_id\": " << type_id << ", \"name\": ";
+            WriteJsonString(out, name);
+            out << ", \"count\": " << usage.component_count << ", \"capacity\": " << usage.component_capacity
+                << ", \"dense_bytes\": " << usage.dense_bytes << ", \"sparse_pages\": " << usage.sparse_pages
+                << ", \"sparse_bytes\": " << usage.sparse_bytes << ", \"change_log_bytes\": "
+                << usage.change_log_bytes << '}';
+        }
+        out << "\n  ],\n  \"entities\": {\"capacity\": " << entities.capacity << ", \"alive\": " << entities.alive
+            << ", \"pending\": " << entities.pending << ", \"free_indices\": " << entities.free_indices
+            << ", \"named\": " << entities.named << ", \"table_bytes\": " << entities.table_bytes
+            << ", \"name_bytes\": " << entities.name_bytes << "},\n  \"event_buffers\": [";
+        for (std::size_t i = 0; i < event_buffers.size(); ++i) {
+            const auto& event_buffer = event_buffers[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+            WriteJsonString(out, event_buffer.name);
+            out << ", \"queued\": " << event_buffer.queued << ", \"capacity\": " << event_buffer.capacity
+                << ", \"high_water_mark\": " << event_buffer.high_water_mark << ", \"bytes\": " << event_buffer.bytes
+                << '}';
+        }
+        out << "\n  ],\n  \"command_arena\": {\"blocks\": " << command_arena.blocks << ", \"used_bytes\": "
+            << command_arena.used_bytes << ", \"high_water_bytes\": " << command_arena.high_water_bytes
+            << ", \"reserved_bytes\": " << command_arena.reserved_bytes << "}\n}\n";
+        return out.str();
+    }
+} // namespace
@@ -0,0 +1,32 @@
+#include "WorldSnapshot.hpp"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace Engine::Ecs {
+    void WorldSnapshot::SaveToFile(const std::filesystem::path& path) const {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("WorldSnapshot: Failed to open " + path.string() + " for writing");
+        }
+        file.write(reinterpret_cast<const char*>(m_data.data()), static_cast<std::streamsize>(m_data.size()));
+        if (!file) {
+            throw std::runtime_error("WorldSnapshot: Failed to write " + path.string());
+        }
+    }
+
+    WorldSnapshot WorldSnapshot::LoadFromFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("WorldSnapshot: Failed to open " + path.string() + " for reading");
+        }
+        const auto size = static_cast<std::size_t>(file.tellg());
+        std::vector<std::byte> data(size);
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size));
+        if (!file) {
+            throw std::runtime_error("WorldSnapshot: Failed to read " + path.string());
+        }
+        return WorldSnapshot(std::move(data));
+    }
+} // namespace
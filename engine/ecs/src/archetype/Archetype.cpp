@@ -0,0 +1,135 @@
+#include "Archetype.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Engine::Ecs {
+    Archetype::Archetype(std::vector<ArchetypeComponentId> signature,
+                         std::vector<ArchetypeComponentInfo> component_infos) : m_signature(std::move(signature)),
+                                                                                m_component_infos(
+                                                                                    std::move(component_infos)) {
+        CalculateLayout();
+    }
+
+    Archetype::~Archetype() {
+        Clear();
+    }
+
+    std::size_t Archetype::GetColumn(const ArchetypeComponentId component_id) const {
+        const auto it = std::ranges::lower_bound(m_signature, component_id);
+        if (it == m_signature.end() || *it != component_id) {
+            return NO_COLUMN;
+        }
+        return static_cast<std::size_t>(it - m_signature.begin());
+    }
+
+    std::size_t Archetype::GetRowCount(const std::size_t chunk) const {
+        const std::size_t first_row = chunk * m_chunk_capacity;
+        if (first_row >= m_row_count) {
+            return 0;
+        }
+        return std::min(m_chunk_capacity, m_row_count - first_row);
+    }
+
+    EntityId* Archetype::GetEntities(const std::size_t chunk) const {
+        return reinterpret_cast<EntityId*>(m_chunks[chunk]->data.data());
+    }
+
+    void* Archetype::GetColumnData(const std::size_t chunk, const std::size_t column) const {
+        return m_chunks[chunk]->data.data() + m_column_offsets[column];
+    }
+
+    void* Archetype::GetComponent(const std::size_t row, const std::size_t column) const {
+        const auto chunk = row / m_chunk_capacity;
+        const auto index = row % m_chunk_capacity;
+        return static_cast<std::byte*>(GetColumnData(chunk, column)) + index * m_component_infos[column].size;
+    }
+
+    EntityId Archetype::GetEntity(const std::size_t row) const {
+        return GetEntities(row / m_chunk_capacity)[row % m_chunk_capacity];
+    }
+
+    std::size_t Archetype::AllocateRow(const EntityId entity) {
+        if (m_row_count == m_chunks.size() * m_chunk_capacity) {
+            m_chunks.push_back(std::make_unique<ArchetypeChunk>());
+        }
+        const auto row = m_row_count++;
+        GetEntities(row / m_chunk_capacity)[row % m_chunk_capacity] = entity;
+        return row;
+    }
+
+    EntityId Archetype::RemoveRow(const std::size_t row) {
+        if (row >= m_row_count) {
+            throw std::out_of_range("Archetype::RemoveRow: Row does not exist");
+        }
+
+        const auto last_row = m_row_count - 1;
+        for (std::size_t column = 0; column < m_component_infos.size(); ++column) {
+            const auto& info = m_component_infos[column];
+            info.destroy(GetComponent(row, column));
+            if (row != last_row) {
+                void* last_component = GetComponent(last_row, column);
+                info.move_construct(GetComponent(row, column), last_component);
+                info.destroy(last_component);
+            }
+        }
+
+        EntityId moved_entity = INVALID_ENTITY_ID;
+        if (row != last_row) {
+            moved_entity = GetEntity(last_row);
+            GetEntities(row / m_chunk_capacity)[row % m_chunk_capacity] = moved_entity;
+        }
+        m_row_count--;
+        return moved_entity;
+    }
+
+    void Archetype::Clear() {
+        while (m_row_count > 0) {
+            RemoveRow(m_row_count - 1);
+        }
+    }
+
+    Archetype* Archetype::GetAddEdge(const ArchetypeComponentId component_id) const {
+        const auto it = m_add_edges.find(component_id);
+        return it == m_add_edges.end() ? nullptr : it->second;
+    }
+
+    Archetype* Archetype::GetRemoveEdge(const ArchetypeComponentId component_id) const {
+        const auto it = m_remove_edges.find(component_id);
+        return it == m_remove_edges.end() ? nullptr : it->second;
+    }
+
+    void Archetype::CalculateLayout() {
+        std::size_t row_size = sizeof(EntityId);
+        for (const auto& info: m_component_infos) {
+            if (info.alignment > alignof(ArchetypeChunk)) {
+                throw std::invalid_argument("Archetype: Component alignment exceeds the chunk alignment");
+            }
+            row_size += info.size;
+        }
+
+        const auto align_up = [](const std::size_t value, const std::size_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        };
+
+        std::size_t capacity = ARCHETYPE_CHUNK_SIZE / row_size;
+        while (capacity > 0) {
+            m_column_offsets.clear();
+            std::size_t offset = capacity * sizeof(EntityId);
+            for (const auto& info: m_component_infos) {
+                offset = align_up(offset, info.alignment);
+                m_column_offsets.push_back(offset);
+                offset += capacity * info.size;
+            }
+            if (offset <= ARCHETYPE_CHUNK_SIZE) {
+                break;
+            }
+            capacity--;
+        }
+
+        if (capacity == 0) {
+            throw std::invalid_argument("Archetype: Components of the archetype do not fit into a single chunk");
+        }
+        m_chunk_capacity = capacity;
+    }
+} // namespace
@@ -0,0 +1,137 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "../Entity.hpp"
+
+namespace Engine::Ecs {
+    using ArchetypeComponentId = std::size_t;
+
+    /**
+     * Type erased information about a component type stored in an archetype.
+     */
+    struct ArchetypeComponentInfo {
+        std::size_t size = 0;
+        std::size_t alignment = 0;
+
+        void (*move_construct)(void* destination, void* source) = nullptr;
+
+        /**
+         * Null if the component type can not be copied.
+         */
+        void (*copy_construct)(void* destination, const void* source) = nullptr;
+
+        void (*destroy)(void* component) = nullptr;
+    };
+
+    constexpr std::size_t ARCHETYPE_CHUNK_SIZE = 16 * 1024;
+
+    /**
+     * Fixed size memory block holding the rows of an archetype in SoA layout.
+     * The first array holds the entity ids, followed by one array per component type.
+     */
+    struct alignas(64) ArchetypeChunk {
+        std::array<std::byte, ARCHETYPE_CHUNK_SIZE> data;
+    };
+
+    /**
+     * @class Archetype
+     * @brief Stores all entities sharing the exact same set of component types.
+     *
+     * Rows are packed without gaps across fixed size chunks. Row r lives in chunk r / capacity at position
+     * r % capacity. Removing a row moves the last row into the freed slot.
+     */
+    class Archetype {
+    public:
+        Archetype(std::vector<ArchetypeComponentId> signature, std::vector<ArchetypeComponentInfo> component_infos);
+
+        ~Archetype();
+
+        Archetype(const Archetype&) = delete;
+
+        Archetype& operator=(const Archetype&) = delete;
+
+        [[nodiscard]] const std::vector<ArchetypeComponentId>& GetSignature() const { return m_signature; }
+
+        /**
+         * Get the column index of a component type within this archetype.
+         * @param component_id The component type id
+         * @return The column index or NO_COLUMN if the type is not part of the archetype
+         */
+        [[nodiscard]] std::size_t GetColumn(ArchetypeComponentId component_id) const;
+
+        [[nodiscard]] bool Contains(const ArchetypeComponentId component_id) const {
+            return GetColumn(component_id) != NO_COLUMN;
+        }
+
+        [[nodiscard]] std::size_t GetChunkCapacity() const { return m_chunk_capacity; }
+
+        [[nodiscard]] std::size_t GetChunkCount() const { return m_chunks.size(); }
+
+        [[nodiscard]] std::size_t GetRowCount() const { return m_row_count; }
+
+        /**
+         * Get the number of occupied rows in a chunk.
+         * @param chunk The chunk index
+         * @return The number of rows in use
+         */
+        [[nodiscard]] std::size_t GetRowCount(std::size_t chunk) const;
+
+        [[nodiscard]] EntityId* GetEntities(std::size_t chunk) const;
+
+        [[nodiscard]] void* GetColumnData(std::size_t chunk, std::size_t column) const;
+
+        [[nodiscard]] void* GetComponent(std::size_t row, std::size_t column) const;
+
+        [[nodiscard]] EntityId GetEntity(std::size_t row) const;
+
+        /**
+         * Reserve a new row at the end of the archetype. The component memory of the row is left uninitialized
+         * and must be constructed by the caller.
+         * @param entity The entity owning the new row
+         * @return The row index
+         */
+        std::size_t AllocateRow(EntityId entity);
+
+        /**
+         * Destroy the components of a row and fill the gap with the last row.
+         * @param row The row to remove
+         * @return The entity that was moved into the row, or INVALID_ENTITY_ID if no row was moved
+         */
+        EntityId RemoveRow(std::size_t row);
+
+        /**
+         * Destroy the components of all rows, keeping the chunks for the rows added afterwards.
+         */
+        void Clear();
+
+        Archetype* GetAddEdge(ArchetypeComponentId component_id) const;
+
+        Archetype* GetRemoveEdge(ArchetypeComponentId component_id) const;
+
+        void SetAddEdge(const ArchetypeComponentId component_id, Archetype* archetype) {
+            m_add_edges[component_id] = archetype;
+        }
+
+        void SetRemoveEdge(const ArchetypeComponentId component_id, Archetype* archetype) {
+            m_remove_edges[component_id] = archetype;
+        }
+
+        static constexpr std::size_t NO_COLUMN = static_cast<std::size_t>(-1);
+
+    private:
+        void CalculateLayout();
+
+        std::vector<ArchetypeComponentId> m_signature;
+        std::vector<ArchetypeComponentInfo> m_component_infos;
+        std::vector<std::size_t> m_column_offsets;
+        std::vector<std::unique_ptr<ArchetypeChunk> > m_chunks;
+        std::size_t m_chunk_capacity = 0;
+        std::size_t m_row_count = 0;
+        std::unordered_map<ArchetypeComponentId, Archetype*> m_add_edges;
+        std::unordered_map<ArchetypeComponentId, Archetype*> m_remove_edges;
+    };
+} // namespace
@@ -0,0 +1,244 @@
+#include "ArchetypeStorage.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Engine::Ecs {
+    ArchetypeStorage::ArchetypeStorage() = default;
+
+    ArchetypeStorage::~ArchetypeStorage() = default;
+
+    void ArchetypeStorage::OnDestroyEntity(const EntityId entity) {
+        const auto record = FindRecord(entity);
+        if (record == nullptr) {
+            return;
+        }
+        RemoveFromArchetype(*record);
+        m_records[GetEntityIndex(entity)] = EntityRecord{};
+    }
+
+    void ArchetypeStorage::Clear() {
+        for (const auto& archetype: m_archetypes) {
+            archetype->Clear();
+        }
+        m_records.clear();
+    }
+
+    std::span<const EntityId> ArchetypeStorage::AddComponents(const std::span<const EntityId> entities,
+                                                              const std::span<const ArchetypeComponentRange> components) {
+        m_added_entities.clear();
+        Archetype* source = nullptr;
+        Archetype* target = nullptr;
+        bool moves = false;
+        bool has_target = false;
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            const auto entity = entities[i];
+            auto& record = GetOrCreateRecord(entity);
+            // The entities of a batch usually share their archetype, e.g. freshly instantiated prefabs own none
+            if (!has_target || record.archetype != source) {
+                source = record.archetype;
+                moves = UpdateRangeTarget(source, components, target);
+                has_target = true;
+            }
+            if (!moves) {
+                continue;
+            }
+
+            MoveEntity(entity, record, target);
+            for (std::size_t c = 0; c < components.size(); ++c) {
+                if (m_range_columns[c] == Archetype::NO_COLUMN) {
+                    continue;
+                }
+                const auto& [component_id, values, per_entity] = components[c];
+                const auto& info = m_component_infos[component_id];
+                void* destination = target->GetComponent(record.row, m_range_columns[c]);
+                if (per_entity) {
+                    info.move_construct(destination, static_cast<std::byte*>(values) + i * info.size);
+                } else {
+                    info.copy_construct(destination, values);
+                }
+            }
+            m_added_entities.push_back(entity);
+        }
+        return m_added_entities;
+    }
+
+    const Archetype* ArchetypeStorage::GetArchetype(const EntityId entity) const {
+        const auto record = FindRecord(entity);
+        return record != nullptr ? record->archetype : nullptr;
+    }
+
+    std::size_t ArchetypeStorage::GetEntityCount() const {
+        std::size_t count = 0;
+        for (const auto& archetype: m_archetypes) {
+            count += archetype->GetRowCount();
+        }
+        return count;
+    }
+
+    ArchetypeComponentId ArchetypeStorage::NextComponentTypeId() {
+        // Lookups from parallel systems only hold the world lock shared, so they can assign ids concurrently
+        static std::atomic<ArchetypeComponentId> next = 0;
+        return next.fetch_add(1);
+    }
+
+    std::size_t ArchetypeStorage::NextMatchId() {
+        static std::atomic<std::size_t> next = 0;
+        return next.fetch_add(1);
+    }
+
+    void ArchetypeStorage::UpdateMatch(ArchetypeMatch& match) const {
+        for (; match.checked < m_archetypes.size(); ++match.checked) {
+            const Archetype* archetype = m_archetypes[match.checked].get();
+            const auto is_excluded = std::ranges::any_of(match.excluded, [archetype](const auto component_id) {
+                return archetype->Contains(component_id);
+            });
+            if (is_excluded) {
+                continue;
+            }
+
+            const auto first_column = match.columns.size();
+            for (const auto component_id: match.required) {
+                match.columns.push_back(archetype->GetColumn(component_id));
+            }
+            if (std::ranges::find(match.columns.begin() + static_cast<std::ptrdiff_t>(first_column),
+                                  match.columns.end(), Archetype::NO_COLUMN) != match.columns.end()) {
+                match.columns.resize(first_column);
+                continue;
+            }
+            match.archetypes.push_back(archetype);
+        }
+    }
+
+    const ArchetypeStorage::EntityRecord* ArchetypeStorage::FindRecord(const EntityId entity) const {
+        const auto index = GetEntityIndex(entity);
+        if (index >= m_records.size()) {
+            return nullptr;
+        }
+        const auto& record = m_records[index];
+        if (record.archetype == nullptr || record.archetype->GetEntity(record.row) != entity) {
+            return nullptr;
+        }
+        return &record;
+    }
+
+    ArchetypeStorage::EntityRecord& ArchetypeStorage::GetOrCreateRecord(const EntityId entity) {
+        const auto index = GetEntityIndex(entity);
+        if (index >= m_records.size()) {
+            m_records.resize(index + 1);
+        }
+        auto& record = m_records[index];
+        if (record.archetype != nullptr && record.archetype->GetEntity(record.row) != entity) {
+            // The slot still belongs to an older generation of this index.
+            RemoveFromArchetype(record);
+            record = EntityRecord{};
+        }
+        return record;
+    }
+
+    Archetype* ArchetypeStorage::GetOrCreateArchetype(const std::vector<ArchetypeComponentId>& signature) {
+        if (const auto it = m_archetype_lookup.find(signature); it != m_archetype_lookup.end()) {
+            return it->second;
+        }
+
+        std::vector<ArchetypeComponentInfo> infos;
+        infos.reserve(signature.size());
+        for (const auto component_id: signature) {
+            infos.push_back(m_component_infos[component_id]);
+        }
+        auto archetype = std::make_unique<Archetype>(signature, std::move(infos));
+        auto* archetype_ptr = archetype.get();
+        m_archetypes.push_back(std::move(archetype));
+        m_archetype_lookup.emplace(signature, archetype_ptr);
+        return archetype_ptr;
+    }
+
+    Archetype* ArchetypeStorage::GetAddTarget(Archetype* source, const ArchetypeComponentId component_id) {
+        if (source != nullptr) {
+            if (const auto edge = source->GetAddEdge(component_id); edge != nullptr) {
+                return edge;
+            }
+        }
+
+        std::vector<ArchetypeComponentId> signature;
+        if (source != nullptr) {
+            signature = source->GetSignature();
+        }
+        signature.insert(std::ranges::lower_bound(signature, component_id), component_id);
+        Archetype* target = GetOrCreateArchetype(signature);
+
+        if (source != nullptr) {
+            source->SetAddEdge(component_id, target);
+            target->SetRemoveEdge(component_id, source);
+        }
+        return target;
+    }
+
+    Archetype* ArchetypeStorage::GetRemoveTarget(Archetype* source, const ArchetypeComponentId component_id) {
+        if (const auto edge = source->GetRemoveEdge(component_id); edge != nullptr) {
+            return edge;
+        }
+
+        auto signature = source->GetSignature();
+        std::erase(signature, component_id);
+        Archetype* target = GetOrCreateArchetype(signature);
+
+        source->SetRemoveEdge(component_id, target);
+        target->SetAddEdge(component_id, source);
+        return target;
+    }
+
+    bool ArchetypeStorage::UpdateRangeTarget(Archetype* source, const std::span<const ArchetypeComponentRange> components,
+                                             Archetype*& target) {
+        m_range_signature.clear();
+        if (source != nullptr) {
+            m_range_signature = source->GetSignature();
+        }
+        for (const auto& component: components) {
+            if (const auto it = std::ranges::lower_bound(m_range_signature, component.component_id);
+                it == m_range_signature.end() || *it != component.component_id) {
+                m_range_signature.insert(it, component.component_id);
+            }
+        }
+        if (source != nullptr && m_range_signature.size() == source->GetSignature().size()) {
+            target = source;
+            return false;
+        }
+
+        target = GetOrCreateArchetype(m_range_signature);
+        m_range_columns.clear();
+        for (const auto& component: components) {
+            const auto owned = source != nullptr && source->Contains(component.component_id);
+            m_range_columns.push_back(owned ? Archetype::NO_COLUMN : target->GetColumn(component.component_id));
+        }
+        return true;
+    }
+
+    void ArchetypeStorage::MoveEntity(const EntityId entity, EntityRecord& record, Archetype* target) {
+        const auto new_row = target->AllocateRow(entity);
+        if (record.archetype != nullptr) {
+            Archetype* source = record.archetype;
+            const auto& source_signature = source->GetSignature();
+            for (std::size_t source_column = 0; source_column < source_signature.size(); ++source_column) {
+                const auto target_column = target->GetColumn(source_signature[source_column]);
+                if (target_column == Archetype::NO_COLUMN) {
+                    continue;
+                }
+                m_component_infos[source_signature[source_column]].move_construct(
+                        target->GetComponent(new_row, target_column),
+                        source->GetComponent(record.row, source_column)
+                        );
+            }
+            RemoveFromArchetype(record);
+        }
+        record.archetype = target;
+        record.row = new_row;
+    }
+
+    void ArchetypeStorage::RemoveFromArchetype(const EntityRecord& record) {
+        const auto moved_entity = record.archetype->RemoveRow(record.row);
+        if (moved_entity != INVALID_ENTITY_ID) {
+            m_records[GetEntityIndex(moved_entity)].row = record.row;
+        }
+    }
+} // namespace
@@ -0,0 +1,190 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "Archetype.hpp"
+
+namespace Engine::Ecs {
+    /**
+     * List of component types, see ArchetypeStorage::Match().
+     */
+    template<typename... Ts>
+    struct ArchetypeTypes {
+    };
+
+    /**
+     * Components of one type added to a batch of entities, see ArchetypeStorage::AddComponents().
+     */
+    struct ArchetypeComponentRange {
+        ArchetypeComponentId component_id;
+        /**
+         * Either one component copied to every entity, or one component per entity that is moved from.
+         */
+        void* values;
+        bool per_entity;
+    };
+
+    /**
+     * The archetypes owning all required and none of the excluded component types of a view.
+     */
+    struct ArchetypeMatch {
+        std::vector<ArchetypeComponentId> required;
+        std::vector<ArchetypeComponentId> excluded;
+        std::vector<const Archetype*> archetypes;
+        /**
+         * The column of every required type per matching archetype. The columns of archetype i start at
+         * i * required.size().
+         */
+        std::vector<std::size_t> columns;
+        /**
+         * The number of archetypes of the storage checked so far. Archetypes are never removed, so only the ones
+         * created afterwards are checked on the next lookup.
+         */
+        std::size_t checked = 0;
+    };
+
+    /**
+     * @class ArchetypeStorage
+     * @brief Opt-in component storage that groups entities by their exact component signature.
+     *
+     * Every archetype keeps its components in fixed size SoA chunks, so iterating entities that share the same
+     * component set walks tightly packed arrays side by side instead of one sparse set per component type.
+     * Adding or removing a component moves the entity into the archetype of its new signature. The public
+     * operations mirror the ones of the ComponentManager, which forwards to this storage in a world created with
+     * ComponentStorage::Archetype.
+     */
+    class ArchetypeStorage {
+    public:
+        ArchetypeStorage();
+
+        ~ArchetypeStorage();
+
+        template<typename T>
+        T& AddComponent(EntityId entity, T component);
+
+        template<typename T>
+        void RemoveComponent(EntityId entity);
+
+        template<typename T>
+        T* GetComponent(EntityId entity);
+
+        template<typename T>
+        [[nodiscard]] bool HasComponent(EntityId entity) const;
+
+        /**
+         * Add several component types to a batch of entities. The target archetype is looked up once per source
+         * archetype of the batch and every entity is moved a single time. Entities that already own a component
+         * type keep their component.
+         * @param entities The entities to add the components to
+         * @param components The component types and their values
+         * @return The entities that got at least one component, valid until the next call
+         */
+        std::span<const EntityId> AddComponents(std::span<const EntityId> entities,
+                                                std::span<const ArchetypeComponentRange> components);
+
+        /**
+         * Register the type erased operations of a component type.
+         * @return The id of the component type within the archetypes
+         */
+        template<typename T>
+        ArchetypeComponentId RegisterType();
+
+        /**
+         * Remove an entity and all of its components from the storage.
+         * @param entity The entity to remove
+         */
+        void OnDestroyEntity(EntityId entity);
+
+        /**
+         * Remove all entities and their components, keeping the archetypes and their chunks.
+         */
+        void Clear();
+
+        /**
+         * @return The archetype of the entity, or nullptr if the entity owns no components
+         */
+        [[nodiscard]] const Archetype* GetArchetype(EntityId entity) const;
+
+        /**
+         * Get the archetypes owning every component of Ts and none of Ex. The result is cached per type list and
+         * only archetypes created since the last lookup are checked, so looking it up every frame does not allocate.
+         * @return The match, valid as long as the storage
+         */
+        template<typename... Ts, typename... Ex>
+        const ArchetypeMatch& Match(ArchetypeTypes<Ts...> required, ArchetypeTypes<Ex...> excluded = {});
+
+        /**
+         * Call fn(EntityId, Ts&...) for every entity owning all given component types.
+         * Iterates chunk by chunk over every archetype containing the requested types. Const qualified types
+         * are handed out as const references.
+         */
+        template<typename... Ts, typename Fn>
+        void ForEach(Fn&& fn);
+
+        [[nodiscard]] std::size_t GetArchetypeCount() const { return m_archetypes.size(); }
+
+        [[nodiscard]] std::size_t GetEntityCount() const;
+
+    private:
+        struct EntityRecord {
+            Archetype* archetype = nullptr;
+            std::size_t row = 0;
+        };
+
+        template<typename T>
+        static ArchetypeComponentId TypeId();
+
+        static ArchetypeComponentId NextComponentTypeId();
+
+        static std::size_t NextMatchId();
+
+        void UpdateMatch(ArchetypeMatch& match) const;
+
+        [[nodiscard]] const EntityRecord* FindRecord(EntityId entity) const;
+
+        EntityRecord& GetOrCreateRecord(EntityId entity);
+
+        Archetype* GetOrCreateArchetype(const std::vector<ArchetypeComponentId>& signature);
+
+        Archetype* GetAddTarget(Archetype* source, ArchetypeComponentId component_id);
+
+        Archetype* GetRemoveTarget(Archetype* source, ArchetypeComponentId component_id);
+
+        /**
+         * Look up the archetype of source extended by the given component types and fill m_range_columns with the
+         * target column of every type the source does not own yet.
+         * @return True if the target differs from the source
+         */
+        bool UpdateRangeTarget(Archetype* source, std::span<const ArchetypeComponentRange> components,
+                               Archetype*& target);
+
+        /**
+         * Move an entity into another archetype. All components shared by both archetypes are moved, components
+         * only present in the source are destroyed and components only present in the target stay uninitialized.
+         */
+        void MoveEntity(EntityId entity, EntityRecord& record, Archetype* target);
+
+        void RemoveFromArchetype(const EntityRecord& record);
+
+        std::vector<std::unique_ptr<Archetype> > m_archetypes;
+        std::map<std::vector<ArchetypeComponentId>, Archetype*> m_archetype_lookup;
+        std::vector<ArchetypeComponentInfo> m_component_infos;
+        std::vector<EntityRecord> m_records;
+        std::vector<std::unique_ptr<ArchetypeMatch> > m_matches;
+        /**
+         * Scratch buffers of AddComponents(), kept to not allocate per batch.
+         */
+        std::vector<EntityId> m_added_entities;
+        std::vector<ArchetypeComponentId> m_range_signature;
+        std::vector<std::size_t> m_range_columns;
+        /**
+         * Views are created by systems of the same parallel stage, which look up their matches at the same time.
+         */
+        std::mutex m_match_mutex;
+    };
+} // namespace
+
+#include "ArchetypeStorage.inl"
@@ -0,0 +1,134 @@
+#pragma once
+#include <array>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ArchetypeStorage.hpp"
+
+namespace Engine::Ecs {
+    template<typename T>
+    T& ArchetypeStorage::AddComponent(const EntityId entity, T component) {
+        if (entity == INVALID_ENTITY_ID) {
+            throw std::invalid_argument("Cannot add component with invalid EntityId");
+        }
+        const auto component_id = RegisterType<T>();
+        auto& record = GetOrCreateRecord(entity);
+        if (record.archetype != nullptr) {
+            if (const auto column = record.archetype->GetColumn(component_id); column != Archetype::NO_COLUMN) {
+                return *static_cast<T*>(record.archetype->GetComponent(record.row, column));
+            }
+        }
+
+        Archetype* target = GetAddTarget(record.archetype, component_id);
+        MoveEntity(entity, record, target);
+        void* memory = target->GetComponent(record.row, target->GetColumn(component_id));
+        return *new(memory) T(std::move(component));
+    }
+
+    template<typename T>
+    void ArchetypeStorage::RemoveComponent(const EntityId entity) {
+        if (!HasComponent<T>(entity)) {
+            return;
+        }
+        auto& record = m_records[GetEntityIndex(entity)];
+        Archetype* target = GetRemoveTarget(record.archetype, TypeId<T>());
+        MoveEntity(entity, record, target);
+    }
+
+    template<typename T>
+    T* ArchetypeStorage::GetComponent(const EntityId entity) {
+        const auto record = FindRecord(entity);
+        if (record == nullptr) {
+            return nullptr;
+        }
+        const auto column = record->archetype->GetColumn(TypeId<T>());
+        if (column == Archetype::NO_COLUMN) {
+            return nullptr;
+        }
+        return static_cast<T*>(record->archetype->GetComponent(record->row, column));
+    }
+
+    template<typename T>
+    bool ArchetypeStorage::HasComponent(const EntityId entity) const {
+        const auto record = FindRecord(entity);
+        return record != nullptr && record->archetype->Contains(TypeId<T>());
+    }
+
+    template<typename... Ts, typename Fn>
+    void ArchetypeStorage::ForEach(Fn&& fn) {
+        const std::array<ArchetypeComponentId, sizeof...(Ts)> component_ids = {TypeId<std::remove_const_t<Ts> >()...};
+        for (const auto& archetype: m_archetypes) {
+            std::array<std::size_t, sizeof...(Ts)> columns{};
+            bool matches = true;
+            for (std::size_t i = 0; i < component_ids.size(); ++i) {
+                columns[i] = archetype->GetColumn(component_ids[i]);
+                matches = matches && columns[i] != Archetype::NO_COLUMN;
+            }
+            if (!matches) {
+                continue;
+            }
+
+            for (std::size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk) {
+                const auto rows = archetype->GetRowCount(chunk);
+                const EntityId* entities = archetype->GetEntities(chunk);
+                [&]<std::size_t... I>(std::index_sequence<I...>) {
+                    auto component_arrays = std::make_tuple(static_cast<Ts*>(archetype->GetColumnData(chunk, columns[I]))...);
+                    for (std::size_t row = 0; row < rows; ++row) {
+                        fn(entities[row], std::get<I>(component_arrays)[row]...);
+                    }
+                }(std::index_sequence_for<Ts...>{});
+            }
+        }
+    }
+
+    template<typename... Ts, typename... Ex>
+    const ArchetypeMatch& ArchetypeStorage::Match(ArchetypeTypes<Ts...>, ArchetypeTypes<Ex...>) {
+        static const std::size_t match_id = NextMatchId();
+        std::lock_guard lock(m_match_mutex);
+        if (m_matches.size() <= match_id) {
+            m_matches.resize(match_id + 1);
+        }
+        auto& match = m_matches[match_id];
+        if (!match) {
+            match = std::make_unique<ArchetypeMatch>();
+            match->required = {TypeId<Ts>()...};
+            match->excluded = {TypeId<Ex>()...};
+        }
+        UpdateMatch(*match);
+        return *match;
+    }
+
+    template<typename T>
+    ArchetypeComponentId ArchetypeStorage::RegisterType() {
+        const auto id = TypeId<T>();
+        if (m_component_infos.size() <= id) {
+            m_component_infos.resize(id + 1);
+        }
+        auto& info = m_component_infos[id];
+        if (info.size == 0) {
+            info.size = sizeof(T);
+            info.alignment = alignof(T);
+            info.move_construct = [](void* destination, void* source) {
+                new(destination) T(std::move(*static_cast<T*>(source)));
+            };
+            if constexpr (std::is_copy_constructible_v<T>) {
+                info.copy_construct = [](void* destination, const void* source) {
+                    new(destination) T(*static_cast<const T*>(source));
+                };
+            }
+            info.destroy = [](void* component) {
+                static_cast<T*>(component)->~T();
+            };
+        }
+        return id;
+    }
+
+    template<typename T>
+    ArchetypeComponentId ArchetypeStorage::TypeId() {
+        static ArchetypeComponentId id = NextComponentTypeId();
+        return id;
+    }
+} // namespace
@@ -0,0 +1,103 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Engine::Ecs::Buffer {
+    /**
+     * @class CommandArena
+     * @brief Linear per-frame allocator for the payloads of deferred ECS events.
+     *
+     * Payloads are placed back to back into large blocks, so queueing a component does not cost a heap allocation once
+     * the blocks of the first frames exist. Reset() rewinds the arena in constant time and keeps the blocks for the
+     * next frame. Destructors are only recorded for types that are not trivially destructible and run on Reset().
+     * The arena is not thread safe, the world guards it with its structural mutex.
+     */
+    class CommandArena {
+    public:
+        static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+        explicit CommandArena(std::size_t block_size = DEFAULT_BLOCK_SIZE);
+
+        ~CommandArena();
+
+        CommandArena(const CommandArena&) = delete;
+
+        CommandArena& operator=(const CommandArena&) = delete;
+
+        /**
+         * Move a value into the arena. It stays alive until the next call to Reset().
+         * @tparam T The type of the value
+         * @param value The value to move into the arena
+         * @return The value inside the arena
+         */
+        template<typename T>
+        T* Create(T value);
+
+        /**
+         * Copy a range of values into one contiguous array inside the arena. They stay alive until the next call to
+         * Reset().
+         * @tparam T The type of the values
+         * @param values The values to copy
+         * @return The first value of the array inside the arena
+         */
+        template<typename T>
+        T* CreateRange(std::span<const T> values);
+
+        /**
+         * Reserve uninitialized memory inside the arena.
+         * @param size The number of bytes
+         * @param alignment The required alignment, must be a power of two
+         * @return The start of the reserved memory
+         */
+        void* Allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * Destroy all values created since the last reset and make the memory available again.
+         */
+        void Reset();
+
+        /**
+         * @return The number of blocks owned by the arena, which only grows when a frame needs more memory than before
+         */
+        [[nodiscard]] std::size_t GetBlockCount() const { return m_blocks.size(); }
+
+        /**
+         * @return The number of bytes handed out since the last reset, including alignment padding
+         */
+        [[nodiscard]] std::size_t GetUsedBytes() const { return m_used_bytes; }
+
+        /**
+         * @return The most bytes that were handed out between two resets
+         */
+        [[nodiscard]] std::size_t GetHighWaterBytes() const { return std::max(m_high_water_bytes, m_used_bytes); }
+
+        /**
+         * @return The size of all blocks owned by the arena
+         */
+        [[nodiscard]] std::size_t GetReservedBytes() const;
+
+    private:
+        struct Block {
+            std::unique_ptr<std::byte[]> memory;
+            std::size_t size;
+        };
+
+        struct Destructor {
+            void (*destroy)(void*, std::size_t);
+            void* objects;
+            std::size_t count;
+        };
+
+        std::vector<Block> m_blocks;
+        std::vector<Destructor> m_destructors;
+        std::size_t m_block_size;
+        std::size_t m_block_index = 0;
+        std::size_t m_offset = 0;
+        std::size_t m_used_bytes = 0;
+        std::size_t m_high_water_bytes = 0;
+    };
+} // namespace
+#include "CommandArena.inl"
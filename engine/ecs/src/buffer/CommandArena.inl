@@ -0,0 +1,87 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Engine::Ecs::Buffer {
+    inline CommandArena::CommandArena(const std::size_t block_size) : m_block_size(block_size) {
+    }
+
+    inline CommandArena::~CommandArena() {
+        Reset();
+    }
+
+    template<typename T>
+    T* CommandArena::Create(T value) {
+        auto* object = new(Allocate(sizeof(T), alignof(T))) T(std::move(value));
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            m_destructors.push_back(Destructor{[](void* pointer, std::size_t) { static_cast<T*>(pointer)->~T(); },
+                                               object, 1});
+        }
+        return object;
+    }
+
+    template<typename T>
+    T* CommandArena::CreateRange(const std::span<const T> values) {
+        auto* objects = static_cast<T*>(Allocate(sizeof(T) * values.size(), alignof(T)));
+        std::uninitialized_copy(values.begin(), values.end(), objects);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            m_destructors.push_back(Destructor{
+                [](void* pointer, const std::size_t count) { std::destroy_n(static_cast<T*>(pointer), count); },
+                objects, values.size()
+            });
+        }
+        return objects;
+    }
+
+    inline void* CommandArena::Allocate(const std::size_t size, const std::size_t alignment) {
+        const auto try_allocate = [this, size, alignment](Block& block) -> void* {
+            const auto base = reinterpret_cast<std::uintptr_t>(block.memory.get());
+            const auto aligned = (base + m_offset + alignment - 1) & ~(alignment - 1);
+            const auto end = aligned - base + size;
+            if (end > block.size) {
+                return nullptr;
+            }
+            m_used_bytes += end - m_offset;
+            m_offset = end;
+            return reinterpret_cast<void*>(aligned);
+        };
+
+        // Walk the blocks of previous frames before growing, the first fitting block is kept for the next requests.
+        while (m_block_index < m_blocks.size()) {
+            if (void* memory = try_allocate(m_blocks[m_block_index])) {
+                return memory;
+            }
+            m_block_index++;
+            m_offset = 0;
+        }
+
+        const auto block_size = std::max(m_block_size, size + alignment);
+        m_blocks.push_back(Block{std::make_unique<std::byte[]>(block_size), block_size});
+        m_block_index = m_blocks.size() - 1;
+        m_offset = 0;
+        return try_allocate(m_blocks.back());
+    }
+
+    inline void CommandArena::Reset() {
+        for (auto it = m_destructors.rbegin(); it != m_destructors.rend(); ++it) {
+            it->destroy(it->objects, it->count);
+        }
+        m_destructors.clear();
+        m_block_index = 0;
+        m_offset = 0;
+        m_high_water_bytes = std::max(m_high_water_bytes, m_used_bytes);
+        m_used_bytes = 0;
+    }
+
+    inline std::size_t CommandArena::GetReservedBytes() const {
+        std::size_t bytes = 0;
+        for (const auto& block: m_blocks) {
+            bytes += block.size;
+        }
+        return bytes;
+    }
+} // namespace
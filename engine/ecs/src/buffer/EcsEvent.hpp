@@ -1,5 +1,4 @@
 #pragma once
-#include <vector>
 
 #include "../ComponentManager.hpp"
 #include "../Entity.hpp"
@@ -12,6 +11,19 @@ namespace Engine::Ecs {
         AddComponent,
         RemoveComponent,
         UpdateComponent,
+        CreateEntities,
+        AddComponents,
+        InstantiatePrefab,
+    };
+
+    /**
+     * Payload of an InstantiatePrefab event, owned by the command arena.
+     */
+    struct PrefabBatch {
+        using Component = ComponentRange;
+
+        const Component* components = nullptr;
+        std::size_t component_count = 0;
     };
 
     struct EcsEvent {
@@ -19,7 +31,15 @@ namespace Engine::Ecs {
         EntityId entity;
 
         ComponentTypeId component_type_id;
-        std::vector<std::byte> payload;
+        /**
+         * The component to add, owned by the world's command arena and moved into the pool when applied.
+         */
+        void* payload = nullptr;
+        /**
+         * The targets of the bulk events, owned by the command arena. Single entity events use entity instead.
+         */
+        const EntityId* entities = nullptr;
+        std::size_t count = 0;
     };
 
 } // namespace
\ No newline at end of file
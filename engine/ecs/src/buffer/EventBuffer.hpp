@@ -1,4 +1,5 @@
 #pragma once
+#include <mutex>
 #include <vector>
 
 #include "ComponentEventBus.hpp"
@@ -11,14 +12,25 @@ namespace Engine::Ecs::Buffer {
 
         ~EventBuffer();
 
+        /**
+         * Append an event. Safe to call from several systems running in parallel.
+         * @param event The event to enqueue
+         */
         void EnqueueEvent(T event);
 
         void ClearEvents();
 
         [[nodiscard]] const std::vector<T> &Get() const;
 
+        /**
+         * @return The most events that were queued at once, it is not reset by ClearEvents()
+         */
+        [[nodiscard]] std::size_t GetHighWaterMark() const { return m_high_water_mark; }
+
     private:
         std::vector<T> m_event_buffer;
+        std::size_t m_high_water_mark = 0;
+        std::mutex m_mutex;
     };
 } // namespace
 #include "EventBuffer.inl"
@@ -1,5 +1,7 @@
 #include "EventBuffer.hpp"
 
+#include <algorithm>
+
 namespace Engine::Ecs::Buffer {
     template<typename T>
     EventBuffer<T>::EventBuffer() = default;
@@ -9,7 +11,9 @@ namespace Engine::Ecs::Buffer {
 
     template<typename T>
     void EventBuffer<T>::EnqueueEvent(T event) {
+        std::lock_guard lock(m_mutex);
         m_event_buffer.emplace_back(std::move(event));
+        m_high_water_mark = std::max(m_high_water_mark, m_event_buffer.size());
     }
 
     template<typename T>
@@ -0,0 +1,178 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../src/archetype/ArchetypeStorage.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    struct Position {
+        float x;
+        float y;
+        float z;
+    };
+
+    struct Velocity {
+        float x;
+        float y;
+        float z;
+    };
+
+    struct Name {
+        std::string value;
+    };
+
+    EntityId MakeEntity(const uint64_t index) {
+        return index;
+    }
+}
+
+TEST_CASE("ArchetypeStorage::AddComponent - Entities move between archetypes", "[ecs][fast]") {
+    ArchetypeStorage storage;
+    const auto entity = MakeEntity(1);
+
+    storage.AddComponent(entity, Position{1.0f, 2.0f, 3.0f});
+    REQUIRE(storage.GetArchetypeCount() == 1);
+
+    storage.AddComponent(entity, Velocity{4.0f, 5.0f, 6.0f});
+    REQUIRE(storage.GetArchetypeCount() == 2);
+    REQUIRE(storage.GetEntityCount() == 1);
+    REQUIRE(storage.GetComponent<Position>(entity)->y == 2.0f);
+    REQUIRE(storage.GetComponent<Velocity>(entity)->z == 6.0f);
+
+    storage.RemoveComponent<Position>(entity);
+    REQUIRE_FALSE(storage.HasComponent<Position>(entity));
+    REQUIRE(storage.HasComponent<Velocity>(entity));
+    REQUIRE(storage.GetComponent<Velocity>(entity)->x == 4.0f);
+}
+
+TEST_CASE("ArchetypeStorage::AddComponent - Adding an existing component keeps the old value", "[ecs][fast]") {
+    ArchetypeStorage storage;
+    const auto entity = MakeEntity(1);
+    storage.AddComponent(entity, Position{1.0f, 0.0f, 0.0f});
+    storage.AddComponent(entity, Position{2.0f, 0.0f, 0.0f});
+    REQUIRE(storage.GetComponent<Position>(entity)->x == 1.0f);
+    REQUIRE_THROWS(storage.AddComponent(INVALID_ENTITY_ID, Position{}));
+}
+
+TEST_CASE("ArchetypeStorage::AddComponents - Moves every entity into its final archetype once", "[ecs][fast]") {
+    ArchetypeStorage storage;
+    const auto owner = MakeEntity(1);
+    storage.AddComponent(owner, Velocity{9.0f, 0.0f, 0.0f});
+    REQUIRE(storage.GetArchetypeCount() == 1);
+
+    std::vector<EntityId> entities = {MakeEntity(2), MakeEntity(3), MakeEntity(4), owner};
+    std::vector<Position> positions = {{1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f}};
+    Velocity velocity{5.0f, 0.0f, 0.0f};
+    Name name{"Tile"};
+    const std::vector<ArchetypeComponentRange> components = {
+        {storage.RegisterType<Position>(), positions.data(), true},
+        {storage.RegisterType<Velocity>(), &velocity, false},
+        {storage.RegisterType<Name>(), &name, false},
+    };
+    const auto added = storage.AddComponents(entities, components);
+
+    REQUIRE(std::vector<EntityId>(added.begin(), added.end()) == entities);
+    // No archetype is created for the intermediate signatures, the owner only passes through it once
+    REQUIRE(storage.GetArchetypeCount() == 2);
+    REQUIRE(storage.GetEntityCount() == 4);
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        REQUIRE(storage.GetComponent<Position>(entities[i])->x == static_cast<float>(i + 1));
+        REQUIRE(storage.GetComponent<Name>(entities[i])->value == "Tile");
+    }
+    REQUIRE(storage.GetComponent<Velocity>(entities[0])->x == 5.0f);
+    REQUIRE(storage.GetComponent<Velocity>(owner)->x == 9.0f);
+    REQUIRE(name.value == "Tile");
+
+    // Entities owning every type already are skipped
+    REQUIRE(storage.AddComponents(entities, std::span(components).subspan(1)).empty());
+    REQUIRE(storage.GetComponent<Velocity>(owner)->x == 9.0f);
+}
+
+TEST_CASE("ArchetypeStorage::OnDestroyEntity - Swapped rows keep their components", "[ecs][fast]") {
+    ArchetypeStorage storage;
+    constexpr int entity_count = 2000;
+    for (int i = 1; i <= entity_count; ++i) {
+        const auto entity = MakeEntity(i);
+        storage.AddComponent(entity, Position{static_cast<float>(i), 0.0f, 0.0f});
+        storage.AddComponent(entity, Name{std::to_string(i)});
+    }
+
+    for (int i = 1; i <= entity_count; i += 2) {
+        storage.OnDestroyEntity(MakeEntity(i));
+    }
+    REQUIRE(storage.GetEntityCount() == entity_count / 2);
+
+    for (int i = 2; i <= entity_count; i += 2) {
+        const auto entity = MakeEntity(i);
+        REQUIRE(storage.GetComponent<Position>(entity)->x == static_cast<float>(i));
+        REQUIRE(storage.GetComponent<Name>(entity)->value == std::to_string(i));
+    }
+    REQUIRE(storage.GetComponent<Position>(MakeEntity(1)) == nullptr);
+}
+
+TEST_CASE("ArchetypeStorage::ForEach - Visits every archetype containing the requested types", "[ecs][fast]") {
+    ArchetypeStorage storage;
+    for (int i = 1; i <= 100; ++i) {
+        const auto entity = MakeEntity(i);
+        storage.AddComponent(entity, Position{1.0f, 0.0f, 0.0f});
+        if (i % 2 == 0) {
+            storage.AddComponent(entity, Velocity{1.0f, 0.0f, 0.0f});
+        }
+        if (i % 4 == 0) {
+            storage.AddComponent(entity, Name{"Entity"});
+        }
+    }
+
+    std::size_t visited = 0;
+    storage.ForEach<Position, Velocity>([&visited](const EntityId entity, Position& position, const Velocity& velocity) {
+        position.x += velocity.x;
+        visited++;
+    });
+    REQUIRE(visited == 50);
+    REQUIRE(storage.GetComponent<Position>(MakeEntity(2))->x == 2.0f);
+    REQUIRE(storage.GetComponent<Position>(MakeEntity(4))->x == 2.0f);
+    REQUIRE(storage.GetComponent<Position>(MakeEntity(3))->x == 1.0f);
+}
+
+TEST_CASE("ArchetypeStorage::Match - Checks archetypes created after the first lookup", "[ecs][fast]") {
+    ArchetypeStorage storage;
+    storage.AddComponent(MakeEntity(1), Position{});
+    storage.AddComponent(MakeEntity(2), Position{});
+    storage.AddComponent(MakeEntity(2), Velocity{});
+
+    const auto& match = storage.Match(ArchetypeTypes<Velocity, Position>{}, ArchetypeTypes<Name>{});
+    REQUIRE(match.archetypes.size() == 1);
+    // Columns follow the order of the requested types
+    REQUIRE(match.columns == std::vector<std::size_t>{1, 0});
+
+    storage.AddComponent(MakeEntity(3), Velocity{});
+    storage.AddComponent(MakeEntity(3), Position{});
+    storage.AddComponent(MakeEntity(3), Name{"Named"});
+    storage.AddComponent(MakeEntity(4), Position{});
+    storage.AddComponent(MakeEntity(4), Velocity{});
+    REQUIRE(&storage.Match(ArchetypeTypes<Velocity, Position>{}, ArchetypeTypes<Name>{}) == &match);
+    REQUIRE(match.archetypes.size() == 1);
+    REQUIRE(storage.Match(ArchetypeTypes<Velocity, Position>{}).archetypes.size() == 2);
+    REQUIRE(storage.GetArchetype(MakeEntity(4)) == match.archetypes[0]);
+}
+
+TEST_CASE("ArchetypeStorage::Clear - Removes all entities and keeps the archetypes", "[ecs][fast]") {
+    ArchetypeStorage storage;
+    storage.AddComponent(MakeEntity(1), Position{});
+    storage.AddComponent(MakeEntity(2), Name{"Named"});
+
+    storage.Clear();
+
+    REQUIRE(storage.GetEntityCount() == 0);
+    REQUIRE(storage.GetArchetypeCount() == 2);
+    REQUIRE(storage.GetComponent<Position>(MakeEntity(1)) == nullptr);
+    REQUIRE(storage.GetArchetype(MakeEntity(2)) == nullptr);
+}
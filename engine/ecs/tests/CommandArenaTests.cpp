@@ -0,0 +1,125 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../src/buffer/CommandArena.hpp"
+
+using namespace Engine::Ecs::Buffer;
+
+namespace {
+    struct alignas(32) AlignedValue {
+        float values[8];
+    };
+
+    struct DestructorCounter {
+        int* destroyed;
+        std::string name;
+
+        DestructorCounter(int* destroyed, std::string name) : destroyed(destroyed), name(std::move(name)) {
+        }
+
+        DestructorCounter(const DestructorCounter&) = default;
+
+        DestructorCounter(DestructorCounter&& other) noexcept : destroyed(other.destroyed),
+                                                                 name(std::move(other.name)) {
+            other.destroyed = nullptr;
+        }
+
+        ~DestructorCounter() {
+            if (destroyed != nullptr) {
+                (*destroyed)++;
+            }
+        }
+    };
+}
+
+TEST_CASE("CommandArena::Create - Values are stored with their alignment", "[ecs][fast]") {
+    CommandArena arena(256);
+
+    const auto* small = arena.Create<char>('a');
+    const auto* aligned = arena.Create(AlignedValue{{1.0f}});
+    const auto* number = arena.Create<uint64_t>(42);
+
+    REQUIRE(*small == 'a');
+    REQUIRE(aligned->values[0] == 1.0f);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % alignof(AlignedValue) == 0);
+    REQUIRE(*number == 42);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(number) % alignof(uint64_t) == 0);
+}
+
+TEST_CASE("CommandArena::Reset - Reuses the blocks of previous frames", "[ecs][fast]") {
+    CommandArena arena(1024);
+    for (int i = 0; i < 1000; ++i) {
+        arena.Create<uint64_t>(i);
+    }
+    const auto block_count = arena.GetBlockCount();
+    REQUIRE(block_count > 1);
+
+    arena.Reset();
+    REQUIRE(arena.GetUsedBytes() == 0);
+    for (int i = 0; i < 1000; ++i) {
+        arena.Create<uint64_t>(i);
+    }
+    REQUIRE(arena.GetBlockCount() == block_count);
+}
+
+TEST_CASE("CommandArena::Allocate - Requests larger than a block get their own block", "[ecs][fast]") {
+    CommandArena arena(64);
+
+    void* memory = arena.Allocate(1000, 16);
+
+    REQUIRE(memory != nullptr);
+    REQUIRE(arena.GetUsedBytes() >= 1000);
+    REQUIRE(arena.GetBlockCount() == 1);
+}
+
+TEST_CASE("CommandArena::CreateRange - Copies values into one contiguous array", "[ecs][fast]") {
+    CommandArena arena(256);
+    const std::vector<uint64_t> values{1, 2, 3, 4};
+
+    const auto* range = arena.CreateRange<uint64_t>(values);
+
+    REQUIRE(range[0] == 1);
+    REQUIRE(range[3] == 4);
+    REQUIRE(arena.GetUsedBytes() == sizeof(uint64_t) * values.size());
+}
+
+TEST_CASE("CommandArena::Reset - Runs destructors of non trivial values once", "[ecs][fast]") {
+    int destroyed = 0;
+    {
+        CommandArena arena;
+        arena.Create(DestructorCounter(&destroyed, "first"));
+        arena.Create(DestructorCounter(&destroyed, "second"));
+        REQUIRE(destroyed == 0);
+
+        arena.Reset();
+        REQUIRE(destroyed == 2);
+
+        arena.Create(DestructorCounter(&destroyed, "third"));
+    }
+    REQUIRE(destroyed == 3);
+}
+
+TEST_CASE("CommandArena::Reset - Runs destructors of every value of a range", "[ecs][fast]") {
+    int destroyed = 0;
+    CommandArena arena;
+    const std::vector<std::string> names{"a", "b", "c"};
+    const auto* range = arena.CreateRange<std::string>(names);
+    REQUIRE(range[2] == "c");
+
+    std::vector<DestructorCounter> counters;
+    counters.emplace_back(&destroyed, "first");
+    counters.emplace_back(&destroyed, "second");
+    arena.CreateRange<DestructorCounter>(counters);
+    counters.clear();
+    REQUIRE(destroyed == 2);
+
+    arena.Reset();
+    REQUIRE(destroyed == 4);
+}
@@ -0,0 +1,99 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <string>
+#include <vector>
+
+#include "Ecs/CommandBus.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    struct MoveCommand {
+        int distance;
+    };
+
+    struct NameCommand {
+        std::string name;
+    };
+}
+
+TEST_CASE("CommandBus::Dispatch - Commands only reach subscribers of their type", "[ecs][fast]") {
+    CommandBus bus;
+    std::vector<int> distances;
+    std::vector<std::string> names;
+    bus.Subscribe<MoveCommand>([&distances](const MoveCommand& command) { distances.push_back(command.distance); });
+    bus.Subscribe<NameCommand>([&names](const NameCommand& command) { names.push_back(command.name); });
+
+    bus.Send(MoveCommand{1});
+    bus.Send(NameCommand{"Player"});
+    bus.Send(MoveCommand{2});
+    REQUIRE(bus.GetPendingCount<MoveCommand>() == 2);
+    bus.Dispatch();
+
+    REQUIRE(distances == std::vector<int>{1, 2});
+    REQUIRE(names == std::vector<std::string>{"Player"});
+    REQUIRE(bus.GetPendingCount<MoveCommand>() == 0);
+}
+
+TEST_CASE("CommandBus::Send - Commands without subscribers are dropped", "[ecs][fast]") {
+    CommandBus bus;
+
+    bus.Send(MoveCommand{1});
+
+    REQUIRE(bus.GetPendingCount<MoveCommand>() == 0);
+    REQUIRE_NOTHROW(bus.Dispatch());
+}
+
+TEST_CASE("CommandBus::Unsubscribe - Removed handlers are no longer called", "[ecs][fast]") {
+    CommandBus bus;
+    int first_calls = 0;
+    int second_calls = 0;
+    const auto first = bus.Subscribe<MoveCommand>([&first_calls](const MoveCommand&) { first_calls++; });
+    bus.Subscribe<MoveCommand>([&second_calls](const MoveCommand&) { second_calls++; });
+
+    bus.Send(MoveCommand{1});
+    bus.Dispatch();
+    bus.Unsubscribe(first);
+    bus.Send(MoveCommand{1});
+    bus.Dispatch();
+
+    REQUIRE(first_calls == 1);
+    REQUIRE(second_calls == 2);
+}
+
+TEST_CASE("CommandBus::Dispatch - Commands sent by a handler are delivered on the next dispatch", "[ecs][fast]") {
+    CommandBus bus;
+    int calls = 0;
+    bus.Subscribe<MoveCommand>([&bus, &calls](const MoveCommand& command) {
+        calls++;
+        if (command.distance > 0) {
+            bus.Send(MoveCommand{command.distance - 1});
+        }
+    });
+
+    bus.Send(MoveCommand{1});
+    bus.Dispatch();
+    REQUIRE(calls == 1);
+    bus.Dispatch();
+    REQUIRE(calls == 2);
+}
+
+TEST_CASE("CommandBus::ClearPending - Queued commands are dropped and the subscribers kept", "[ecs][fast]") {
+    CommandBus bus;
+    std::vector<int> distances;
+    bus.Subscribe<MoveCommand>([&distances](const MoveCommand& command) { distances.push_back(command.distance); });
+
+    bus.Send(MoveCommand{1});
+    bus.ClearPending();
+    REQUIRE(bus.GetPendingCount<MoveCommand>() == 0);
+    bus.Dispatch();
+    REQUIRE(distances.empty());
+
+    bus.Send(MoveCommand{2});
+    bus.Dispatch();
+    REQUIRE(distances == std::vector<int>{2});
+}
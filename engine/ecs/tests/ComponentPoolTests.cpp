@@ -4,8 +4,13 @@
 #include <catch2/catch_all.hpp>
 #endif
 
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
 #include "../src/ComponentPool.hpp"
 #include "../src/Entity.hpp"
+#include "JobSystem.hpp"
 
 using namespace Engine::Ecs;
 
@@ -43,6 +48,35 @@ TEST_CASE("ComponentPool::Add - Add invalid Entity", "[ecs][fast]") {
     REQUIRE_THROWS(pool.Add(entity_a, TestClass{.test_value = 1}));
 }
 
+TEST_CASE("ComponentPool::AddRange - Add components for several entities", "[ecs][fast]") {
+    auto pool = ComponentPool<TestClass>(0);
+    pool.Add(2u, TestClass{.test_value = 7});
+    const std::vector<EntityId> entities{1u, 2u, 300u};
+    std::vector<TestClass> values{{.test_value = 1}, {.test_value = 2}, {.test_value = 3}};
+
+    const auto added = pool.AddRange(entities, values);
+
+    REQUIRE(std::vector(added.begin(), added.end()) == std::vector<EntityId>{1u, 300u});
+    REQUIRE(pool.Count() == 3);
+    REQUIRE(pool.Get(1u)->test_value == 1);
+    REQUIRE(pool.Get(2u)->test_value == 7);
+    REQUIRE(pool.Get(300u)->test_value == 3);
+    REQUIRE_THROWS_AS(pool.AddRange(entities, std::span(values).first(2)), std::invalid_argument);
+}
+
+TEST_CASE("ComponentPool::FillRange - Add the same component to several entities", "[ecs][fast]") {
+    auto pool = ComponentPool<TestClass>(0);
+    pool.Add(2u, TestClass{.test_value = 7});
+    const std::vector<EntityId> entities{1u, 2u, 300u};
+
+    pool.FillRange(entities, TestClass{.test_value = 5});
+
+    REQUIRE(pool.Count() == 3);
+    REQUIRE(pool.Get(1u)->test_value == 5);
+    REQUIRE(pool.Get(2u)->test_value == 7);
+    REQUIRE(pool.Get(300u)->test_value == 5);
+}
+
 TEST_CASE("ComponentPool::Remove - Remove one Entity", "[ecs][fast]") {
     constexpr EntityId entity_a = 1u;
     auto pool = ComponentPool<TestClass>(0);
@@ -96,3 +130,217 @@ TEST_CASE("ComponentPool::ForEach - Iterate over each component and increase it
     REQUIRE(pool.Get(entity_b)->test_value == 3);
     REQUIRE(pool.Get(entity_c)->test_value == 4);
 }
+
+TEST_CASE("ComponentPool::GetView - Iterate dense components without copying", "[ecs][fast]") {
+    constexpr EntityId entity_a = 1u;
+    constexpr EntityId entity_b = 2u;
+    constexpr EntityId entity_c = 3u;
+    auto pool = ComponentPool<TestClass>(0);
+    pool.Add(entity_a, TestClass{.test_value = 1});
+    pool.Add(entity_b, TestClass{.test_value = 2});
+    pool.Add(entity_c, TestClass{.test_value = 3});
+    pool.Remove(entity_a);
+
+    const auto view = pool.GetView();
+    REQUIRE(view.Size() == 2);
+
+    uint32_t sum = 0;
+    for (const auto [component, entity]: view) {
+        REQUIRE(component == pool.Get(entity));
+        sum += component->test_value;
+        component->test_value += 10;
+    }
+    REQUIRE(sum == 5);
+    REQUIRE(pool.Get(entity_b)->test_value == 12);
+    REQUIRE(pool.Get(entity_c)->test_value == 13);
+}
+
+TEST_CASE("ComponentPool::ParallelForEach - Visits every component exactly once", "[ecs][fast]") {
+    Engine::Jobs::JobSystem job_system(3);
+    auto pool = ComponentPool<TestClass>(0);
+    for (EntityId entity = 1; entity <= 10'000; ++entity) {
+        pool.Add(entity, TestClass{.test_value = 0});
+    }
+    pool.Remove(5);
+
+    std::atomic<uint32_t> visited = 0;
+    pool.ParallelForEach(job_system, [&visited](const EntityId entity, TestClass &component) {
+        component.test_value += static_cast<uint32_t>(entity);
+        ++visited;
+    }, 64);
+
+    REQUIRE(visited == 9'999);
+    REQUIRE(pool.Get(1)->test_value == 1);
+    REQUIRE(pool.Get(10'000)->test_value == 10'000);
+}
+
+TEST_CASE("ComponentPool::ParallelForEach - Chunks cover whole cache lines", "[ecs][fast]") {
+    struct Large {
+        char bytes[24];
+    };
+
+    REQUIRE(GetParallelChunkSize<uint32_t>(1'000, 1, 4) == 16);
+    REQUIRE(GetParallelChunkSize<uint32_t>(1'000, 20, 4) == 32);
+    REQUIRE(GetParallelChunkSize<Large>(1'000, 1, 4) * sizeof(Large) % CACHE_LINE_SIZE == 0);
+    REQUIRE(GetParallelChunkSize<uint32_t>(16'000, 0, 4) == 1'008);
+
+    auto pool = ComponentPool<TestClass>(0);
+    pool.Add(1, TestClass{.test_value = 1});
+    const auto view = pool.GetView();
+    REQUIRE(reinterpret_cast<std::uintptr_t>(view[0].first) % CACHE_LINE_SIZE == 0);
+}
+
+TEST_CASE("ComponentView::ParallelForEach - Runs on the caller without workers", "[ecs][fast]") {
+    Engine::Jobs::JobSystem job_system(0);
+    auto pool = ComponentPool<TestClass>(0);
+    pool.Add(1, TestClass{.test_value = 1});
+    pool.Add(2, TestClass{.test_value = 2});
+
+    uint32_t sum = 0;
+    pool.GetView().ParallelForEach(job_system, [&sum](EntityId, const TestClass &component) {
+        sum += component.test_value;
+    });
+    REQUIRE(sum == 3);
+}
+
+TEST_CASE("ComponentPool::GetChanged - Only visits entities touched after the tick", "[ecs][fast]") {
+    ChangeTick tick = 1;
+    auto pool = ComponentPool<TestClass>(0, &tick);
+    for (EntityId entity = 1; entity <= 100; ++entity) {
+        pool.Add(entity, TestClass{.test_value = static_cast<uint32_t>(entity)});
+    }
+
+    tick = 2;
+    pool.MarkChanged(7);
+    pool.MarkChanged(42);
+    pool.MarkChanged(7);
+
+    std::vector<EntityId> changed;
+    for (const auto [component, entity]: pool.GetChanged(1)) {
+        REQUIRE(component->test_value == entity);
+        changed.push_back(entity);
+    }
+    REQUIRE(changed == std::vector<EntityId>{7, 42});
+    REQUIRE(pool.GetAdded(1).Empty());
+
+    std::size_t added = 0;
+    for (const auto _: pool.GetAdded(0)) {
+        added++;
+    }
+    REQUIRE(added == 100);
+}
+
+TEST_CASE("ComponentPool::GetChanged - Entities show up once with their latest change", "[ecs][fast]") {
+    ChangeTick tick = 1;
+    auto pool = ComponentPool<TestClass>(0, &tick);
+    pool.Add(1, TestClass{.test_value = 1});
+    pool.Add(2, TestClass{.test_value = 2});
+
+    tick = 2;
+    pool.MarkChanged(1);
+    tick = 3;
+    pool.MarkChanged(2);
+    pool.MarkChanged(1);
+
+    std::vector<EntityId> changed;
+    for (const auto [component, entity]: pool.GetChanged(0)) {
+        changed.push_back(entity);
+    }
+    REQUIRE(changed == std::vector<EntityId>{2, 1});
+}
+
+TEST_CASE("ComponentPool::Remove - Removed entities are recorded and skipped by the changed view", "[ecs][fast]") {
+    ChangeTick tick = 1;
+    auto pool = ComponentPool<TestClass>(0, &tick);
+    pool.Add(1, TestClass{.test_value = 1});
+    pool.Add(2, TestClass{.test_value = 2});
+
+    tick = 2;
+    pool.MarkChanged(1);
+    pool.Remove(1);
+    pool.MarkChanged(1);
+
+    std::vector<EntityId> changed;
+    for (const auto [component, entity]: pool.GetChanged(0)) {
+        changed.push_back(entity);
+    }
+    REQUIRE(changed == std::vector<EntityId>{2});
+
+    std::vector<EntityId> removed(pool.GetRemoved(1).begin(), pool.GetRemoved(1).end());
+    REQUIRE(removed == std::vector<EntityId>{1});
+}
+
+TEST_CASE("ComponentPool::TrimChanges - Drops records older than the tick", "[ecs][fast]") {
+    ChangeTick tick = 1;
+    auto pool = ComponentPool<TestClass>(0, &tick);
+    pool.Add(1, TestClass{.test_value = 1});
+    pool.Add(2, TestClass{.test_value = 2});
+    tick = 2;
+    pool.MarkChanged(2);
+
+    pool.TrimChanges(2);
+
+    REQUIRE(pool.GetAdded(0).Empty());
+    std::vector<EntityId> changed;
+    for (const auto [component, entity]: pool.GetChanged(0)) {
+        changed.push_back(entity);
+    }
+    REQUIRE(changed == std::vector<EntityId>{2});
+}
+
+TEST_CASE("ComponentPool::GetAdded - A recycled index is recorded again in the same tick", "[ecs][fast]") {
+    ChangeTick tick = 1;
+    auto pool = ComponentPool<TestClass>(0, &tick);
+    constexpr EntityId first_generation = 5;
+    constexpr EntityId second_generation = (1ull << INDEX_BITS) | 5;
+    pool.Add(first_generation, TestClass{.test_value = 1});
+    pool.Remove(first_generation);
+    pool.Add(second_generation, TestClass{.test_value = 2});
+
+    std::vector<EntityId> added;
+    for (const auto [component, entity]: pool.GetAdded(0)) {
+        REQUIRE(component->test_value == 2);
+        added.push_back(entity);
+    }
+    REQUIRE(added == std::vector<EntityId>{second_generation});
+    std::vector<EntityId> removed(pool.GetRemoved(0).begin(), pool.GetRemoved(0).end());
+    REQUIRE(removed == std::vector<EntityId>{first_generation});
+}
+
+TEST_CASE("ComponentPool::TrimChanges - Trimming every tick keeps the newer records", "[ecs][fast]") {
+    ChangeTick tick = 1;
+    auto pool = ComponentPool<TestClass>(0, &tick);
+    for (EntityId entity = 1; entity <= 8; ++entity) {
+        pool.Add(entity, TestClass{.test_value = static_cast<uint32_t>(entity)});
+    }
+    for (tick = 2; tick <= 100; ++tick) {
+        pool.MarkChanged(tick % 8 + 1);
+        pool.TrimChanges(tick - 1);
+        if (tick == 2) {
+            continue;
+        }
+
+        std::vector<EntityId> changed;
+        for (const auto [component, entity]: pool.GetChanged(0)) {
+            changed.push_back(entity);
+        }
+        REQUIRE(changed == std::vector<EntityId>{(tick - 1) % 8 + 1, tick % 8 + 1});
+    }
+    REQUIRE(pool.GetAdded(0).Empty());
+}
+
+TEST_CASE("ComponentPool::GetMemoryUsage - Sparse memory scales with the used index ranges", "[ecs][fast]") {
+    auto pool = ComponentPool<TestClass>(0);
+    pool.Add(EntityId{3}, TestClass{.test_value = 1});
+    pool.Add(EntityId{1'000'000}, TestClass{.test_value = 2});
+
+    const auto usage = pool.GetMemoryUsage();
+
+    REQUIRE(usage.component_count == 2);
+    REQUIRE(usage.component_capacity >= 2);
+    REQUIRE(usage.sparse_pages == 2);
+    // A flat sparse array would need one slot per entity index up to the highest one
+    REQUIRE(usage.sparse_bytes < 1'000'000 * sizeof(uint32_t));
+    REQUIRE(pool.Get(EntityId{1'000'000})->test_value == 2);
+    REQUIRE_FALSE(pool.Contains(EntityId{500'000}));
+}
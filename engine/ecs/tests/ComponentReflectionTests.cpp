@@ -0,0 +1,145 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace ReflectionTests {
+    struct Health {
+        int32_t current;
+        int32_t max;
+    };
+
+    struct Velocity {
+        friend struct Engine::Ecs::ComponentReflection<Velocity>;
+
+        [[nodiscard]] float GetSpeed() const { return m_speed; }
+
+    private:
+        float m_speed = 2.5f;
+        uint8_t m_flags = 7;
+    };
+}
+
+// Written the way the component code generator emits them
+namespace Engine::Ecs {
+    template<>
+    struct ComponentReflection<ReflectionTests::Health> {
+        using Type = ReflectionTests::Health;
+        static constexpr std::string_view name = "ReflectionTests::Health";
+        static constexpr uint64_t stable_id = HashName(name);
+        static constexpr std::array<ComponentField, 2> fields{{
+            {"current", "int32_t", offsetof(Type, current), sizeof(Type::current)},
+            {"max", "int32_t", offsetof(Type, max), sizeof(Type::max)},
+        }};
+    };
+
+    template<>
+    struct ComponentReflection<ReflectionTests::Velocity> {
+        using Type = ReflectionTests::Velocity;
+        static constexpr std::string_view name = "ReflectionTests::Velocity";
+        static constexpr uint64_t stable_id = HashName(name);
+        static constexpr std::array<ComponentField, 2> fields{{
+            {"m_speed", "float", offsetof(Type, m_speed), sizeof(Type::m_speed)},
+            {"m_flags", "uint8_t", offsetof(Type, m_flags), sizeof(Type::m_flags)},
+        }};
+    };
+}
+
+using ReflectionTests::Health;
+using ReflectionTests::Velocity;
+
+TEST_CASE("ComponentReflection - Stable ids are compile time hashes of the name", "[ecs][fast]") {
+    static_assert(HashName("") == 0xcbf29ce484222325);
+    static_assert(HashName("a") == 0xaf63dc4c8601ec8c);
+    static_assert(ComponentReflection<Health>::stable_id == HashName("ReflectionTests::Health"));
+    REQUIRE(ComponentReflection<Health>::stable_id != ComponentReflection<Velocity>::stable_id);
+}
+
+TEST_CASE("ComponentReflection - Only specialized types are reflected", "[ecs][fast]") {
+    STATIC_REQUIRE(ReflectedComponent<Health>);
+    STATIC_REQUIRE(ReflectedComponent<Velocity>);
+    STATIC_REQUIRE_FALSE(ReflectedComponent<int>);
+}
+
+TEST_CASE("ComponentTypeInfo - Describes the layout of a component", "[ecs][fast]") {
+    constexpr auto info = ComponentTypeInfo::Of<Velocity>();
+
+    REQUIRE(info.name == "ReflectionTests::Velocity");
+    REQUIRE(info.stable_id == ComponentReflection<Velocity>::stable_id);
+    REQUIRE(info.size == sizeof(Velocity));
+    REQUIRE(info.alignment == alignof(Velocity));
+    REQUIRE(info.fields.size() == 2);
+    REQUIRE(info.fields[0].name == "m_speed");
+    REQUIRE(info.fields[0].type_name == "float");
+    REQUIRE(info.fields[0].size == sizeof(float));
+    REQUIRE(info.fields[1].name == "m_flags");
+    REQUIRE(info.fields[1].offset > info.fields[0].offset);
+}
+
+TEST_CASE("ComponentReflection - ForEachField visits every field with its value", "[ecs][fast]") {
+    const Health health{40, 100};
+    std::vector<std::string> names;
+    std::vector<int32_t> values;
+
+    ForEachField(health, [&](const ComponentField& field, const void* value) {
+        names.emplace_back(field.name);
+        values.push_back(*static_cast<const int32_t*>(value));
+    });
+
+    REQUIRE(names == std::vector<std::string>{"current", "max"});
+    REQUIRE(values == std::vector<int32_t>{40, 100});
+
+    const Velocity velocity;
+    float speed = 0.0f;
+    ForEachField(velocity, [&](const ComponentField& field, const void* value) {
+        if (field.name == "m_speed") {
+            speed = *static_cast<const float*>(value);
+        }
+    });
+    REQUIRE(speed == velocity.GetSpeed());
+}
+
+TEST_CASE("World::RegisterComponentTypes - Type ids follow the table and pools are created up front", "[ecs][fast]") {
+    struct TableFirst {
+        int value;
+    };
+    struct TableSecond {
+        int value;
+    };
+    const std::array types{ComponentTypeInfo::Of<Velocity>(), ComponentTypeInfo::Of<Health>()};
+
+    World::RegisterComponentTypes(types, 256);
+    ComponentManager component_manager;
+
+    // Type ids are handed out process wide, so only their order is known here
+    const auto velocity_id = component_manager.GetComponentTypeId<Velocity>();
+    const auto health_id = component_manager.GetComponentTypeId<Health>();
+    REQUIRE(health_id == velocity_id + 1);
+    REQUIRE(component_manager.RegisterType<TableFirst>() > health_id);
+    REQUIRE(component_manager.RegisterType<TableSecond>() > health_id);
+
+    std::size_t reserved_pools = 0;
+    component_manager.ForEachPool([&](const ComponentTypeId id, const IComponentPool& pool) {
+        if (id == velocity_id || id == health_id) {
+            REQUIRE(pool.GetMemoryUsage().component_capacity >= 256);
+            ++reserved_pools;
+        }
+    });
+    REQUIRE(reserved_pools == 2);
+
+    World::RegisterComponentTypes({}, 0);
+    const ComponentManager empty_manager;
+    std::size_t pools = 0;
+    empty_manager.ForEachPool([&](ComponentTypeId, const IComponentPool&) { ++pools; });
+    REQUIRE(pools == 0);
+}
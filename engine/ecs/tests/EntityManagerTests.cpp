@@ -5,9 +5,13 @@
 #include <catch2/catch_all.hpp>
 #endif
 
+#include <algorithm>
+#include <vector>
+
 #include "../src/EntityManager.hpp"
 
 using namespace Engine::Ecs;
+using namespace Engine::Ecs::Literals;
 
 struct EntitymanagerFixture {
     EntityManager entity_manager;
@@ -78,3 +82,63 @@ TEST_CASE_METHOD(EntitymanagerFixture, "EntityManager::IsEntityPending: returns
                  "[ecs][fast]") {
     REQUIRE_FALSE(entity_manager.IsEntityPending(0));
 }
+
+TEST_CASE_METHOD(EntitymanagerFixture, "EntityManager::ReserveEntity: anonymous entities are not named",
+                 "[ecs][fast]") {
+    const auto entity = entity_manager.ReserveEntity();
+    entity_manager.CommitEntity(entity);
+    REQUIRE(entity_manager.IsEntityAlive(entity));
+
+    entity_manager.DestroyEntity(entity);
+    REQUIRE_FALSE(entity_manager.IsEntityAlive(entity));
+    REQUIRE(entity_manager.GetEntityByName("") == INVALID_ENTITY_ID);
+}
+
+TEST_CASE_METHOD(EntitymanagerFixture, "EntityManager::ReserveEntities: reuses free indices before new ones",
+                 "[ecs][fast]") {
+    const auto destroyed = entity_manager.ReserveEntity("E1");
+    entity_manager.CommitEntity(destroyed);
+    entity_manager.DestroyEntity(destroyed);
+
+    std::vector<EntityId> entities(100);
+    entity_manager.ReserveEntities(entities);
+    REQUIRE(GetEntityIndex(entities[0]) == GetEntityIndex(destroyed));
+    REQUIRE(entities[0] != destroyed);
+    for (const auto entity: entities) {
+        REQUIRE(entity_manager.IsEntityPending(entity));
+    }
+
+    entity_manager.CommitEntities(entities);
+    REQUIRE(entity_manager.GetAllActiveEntities().size() == entities.size());
+    std::ranges::sort(entities);
+    REQUIRE(std::ranges::adjacent_find(entities) == entities.end());
+}
+
+TEST_CASE_METHOD(EntitymanagerFixture, "EntityManager::GetEntityByName: finds entities by name id", "[ecs][fast]") {
+    const auto entity = entity_manager.ReserveEntity("Player");
+
+    REQUIRE(entity_manager.GetEntityByName("Player"_name) == entity);
+    REQUIRE(entity_manager.GetEntityByName("Enemy"_name) == INVALID_ENTITY_ID);
+    REQUIRE_THROWS_AS(entity_manager.ReserveEntity("Player"), std::runtime_error);
+}
+
+TEST_CASE_METHOD(EntitymanagerFixture, "EntityManager::GetSignature: tracks components until destroyed", "[ecs][fast]") {
+    const auto entity = entity_manager.ReserveEntity();
+    entity_manager.CommitEntity(entity);
+
+    entity_manager.AddToSignature(entity, 3);
+    entity_manager.AddToSignature(entity, 70);
+    entity_manager.RemoveFromSignature(entity, 3);
+    REQUIRE_FALSE(entity_manager.GetSignature(entity).Test(3));
+    REQUIRE(entity_manager.GetSignature(entity).Test(70));
+    REQUIRE(entity_manager.GetSignature(entity).Count() == 1);
+
+    entity_manager.DestroyEntity(entity);
+    REQUIRE(entity_manager.GetSignature(entity).Empty());
+
+    // The reused index starts without components, the stale entity is ignored
+    const auto reused = entity_manager.ReserveEntity();
+    REQUIRE(GetEntityIndex(reused) == GetEntityIndex(entity));
+    entity_manager.AddToSignature(entity, 5);
+    REQUIRE(entity_manager.GetSignature(reused).Empty());
+}
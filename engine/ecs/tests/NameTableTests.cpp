@@ -0,0 +1,29 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include "../src/NameTable.hpp"
+
+using namespace Engine::Ecs;
+using namespace Engine::Ecs::Literals;
+
+TEST_CASE("NameTable::Intern - Ids match the compile time literal", "[ecs][fast]") {
+    NameTable table;
+
+    const auto name_id = table.Intern("Player");
+
+    static_assert("Player"_name == HashName("Player"));
+    REQUIRE(name_id == "Player"_name);
+    REQUIRE(table.Intern("Player") == name_id);
+    REQUIRE(table.Intern("Enemy") != name_id);
+}
+
+TEST_CASE("NameTable::GetName - Returns the interned string", "[ecs][fast]") {
+    NameTable table;
+    const auto name_id = table.Intern("KeyIndicator");
+
+    REQUIRE(table.GetName(name_id) == "KeyIndicator");
+    REQUIRE(table.GetName("Unknown"_name).empty());
+}
@@ -0,0 +1,53 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cstdint>
+#include <limits>
+
+#include "../src/PagedSparseArray.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    constexpr uint32_t EMPTY = std::numeric_limits<uint32_t>::max();
+    using DenseIndices = PagedSparseArray<uint32_t, EMPTY, 1024>;
+}
+
+TEST_CASE("PagedSparseArray::Get - Missing pages read as empty without allocating", "[ecs][fast]") {
+    const DenseIndices array;
+
+    REQUIRE(array.Get(0) == EMPTY);
+    REQUIRE(array.Get(1'000'000) == EMPTY);
+    REQUIRE(array.GetAllocatedPageCount() == 0);
+}
+
+TEST_CASE("PagedSparseArray::GetOrCreate - Only allocates the pages of written indices", "[ecs][fast]") {
+    DenseIndices array;
+
+    array.GetOrCreate(5) = 1;
+    array.GetOrCreate(100'000) = 2;
+    array.GetOrCreate(100'001) = 3;
+
+    REQUIRE(array.GetAllocatedPageCount() == 2);
+    REQUIRE(array.Get(5) == 1);
+    REQUIRE(array.Get(6) == EMPTY);
+    REQUIRE(array.GetUnchecked(100'000) == 2);
+    REQUIRE(array.Get(100'001) == 3);
+    REQUIRE(array.Get(50'000) == EMPTY);
+    REQUIRE(array.GetMemoryUsage() >= 2 * 1024 * sizeof(uint32_t));
+}
+
+TEST_CASE("PagedSparseArray::SetUnchecked - Overwrites values of existing pages", "[ecs][fast]") {
+    DenseIndices array;
+    array.GetOrCreate(2048) = 7;
+
+    array.SetUnchecked(2048, EMPTY);
+    array.SetUnchecked(2049, 9);
+
+    REQUIRE(array.Get(2048) == EMPTY);
+    REQUIRE(array.Get(2049) == 9);
+    REQUIRE(array.GetAllocatedPageCount() == 1);
+}
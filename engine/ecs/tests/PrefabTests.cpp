@@ -0,0 +1,140 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <vector>
+
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    struct PrefabPosition {
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    struct PrefabMesh {
+        int mesh = 0;
+    };
+
+    struct PrefabCollider {
+        float size = 0.0f;
+    };
+
+    Prefab CreateTilePrefab() {
+        Prefab prefab;
+        prefab.With(PrefabPosition{1.0f, 2.0f}).With(PrefabMesh{7});
+        return prefab;
+    }
+}
+
+TEST_CASE("Prefab - With replaces the default of the same type", "[ecs][fast]") {
+    Prefab prefab;
+    prefab.With(PrefabMesh{1}).With(PrefabMesh{2}).With(PrefabPosition{});
+
+    REQUIRE(prefab.GetComponentCount() == 2);
+    REQUIRE(prefab.Has<PrefabMesh>());
+    REQUIRE_FALSE(prefab.Has<PrefabCollider>());
+
+    World world;
+    EntityId entity = INVALID_ENTITY_ID;
+    world.Instantiate(prefab, 1, std::span(&entity, 1));
+    world.ApplyEngineEvents();
+    REQUIRE(world.GetComponent<PrefabMesh>(entity)->mesh == 2);
+}
+
+TEST_CASE("World::Instantiate - Instances start with the components of the prefab", "[ecs][fast]") {
+    World world;
+    const auto prefab = CreateTilePrefab();
+    std::vector<EntityId> entities(100);
+
+    world.Instantiate(prefab, entities.size(), entities);
+    REQUIRE(world.GetComponentView<PrefabMesh>().Size() == 0);
+    world.ApplyEngineEvents();
+
+    REQUIRE(world.GetComponentView<PrefabMesh>().Size() == 100);
+    for (const auto entity: entities) {
+        REQUIRE(entity != INVALID_ENTITY_ID);
+        REQUIRE(world.HasComponents<PrefabPosition, PrefabMesh>(entity));
+        REQUIRE(world.GetComponent<PrefabPosition>(entity)->y == 2.0f);
+        REQUIRE(world.GetComponent<PrefabMesh>(entity)->mesh == 7);
+    }
+}
+
+TEST_CASE("World::Instantiate - Overrides set per instance components", "[ecs][fast]") {
+    World world;
+    const auto prefab = CreateTilePrefab();
+    const std::vector<PrefabPosition> positions{{0.0f, 0.0f}, {1.0f, 0.0f}, {2.0f, 0.0f}};
+    const std::vector<PrefabCollider> colliders{{0.5f}, {1.5f}, {2.5f}};
+    PrefabOverrides overrides;
+    overrides.Set<PrefabPosition>(positions).Set<PrefabCollider>(colliders);
+
+    std::vector<EntityId> entities(3);
+    world.Instantiate(prefab, entities.size(), entities, overrides);
+    world.ApplyEngineEvents();
+
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        REQUIRE(world.GetComponent<PrefabPosition>(entities[i])->x == static_cast<float>(i));
+        REQUIRE(world.GetComponent<PrefabMesh>(entities[i])->mesh == 7);
+        REQUIRE(world.GetComponent<PrefabCollider>(entities[i])->size == colliders[i].size);
+    }
+}
+
+TEST_CASE("World::Instantiate - Add events are raised once all components exist", "[ecs][fast]") {
+    World world;
+    const auto prefab = CreateTilePrefab();
+    std::size_t batches = 0;
+    std::size_t batched_entities = 0;
+    std::size_t single_events = 0;
+    world.GetComponentEventBus()->SubscribeOnComponentsAddEvent<PrefabPosition>(
+            [&](const std::span<const EntityId> entities) {
+                batches++;
+                batched_entities += entities.size();
+            });
+    world.GetComponentEventBus()->SubscribeOnComponentAddEvent<PrefabPosition>(
+            [&](const EntityId entity, const PrefabPosition&) {
+                // The mesh is written after the position, but its pool is filled before any event is raised
+                REQUIRE(world.GetComponent<PrefabMesh>(entity) != nullptr);
+                single_events++;
+            });
+
+    std::vector<EntityId> entities(50);
+    world.Instantiate(prefab, entities.size(), entities);
+    world.ApplyEngineEvents();
+
+    REQUIRE(batches == 1);
+    REQUIRE(batched_entities == 50);
+    REQUIRE(single_events == 50);
+}
+
+TEST_CASE("World::Instantiate - Rejects spans smaller than the instance count", "[ecs][fast]") {
+    World world;
+    const auto prefab = CreateTilePrefab();
+    std::vector<EntityId> entities(2);
+    REQUIRE_THROWS_AS(world.Instantiate(prefab, 3, entities), std::invalid_argument);
+
+    const std::vector<PrefabPosition> positions(1);
+    PrefabOverrides overrides;
+    overrides.Set<PrefabPosition>(positions);
+    REQUIRE_THROWS_AS(world.Instantiate(prefab, 2, entities, overrides), std::invalid_argument);
+
+    world.ApplyEngineEvents();
+    REQUIRE(world.GetComponentView<PrefabPosition>().Size() == 0);
+}
+
+TEST_CASE("World::AddComponents - Raises the batch add event once", "[ecs][fast]") {
+    World world;
+    std::size_t batches = 0;
+    world.GetComponentEventBus()->SubscribeOnComponentsAddEvent<PrefabMesh>(
+            [&batches](std::span<const EntityId>) { batches++; });
+
+    std::vector<EntityId> entities(10);
+    world.CreateEntities(entities.size(), entities);
+    world.AddComponents<PrefabMesh>(entities, std::vector<PrefabMesh>(entities.size(), PrefabMesh{3}));
+    world.ApplyEngineEvents();
+
+    REQUIRE(batches == 1);
+}
@@ -0,0 +1,168 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <vector>
+
+#include "../include/SystemWorld.hpp"
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    struct QueryPosition {
+        float x;
+        float y;
+    };
+
+    struct QueryVelocity {
+        float x;
+        float y;
+    };
+
+    struct QueryFrozen {
+    };
+
+    std::vector<EntityId> Collect(const auto& query) {
+        std::vector<EntityId> entities;
+        for (const auto& tuple: query) {
+            entities.push_back(std::get<0>(tuple));
+        }
+        return entities;
+    }
+}
+
+TEST_CASE("World::RegisterQuery - Is filled with the existing entities", "[ecs][fast]") {
+    World world;
+    const auto moving = world.CreateEntity();
+    const auto still = world.CreateEntity();
+    world.AddComponent(moving, QueryPosition{1.0f, 2.0f});
+    world.AddComponent(moving, QueryVelocity{3.0f, 4.0f});
+    world.AddComponent(still, QueryPosition{5.0f, 6.0f});
+    world.ApplyEngineEvents();
+
+    const auto query = world.RegisterQuery<QueryPosition, const QueryVelocity>();
+
+    REQUIRE(query.Size() == 1);
+    for (const auto [entity, position, velocity]: query) {
+        REQUIRE(entity == moving);
+        position.x += velocity.x;
+    }
+    REQUIRE(world.GetComponent<QueryPosition>(moving)->x == 4.0f);
+}
+
+TEST_CASE("World::RegisterQuery - Follows added and removed components after the events are applied",
+          "[ecs][fast]") {
+    World world;
+    const auto query = world.RegisterQuery<QueryPosition, QueryVelocity>();
+    REQUIRE(query.Empty());
+
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, QueryPosition{});
+    world.ApplyEngineEvents();
+    REQUIRE(query.Empty());
+
+    world.AddComponent(entity, QueryVelocity{});
+    REQUIRE(query.Empty());
+    world.ApplyEngineEvents();
+    REQUIRE(Collect(query) == std::vector{entity});
+
+    world.RemoveComponent<QueryPosition>(entity);
+    world.ApplyEngineEvents();
+    REQUIRE(query.Empty());
+}
+
+TEST_CASE("World::RegisterQuery - Skips entities owning an excluded component", "[ecs][fast]") {
+    World world;
+    const auto query = world.RegisterQuery<const QueryPosition>(Exclude<QueryFrozen>{});
+    const auto moving = world.CreateEntity();
+    const auto frozen = world.CreateEntity();
+    world.AddComponent(moving, QueryPosition{});
+    world.AddComponent(frozen, QueryPosition{});
+    world.AddComponent(frozen, QueryFrozen{});
+    world.ApplyEngineEvents();
+    REQUIRE(Collect(query) == std::vector{moving});
+
+    world.RemoveComponent<QueryFrozen>(frozen);
+    world.ApplyEngineEvents();
+    REQUIRE(Collect(query) == std::vector{moving, frozen});
+}
+
+TEST_CASE("World::RegisterQuery - Keeps the entities sorted by index", "[ecs][fast]") {
+    World world;
+    const auto query = world.RegisterQuery<QueryPosition>();
+    std::vector<EntityId> entities(64);
+    world.CreateEntities(entities.size(), entities);
+    // Added in reverse and with gaps, so the list has to be sorted and compacted
+    for (auto it = entities.rbegin(); it != entities.rend(); ++it) {
+        world.AddComponent(*it, QueryPosition{});
+    }
+    world.ApplyEngineEvents();
+    for (std::size_t i = 0; i < entities.size(); i += 3) {
+        world.DestroyEntity(entities[i]);
+    }
+    world.ApplyEngineEvents();
+
+    const auto listed = query.GetEntities();
+    REQUIRE(listed.size() == entities.size() - 22);
+    for (std::size_t i = 1; i < listed.size(); ++i) {
+        REQUIRE(GetEntityIndex(listed[i - 1]) < GetEntityIndex(listed[i]));
+    }
+}
+
+TEST_CASE("World::RegisterQuery - Queries over the same components share their entities", "[ecs][fast]") {
+    World world;
+    SystemWorld system_world(&world);
+    const auto first = world.RegisterQuery<QueryPosition, QueryVelocity>();
+    const auto second = system_world.RegisterQuery<const QueryPosition, const QueryVelocity>();
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, QueryPosition{});
+    world.AddComponent(entity, QueryVelocity{});
+    world.ApplyEngineEvents();
+
+    REQUIRE(first.GetEntities().data() == second.GetEntities().data());
+    REQUIRE(Collect(second) == std::vector{entity});
+}
+
+TEST_CASE("World::RegisterQuery - Drops entities that are destroyed or reset", "[ecs][fast]") {
+    World world;
+    const auto query = world.RegisterQuery<QueryPosition>();
+    const auto destroyed = world.CreateEntity();
+    world.AddComponent(destroyed, QueryPosition{});
+    world.ApplyEngineEvents();
+
+    world.DestroyEntity(destroyed);
+    const auto replacement = world.CreateEntity();
+    world.AddComponent(replacement, QueryPosition{7.0f, 0.0f});
+    world.ApplyEngineEvents();
+    REQUIRE(Collect(query) == std::vector{replacement});
+    REQUIRE(std::get<1>(*query.begin()).x == 7.0f);
+
+    world.Reset();
+    REQUIRE(query.Empty());
+
+    const auto after_reset = world.CreateEntity();
+    world.AddComponent(after_reset, QueryPosition{});
+    world.ApplyEngineEvents();
+    REQUIRE(Collect(query) == std::vector{after_reset});
+}
+
+TEST_CASE("World::RegisterQuery - Is rebuilt from a restored snapshot", "[ecs][fast]") {
+    World world;
+    const auto query = world.RegisterQuery<QueryPosition>();
+    const auto kept = world.CreateEntity();
+    world.AddComponent(kept, QueryPosition{});
+    world.ApplyEngineEvents();
+    const auto snapshot = world.Snapshot();
+
+    const auto added = world.CreateEntity();
+    world.AddComponent(added, QueryPosition{});
+    world.RemoveComponent<QueryPosition>(kept);
+    world.ApplyEngineEvents();
+    REQUIRE(Collect(query) == std::vector{added});
+
+    world.Restore(snapshot);
+    REQUIRE(Collect(query) == std::vector{kept});
+}
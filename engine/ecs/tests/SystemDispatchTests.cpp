@@ -0,0 +1,91 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <string>
+#include <vector>
+
+#include "../include/SystemDispatch.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    class RunOnlySystem : public ISystem {
+    public:
+        std::vector<float> runs;
+
+        void Run(const float delta_time) override {
+            runs.push_back(delta_time);
+        }
+    };
+
+    class TriggerSystem final : public ISystem {
+    public:
+        std::vector<std::string> calls;
+
+        void Run(float) override {
+            calls.emplace_back("Run");
+        }
+
+        void OnTriggerEnter(const EntityId& target, const EntityId& other) override {
+            calls.push_back("TriggerEnter " + std::to_string(target) + " " + std::to_string(other));
+        }
+    };
+
+    class DerivedRunOnlySystem final : public RunOnlySystem {
+    public:
+        void OnCollisionExit(const EntityId&, const EntityId&) override {
+            runs.push_back(-1.0f);
+        }
+    };
+}
+
+TEST_CASE("MakeSystemDispatch - Run calls the concrete system", "[ecs][fast]") {
+    constexpr auto dispatch = MakeSystemDispatch<RunOnlySystem>();
+    RunOnlySystem system;
+
+    REQUIRE(dispatch.run != nullptr);
+    dispatch.run(system, 0.5f);
+    dispatch.run(system, 0.25f);
+
+    REQUIRE(system.runs == std::vector{0.5f, 0.25f});
+}
+
+TEST_CASE("MakeSystemDispatch - Callbacks that are not overridden stay null", "[ecs][fast]") {
+    constexpr auto dispatch = MakeSystemDispatch<RunOnlySystem>();
+
+    REQUIRE(dispatch.on_collision_enter == nullptr);
+    REQUIRE(dispatch.on_collision_exit == nullptr);
+    REQUIRE(dispatch.on_trigger_enter == nullptr);
+    REQUIRE(dispatch.on_trigger_exit == nullptr);
+}
+
+TEST_CASE("MakeSystemDispatch - Only overridden callbacks are dispatched", "[ecs][fast]") {
+    constexpr auto dispatch = MakeSystemDispatch<TriggerSystem>();
+    TriggerSystem system;
+
+    REQUIRE(dispatch.on_collision_enter == nullptr);
+    REQUIRE(dispatch.on_collision_exit == nullptr);
+    REQUIRE(dispatch.on_trigger_exit == nullptr);
+    REQUIRE(dispatch.on_trigger_enter != nullptr);
+
+    dispatch.on_trigger_enter(system, 3, 7);
+    dispatch.run(system, 0.0f);
+
+    REQUIRE(system.calls == std::vector<std::string>{"TriggerEnter 3 7", "Run"});
+}
+
+TEST_CASE("MakeSystemDispatch - Overrides of a base class are dispatched", "[ecs][fast]") {
+    constexpr auto dispatch = MakeSystemDispatch<DerivedRunOnlySystem>();
+    DerivedRunOnlySystem system;
+
+    REQUIRE(dispatch.on_collision_enter == nullptr);
+    REQUIRE(dispatch.on_collision_exit != nullptr);
+
+    dispatch.run(system, 1.0f);
+    dispatch.on_collision_exit(system, 1, 2);
+
+    REQUIRE(system.runs == std::vector{1.0f, -1.0f});
+}
@@ -4,6 +4,8 @@
 #include <catch2/catch_all.hpp>
 #endif
 
+#include <atomic>
+
 #include "../include/SystemManager.hpp"
 
 using namespace Engine::Ecs;
@@ -91,11 +93,56 @@ public:
     }
 };
 
+static std::atomic<int> parallel_runs = 0;
+
+class TestSysParallel final : public ISystem {
+public:
+    void Run(float delta_time) override {
+        parallel_runs++;
+        SendCommand(TestCommand{.value = "Parallel"});
+    }
+};
+
+struct TrackedValue {
+    int value;
+};
+
+static int tracked_writes_per_frame = 0;
+static std::vector<std::size_t> tracked_changes;
+
+class TestSysWriter final : public ISystem {
+public:
+    void Run(float delta_time) override {
+        int written = 0;
+        for (const auto [value, entity]: GameWorld()->GetComponentView<TrackedValue>()) {
+            if (written++ == tracked_writes_per_frame) {
+                break;
+            }
+            GameWorld()->Modify<TrackedValue>(entity)->value++;
+        }
+    }
+};
+
+class TestSysReader final : public ISystem {
+public:
+    void Run(float delta_time) override {
+        std::size_t changes = 0;
+        for (const auto _: GameWorld()->Changed<TrackedValue>(LastRunTick())) {
+            changes++;
+        }
+        tracked_changes.push_back(changes);
+    }
+};
+
+static std::unique_ptr<ISystem> MakeWriter() { return std::make_unique<TestSysWriter>(); }
+static std::unique_ptr<ISystem> MakeReader() { return std::make_unique<TestSysReader>(); }
+
 static std::unique_ptr<ISystem> MakeA() { return std::make_unique<TestSysA>(); }
 static std::unique_ptr<ISystem> MakeB() { return std::make_unique<TestSysB>(); }
 static std::unique_ptr<ISystem> MakeC() { return std::make_unique<TestSysC>(); }
 static std::unique_ptr<ISystem> MakeD() { return std::make_unique<TestSysD>(); }
 static std::unique_ptr<ISystem> MakeE() { return std::make_unique<TestSysE>(); }
+static std::unique_ptr<ISystem> MakeParallel() { return std::make_unique<TestSysParallel>(); }
 
 TEST_CASE("SystemManger::Register - Register different systems and check their execution order") {
     SystemMeta system_a{
@@ -148,7 +195,7 @@ TEST_CASE("SystemManger::Register - Register different systems and check their e
 TEST_CASE("SystemManager - Push Commands from System to World") {
     const SystemMeta system_a{
         .name = "SystemA",
-        .phase = Phase::Input,
+        .phase = Phase::Update,
         .tags = std::vector<std::string>{"ENGINE"},
         .factory = &MakeA
     };
@@ -158,14 +205,12 @@ TEST_CASE("SystemManager - Push Commands from System to World") {
     const std::vector<SystemMeta> systems{system_a};
     ISystemManager* system_manager = new SystemManager(systems, nullptr, nullptr);
     system_manager->RegisterSystems(world, nullptr);
-    system_manager->RegisterForSystemCommands("TestSubscription",
-                                              [&callback_called](const std::vector<std::any>& commands) {
-                                                  callback_called++;
-                                              }
-            );
+    const auto subscription = world->GetCommandBus()->Subscribe<TestCommand>([&callback_called](const TestCommand&) {
+        callback_called++;
+    });
     system_manager->UpdateSystems(0.0f);
     REQUIRE(callback_called == 1);
-    system_manager->DeregisterForSystemCommands("TestSubscription");
+    world->GetCommandBus()->Unsubscribe(subscription);
     system_manager->UpdateSystems(0.0f);
     REQUIRE(callback_called == 1);
     delete system_manager;
@@ -179,44 +224,171 @@ TEST_CASE("SystemManager - Receive Pysics Events in Systems") {
         .factory = &MakeC
     };
     const auto world = new World();
-    std::string callback_value = "";
+    std::vector<std::string> received;
 
     const std::vector<SystemMeta> systems{system_c};
     ISystemManager* system_manager = new SystemManager(systems, nullptr, nullptr);
     system_manager->RegisterSystems(world, nullptr);
-    system_manager->RegisterForSystemCommands("TestSubscription",
-                                              [&callback_value](const std::vector<std::any>& commands) {
-                                                  if (commands.empty()) {
-                                                      callback_value = "No_Commands";
-                                                      return;
-                                                  }
-                                                  if (commands.size() > 1) {
-                                                      callback_value = "Too_many_commands";
-                                                      return;
-                                                  }
-                                                  auto test_command = any_cast<TestCommand>(commands[0]);
-                                                  callback_value = test_command.value;
-                                              }
-            );
+    world->GetCommandBus()->Subscribe<TestCommand>([&received](const TestCommand& command) {
+        received.push_back(command.value);
+    });
+    // Only a single command is expected per frame
+    const auto last_command = [&received] {
+        return received.size() == 1 ? received.back() : "Unexpected_command_count";
+    };
     world->GetPhysicsEventBuffer()->EnqueueEvent(PhysicsEvent{PhysicsEventType::OnCollisionEnter, 0, 0});
     world->ApplyEngineEvents();
+    received.clear();
     system_manager->UpdateSystems(0.0f);
-    REQUIRE(callback_value == "CollisionEnter");
+    REQUIRE(last_command() == "CollisionEnter");
 
     world->GetPhysicsEventBuffer()->EnqueueEvent(PhysicsEvent{PhysicsEventType::OnCollisionExit, 0, 0});
     world->ApplyEngineEvents();
+    received.clear();
     system_manager->UpdateSystems(0.0f);
-    REQUIRE(callback_value == "CollisionExit");
+    REQUIRE(last_command() == "CollisionExit");
 
     world->GetPhysicsEventBuffer()->EnqueueEvent(PhysicsEvent{PhysicsEventType::OnTriggerEnter, 0, 0});
     world->ApplyEngineEvents();
+    received.clear();
+    system_manager->UpdateSystems(0.0f);
+    REQUIRE(last_command() == "TriggerEnter");
+
+    world->GetPhysicsEventBuffer()->EnqueueEvent(PhysicsEvent{PhysicsEventType::OnTriggerExit, 0, 0});
+    world->ApplyEngineEvents();
+    received.clear();
+    system_manager->UpdateSystems(0.0f);
+    REQUIRE(last_command() == "TriggerExit");
+
+    delete system_manager;
+}
+
+TEST_CASE("SystemManager - Systems with a generated dispatch run and receive physics events") {
+    const SystemMeta system_c{
+        .name = "SystemC",
+        .phase = Phase::Update,
+        .tags = std::vector<std::string>(),
+        .factory = &MakeC,
+        .dispatch = MakeSystemDispatch<TestSysC>()
+    };
+    const auto world = new World();
+    std::vector<std::string> received;
+
+    const std::vector<SystemMeta> systems{system_c};
+    ISystemManager* system_manager = new SystemManager(systems, nullptr, nullptr);
+    system_manager->RegisterSystems(world, nullptr);
+    world->GetCommandBus()->Subscribe<TestCommand>([&received](const TestCommand& command) {
+        received.push_back(command.value);
+    });
+
+    trace.clear();
     system_manager->UpdateSystems(0.0f);
-    REQUIRE(callback_value == "TriggerEnter");
+    REQUIRE(trace == std::vector<std::string>{"C"});
+    REQUIRE(received == std::vector<std::string>{"None"});
 
     world->GetPhysicsEventBuffer()->EnqueueEvent(PhysicsEvent{PhysicsEventType::OnTriggerExit, 0, 0});
     world->ApplyEngineEvents();
+    received.clear();
     system_manager->UpdateSystems(0.0f);
-    REQUIRE(callback_value == "TriggerExit");
+    REQUIRE(received == std::vector<std::string>{"TriggerExit"});
+
+    delete system_manager;
+}
+
+TEST_CASE("SystemManager - Systems with declared access run in the same stage") {
+    std::vector<SystemMeta> systems;
+    for (int i = 0; i < 4; ++i) {
+        systems.push_back(SystemMeta{
+            .name = "Parallel" + std::to_string(i),
+            .phase = Phase::Update,
+            .access = SystemAccess{.reads = {"Transform"}, .writes = {"Cache" + std::to_string(i)}},
+            .factory = &MakeParallel
+        });
+    }
+    const auto world = new World();
+    std::size_t command_count = 0;
+
+    ISystemManager* system_manager = new SystemManager(systems, nullptr, nullptr);
+    system_manager->RegisterSystems(world, nullptr);
+    world->GetCommandBus()->Subscribe<TestCommand>([&command_count](const TestCommand&) {
+        command_count++;
+    });
+    parallel_runs = 0;
+    for (int frame = 0; frame < 10; ++frame) {
+        system_manager->UpdateSystems(0.0f);
+    }
 
+    REQUIRE(parallel_runs == 40);
+    REQUIRE(command_count == 40);
+    delete system_manager;
+}
+
+TEST_CASE("SystemManager - Systems see the changes since their last run") {
+    const std::vector systems{
+        SystemMeta{.name = "Writer", .phase = Phase::Update, .factory = &MakeWriter},
+        SystemMeta{.name = "Reader", .phase = Phase::LateUpdate, .factory = &MakeReader},
+    };
+    const auto world = new World();
+    for (int i = 0; i < 10; ++i) {
+        world->AddComponent(world->CreateEntity(), TrackedValue{0});
+    }
+    world->ApplyEngineEvents();
+
+    ISystemManager* system_manager = new SystemManager(systems, nullptr, nullptr);
+    system_manager->RegisterSystems(world, nullptr);
+    tracked_changes.clear();
+    for (const auto writes: {0, 3, 0, 10}) {
+        tracked_writes_per_frame = writes;
+        system_manager->UpdateSystems(0.0f);
+    }
+
+    // The first run sees the components added before it
+    REQUIRE(tracked_changes == std::vector<std::size_t>{10, 3, 0, 10});
+    delete system_manager;
+    delete world;
+}
+
+TEST_CASE("SystemManager - Reports the timings and queried entities of every system") {
+    const std::vector systems{
+        SystemMeta{.name = "Writer", .phase = Phase::Update, .factory = &MakeWriter},
+        SystemMeta{.name = "Reader", .phase = Phase::LateUpdate, .factory = &MakeReader},
+    };
+    const auto world = new World();
+    for (int i = 0; i < 25; ++i) {
+        world->AddComponent(world->CreateEntity(), TrackedValue{0});
+    }
+    world->ApplyEngineEvents();
+
+    auto* system_manager = new SystemManager(systems, nullptr, nullptr);
+    system_manager->RegisterSystems(world, nullptr);
+    tracked_writes_per_frame = 0;
+    for (int frame = 0; frame < 5; ++frame) {
+        system_manager->UpdateSystems(0.0f);
+    }
+
+    const auto report = system_manager->GetTimingReport();
+    REQUIRE(report.systems.size() == 3);
+    REQUIRE(report.systems[0].name == "Writer");
+    REQUIRE(report.systems[0].time.samples == 5);
+    REQUIRE(report.systems[0].queried_entities == 25);
+    REQUIRE(report.systems[1].name == "Reader");
+    REQUIRE(report.systems[1].queried_entities == 0);
+    REQUIRE(report.systems[2].name == "CommandSystem");
+    REQUIRE(report.systems[2].phase == Phase::Commands);
+
+    std::vector<Phase> phases;
+    for (const auto& phase: report.phases) {
+        REQUIRE(phase.time.samples == 5);
+        phases.push_back(phase.phase);
+    }
+    REQUIRE(phases == std::vector{
+        Phase::Ui, Phase::Update, Phase::EngineEvents, Phase::LateUpdate, Phase::Commands, Phase::Render
+    });
+
+    const auto csv = report.ToCsv();
+    REQUIRE(csv.find("system,Writer,Update,5,") != std::string::npos);
+    const auto json = report.ToJson();
+    REQUIRE(json.find("\"name\": \"Reader\"") != std::string::npos);
     delete system_manager;
+    delete world;
 }
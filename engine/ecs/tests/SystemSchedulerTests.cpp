@@ -0,0 +1,86 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include "../src/SystemScheduler.hpp"
+using namespace Engine::Ecs;
+
+namespace {
+    SystemMeta MakeMeta(const std::string& name,
+                        std::optional<SystemAccess> access,
+                        std::vector<std::string> dependencies = {}) {
+        return SystemMeta{
+            .name = name,
+            .phase = Phase::Update,
+            .tags = {},
+            .dependencies = std::move(dependencies),
+            .access = std::move(access),
+            .factory = nullptr
+        };
+    }
+
+    SystemAccess Access(std::vector<std::string> reads, std::vector<std::string> writes) {
+        return SystemAccess{.reads = std::move(reads), .writes = std::move(writes)};
+    }
+}
+
+TEST_CASE("SystemScheduler - systems without conflicts share a stage", "[ecs][systems][scheduling]") {
+    const std::vector input{
+        MakeMeta("A", Access({"Transform"}, {"TransformCache"})),
+        MakeMeta("B", Access({"Transform", "Camera"}, {"CameraCache"})),
+        MakeMeta("C", Access({}, {"Door"})),
+    };
+
+    const auto stages = SystemScheduler::BuildStages(input);
+
+    REQUIRE(stages == std::vector<std::vector<std::size_t> >{{0, 1, 2}});
+}
+
+TEST_CASE("SystemScheduler - conflicting writes keep the sorted order", "[ecs][systems][scheduling]") {
+    const std::vector input{
+        MakeMeta("Door", Access({}, {"Door", "Transform"})),
+        MakeMeta("Exit", Access({}, {})),
+        MakeMeta("Key", Access({"KeyItem"}, {"Transform"})),
+        MakeMeta("Renderer", Access({"Transform"}, {})),
+    };
+
+    const auto stages = SystemScheduler::BuildStages(input);
+
+    REQUIRE(stages == std::vector<std::vector<std::size_t> >{{0, 1}, {2}, {3}});
+}
+
+TEST_CASE("SystemScheduler - concurrent reads do not conflict", "[ecs][systems][scheduling]") {
+    const auto reader_a = MakeMeta("A", Access({"Transform"}, {}));
+    const auto reader_b = MakeMeta("B", Access({"Transform"}, {}));
+    const auto writer = MakeMeta("C", Access({}, {"Transform"}));
+
+    REQUIRE_FALSE(SystemScheduler::Conflicts(reader_a, reader_b));
+    REQUIRE(SystemScheduler::Conflicts(reader_a, writer));
+    REQUIRE(SystemScheduler::Conflicts(writer, reader_b));
+}
+
+TEST_CASE("SystemScheduler - systems without declared access run alone", "[ecs][systems][scheduling]") {
+    const std::vector input{
+        MakeMeta("A", Access({"Transform"}, {})),
+        MakeMeta("B", std::nullopt),
+        MakeMeta("C", Access({"Transform"}, {})),
+        MakeMeta("D", Access({"Camera"}, {})),
+    };
+
+    const auto stages = SystemScheduler::BuildStages(input);
+
+    REQUIRE(stages == std::vector<std::vector<std::size_t> >{{0}, {1}, {2, 3}});
+}
+
+TEST_CASE("SystemScheduler - explicit dependencies are conflicts", "[ecs][systems][scheduling]") {
+    const std::vector input{
+        MakeMeta("A", Access({"Transform"}, {})),
+        MakeMeta("B", Access({"Camera"}, {}), {"A"}),
+    };
+
+    const auto stages = SystemScheduler::BuildStages(input);
+
+    REQUIRE(stages == std::vector<std::vector<std::size_t> >{{0}, {1}});
+}
@@ -28,6 +28,7 @@ TEST_CASE("SceneWorldTests - Test Scene World Facade") {
     REQUIRE(world_components.size() == test_components.size());
     REQUIRE(world_components[0].first == test_components[0].first);
     REQUIRE(world_components[0].second == test_components[0].second);
+    REQUIRE(scene_world->View<int>().SizeHint() == 1);
 
     scene_world->RemoveComponent<int>(entity_id);
     world->ApplyEngineEvents();
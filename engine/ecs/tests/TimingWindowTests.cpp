@@ -0,0 +1,44 @@
+#if __APPLE__
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include "../src/TimingWindow.hpp"
+
+using namespace Engine::Ecs;
+
+TEST_CASE("TimingWindow - Empty window reports zero", "[ecs][fast]") {
+    const TimingWindow window;
+    const auto stats = window.GetStats();
+    REQUIRE(stats.samples == 0);
+    REQUIRE(stats.max_ms == 0.0f);
+}
+
+TEST_CASE("TimingWindow - Computes min, avg, max and p99", "[ecs][fast]") {
+    TimingWindow window(200);
+    for (int i = 1; i <= 100; ++i) {
+        window.Record(static_cast<float>(i));
+    }
+
+    const auto stats = window.GetStats();
+    REQUIRE(stats.samples == 100);
+    REQUIRE(stats.min_ms == 1.0f);
+    REQUIRE(stats.max_ms == 100.0f);
+    REQUIRE(stats.avg_ms == Catch::Approx(50.5f));
+    REQUIRE(stats.p99_ms == 99.0f);
+}
+
+TEST_CASE("TimingWindow - Only keeps the most recent samples", "[ecs][fast]") {
+    TimingWindow window(4);
+    for (const auto sample: {100.0f, 1.0f, 2.0f, 3.0f, 4.0f}) {
+        window.Record(sample);
+    }
+
+    const auto stats = window.GetStats();
+    REQUIRE(window.Size() == 4);
+    REQUIRE(stats.max_ms == 4.0f);
+    REQUIRE(stats.min_ms == 1.0f);
+    REQUIRE(stats.avg_ms == Catch::Approx(2.5f));
+}
@@ -0,0 +1,179 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "JobSystem.hpp"
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    struct TilePosition {
+        float x;
+        float y;
+    };
+
+    struct TileMesh {
+        int id;
+    };
+
+    struct TileName {
+        std::string value;
+    };
+
+    struct TileHidden {
+    };
+}
+
+TEST_CASE("World - Archetype storage adds, fetches and removes components", "[ecs][fast]") {
+    World world(ComponentStorage::Archetype);
+    const auto entity = world.CreateEntity("Tile");
+    world.AddComponent(entity, TilePosition{1.0f, 2.0f});
+    world.AddComponent(entity, TileName{"Wall"});
+    world.ApplyEngineEvents();
+
+    REQUIRE(world.GetComponent<TilePosition>(entity)->y == 2.0f);
+    REQUIRE(world.GetComponent<TileName>(entity)->value == "Wall");
+    REQUIRE(world.GetComponent<TileMesh>(entity) == nullptr);
+    REQUIRE(world.HasComponents<TilePosition, TileName>(entity));
+
+    world.Modify<TilePosition>(entity)->x = 5.0f;
+    world.RemoveComponent<TileName>(entity);
+    world.ApplyEngineEvents();
+
+    REQUIRE(world.GetComponent<TilePosition>(entity)->x == 5.0f);
+    REQUIRE(world.GetComponent<TileName>(entity) == nullptr);
+    REQUIRE_FALSE(world.HasComponents<TileName>(entity));
+
+    world.DestroyEntity(entity);
+    world.ApplyEngineEvents();
+    REQUIRE(world.GetComponent<TilePosition>(entity) == nullptr);
+}
+
+TEST_CASE("World::View - Walks the archetypes owning the components", "[ecs][fast]") {
+    World world(ComponentStorage::Archetype);
+    // Enough entities to fill several chunks of the same archetype
+    std::vector<EntityId> entities(3'000);
+    world.CreateEntities(entities.size(), entities);
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        world.AddComponent(entities[i], TilePosition{static_cast<float>(i), 0.0f});
+        if (i % 3 != 0) {
+            world.AddComponent(entities[i], TileMesh{static_cast<int>(i)});
+        }
+        if (i % 3 == 1) {
+            world.AddComponent(entities[i], TileHidden{});
+        }
+    }
+    world.ApplyEngineEvents();
+
+    auto view = world.View<TilePosition, const TileMesh>(Exclude<TileHidden>{});
+    REQUIRE(view.SizeHint() == 1'000);
+    std::size_t visited = 0;
+    for (const auto [entity, position, mesh]: view) {
+        REQUIRE(static_cast<int>(position.x) == mesh.id);
+        position.y = 1.0f;
+        ++visited;
+    }
+    REQUIRE(visited == 1'000);
+    REQUIRE(view.Matches(entities[2]));
+    REQUIRE_FALSE(view.Matches(entities[1]));
+    REQUIRE_FALSE(view.Matches(entities[0]));
+    REQUIRE(world.GetComponent<TilePosition>(entities[2])->y == 1.0f);
+    REQUIRE(world.GetComponent<TilePosition>(entities[1])->y == 0.0f);
+
+    // Archetypes created after the first view are picked up by the next one
+    world.AddComponent(entities[0], TileName{"Floor"});
+    world.AddComponent(entities[0], TileMesh{0});
+    world.ApplyEngineEvents();
+    REQUIRE(world.View<const TilePosition, const TileMesh>(Exclude<TileHidden>{}).SizeHint() == 1'001);
+    REQUIRE(world.View<TileName>().SizeHint() == 1);
+}
+
+TEST_CASE("World::View - ParallelForEach over archetype chunks visits matching entities once", "[ecs][fast]") {
+    Engine::Jobs::JobSystem job_system(2);
+    World world(ComponentStorage::Archetype);
+    std::vector<EntityId> entities(2'000);
+    world.CreateEntities(entities.size(), entities);
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        world.AddComponent(entities[i], TilePosition{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            world.AddComponent(entities[i], TileMesh{static_cast<int>(i)});
+        }
+    }
+    world.ApplyEngineEvents();
+
+    std::atomic<int> visited = 0;
+    world.View<TilePosition, const TileMesh>().ParallelForEach(job_system, [&visited](EntityId, TilePosition& position,
+                                                                                      const TileMesh& mesh) {
+        position.y = static_cast<float>(mesh.id);
+        ++visited;
+    });
+
+    REQUIRE(visited == 1'000);
+    for (const auto [entity, position]: world.View<const TilePosition>()) {
+        REQUIRE(position.y == (static_cast<int>(position.x) % 2 == 0 ? position.x : 0.0f));
+    }
+}
+
+TEST_CASE("World - Archetype storage raises the events of bulk adds, prefabs and destroyed entities",
+          "[ecs][fast]") {
+    World world(ComponentStorage::Archetype);
+    int added = 0;
+    int removed = 0;
+    world.GetComponentEventBus()->SubscribeOnComponentAddEvent<TilePosition>(
+        [&](const EntityId entity, const TilePosition& position) {
+            REQUIRE(world.GetComponent<TilePosition>(entity)->x == position.x);
+            added++;
+        });
+    world.GetComponentEventBus()->SubscribeOnComponentRemoveEvent<TilePosition>([&removed](EntityId) { removed++; });
+
+    std::vector<EntityId> entities(10);
+    world.CreateEntities(entities.size(), entities);
+    world.AddComponent(entities[0], TilePosition{});
+    const std::vector<TilePosition> positions(entities.size(), TilePosition{3.0f, 0.0f});
+    world.AddComponents<TilePosition>(entities, positions);
+    world.ApplyEngineEvents();
+    // The first entity already owned its component
+    REQUIRE(added == 10);
+    REQUIRE(world.GetComponent<TilePosition>(entities[0])->x == 0.0f);
+
+    Prefab prefab;
+    prefab.With(TilePosition{7.0f, 0.0f}).With(TileMesh{4});
+    std::vector<EntityId> instances(20);
+    world.Instantiate(prefab, instances.size(), instances);
+    world.ApplyEngineEvents();
+    REQUIRE(added == 30);
+    REQUIRE(world.View<const TilePosition, const TileMesh>().SizeHint() == 20);
+
+    world.DestroyEntity(instances[0]);
+    world.ApplyEngineEvents();
+    REQUIRE(removed == 1);
+    REQUIRE(world.View<const TilePosition, const TileMesh>().SizeHint() == 19);
+
+    world.Reset();
+    REQUIRE(world.View<const TilePosition>().SizeHint() == 0);
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, TilePosition{});
+    world.ApplyEngineEvents();
+    REQUIRE(world.View<const TilePosition>().SizeHint() == 1);
+}
+
+TEST_CASE("World - Archetype storage rejects the features that need the per-type pools", "[ecs][fast]") {
+    World world(ComponentStorage::Archetype);
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, TilePosition{});
+    world.ApplyEngineEvents();
+
+    REQUIRE_THROWS_AS(world.GetComponentView<TilePosition>(), std::logic_error);
+    REQUIRE_THROWS_AS(world.Changed<TilePosition>(0), std::logic_error);
+    REQUIRE_THROWS_AS(world.RegisterQuery<TilePosition>(), std::logic_error);
+    REQUIRE_THROWS_AS(world.Snapshot(), std::logic_error);
+    REQUIRE_THROWS_AS(world.Restore(WorldSnapshot()), std::logic_error);
+}
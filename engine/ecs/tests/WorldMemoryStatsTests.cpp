@@ -0,0 +1,139 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace MemoryStatsTests {
+    struct Position {
+        float x;
+        float y;
+    };
+
+    struct Marker {
+        int value;
+    };
+}
+
+namespace Engine::Ecs {
+    template<>
+    struct ComponentReflection<MemoryStatsTests::Position> {
+        using Type = MemoryStatsTests::Position;
+        static constexpr std::string_view name = "MemoryStatsTests::Position";
+        static constexpr uint64_t stable_id = HashName(name);
+        static constexpr std::array<ComponentField, 2> fields{{
+            {"x", "float", offsetof(Type, x), sizeof(Type::x)},
+            {"y", "float", offsetof(Type, y), sizeof(Type::y)},
+        }};
+    };
+}
+
+using MemoryStatsTests::Marker;
+using MemoryStatsTests::Position;
+
+namespace {
+    const ComponentMemoryStats* FindComponent(const WorldMemoryStats& stats, const std::string_view name) {
+        const auto it = std::ranges::find_if(stats.components, [name](const ComponentMemoryStats& component) {
+            return component.name.find(name) != std::string::npos;
+        });
+        return it == stats.components.end() ? nullptr : &*it;
+    }
+}
+
+TEST_CASE("World::GetMemoryStats - Reports every pool with its count and capacity", "[ecs][fast]") {
+    World world;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = world.CreateEntity();
+        world.AddComponent(entity, Position{1.0f, 2.0f});
+        if (i % 2 == 0) {
+            world.AddComponent(entity, Marker{i});
+        }
+    }
+    world.ApplyEngineEvents();
+
+    const auto stats = world.GetMemoryStats();
+    const auto* position = FindComponent(stats, "MemoryStatsTests::Position");
+    const auto* marker = FindComponent(stats, "Marker");
+    REQUIRE(position != nullptr);
+    REQUIRE(marker != nullptr);
+
+    // Reflected types are reported with their reflected name
+    REQUIRE(position->name == "MemoryStatsTests::Position");
+    REQUIRE(position->usage.component_count == 10);
+    REQUIRE(position->usage.component_capacity >= 10);
+    REQUIRE(position->usage.dense_bytes >= 10 * sizeof(Position));
+    REQUIRE(marker->usage.component_count == 5);
+    REQUIRE(stats.GetComponentBytes() >= position->usage.dense_bytes + marker->usage.dense_bytes);
+    REQUIRE(stats.GetTotalBytes() > stats.GetComponentBytes());
+}
+
+TEST_CASE("World::GetMemoryStats - Counts entities per state and the free list", "[ecs][fast]") {
+    World world;
+    const auto named = world.CreateEntity("Named");
+    const auto first = world.CreateEntity();
+    const auto second = world.CreateEntity();
+    world.ApplyEngineEvents();
+
+    world.DestroyEntity(first);
+    world.ApplyEngineEvents();
+    [[maybe_unused]] const auto pending = world.CreateEntity();
+
+    const auto stats = world.GetMemoryStats();
+    REQUIRE(stats.entities.alive == 2);
+    REQUIRE(stats.entities.pending == 1);
+    REQUIRE(stats.entities.named == 1);
+    REQUIRE(stats.entities.capacity >= 4);
+    REQUIRE(stats.entities.table_bytes > 0);
+    REQUIRE(stats.entities.name_bytes > 0);
+
+    world.DestroyEntity(named);
+    world.DestroyEntity(second);
+    world.ApplyEngineEvents();
+    REQUIRE(world.GetMemoryStats().entities.free_indices == 2);
+}
+
+TEST_CASE("World::GetMemoryStats - High-water marks survive applying the events", "[ecs][fast]") {
+    World world;
+    for (int i = 0; i < 100; ++i) {
+        world.AddComponent(world.CreateEntity(), Marker{i});
+    }
+
+    const auto queued = world.GetMemoryStats();
+    const auto ecs_events = std::ranges::find(queued.event_buffers, std::string("ecs_events"),
+                                              &EventBufferMemoryStats::name);
+    REQUIRE(ecs_events != queued.event_buffers.end());
+    REQUIRE(ecs_events->queued >= 200);
+    REQUIRE(queued.command_arena.used_bytes >= 100 * sizeof(Marker));
+
+    world.ApplyEngineEvents();
+    const auto applied = world.GetMemoryStats();
+    const auto applied_events = std::ranges::find(applied.event_buffers, std::string("ecs_events"),
+                                                  &EventBufferMemoryStats::name);
+    REQUIRE(applied_events->queued == 0);
+    REQUIRE(applied_events->high_water_mark >= 200);
+    REQUIRE(applied.command_arena.used_bytes == 0);
+    REQUIRE(applied.command_arena.high_water_bytes >= 100 * sizeof(Marker));
+    REQUIRE(applied.command_arena.reserved_bytes >= applied.command_arena.high_water_bytes);
+}
+
+TEST_CASE("WorldMemoryStats::ToJson - Writes every section", "[ecs][fast]") {
+    World world;
+    world.AddComponent(world.CreateEntity(), Position{0.0f, 0.0f});
+    world.ApplyEngineEvents();
+
+    const auto json = world.GetMemoryStats().ToJson();
+    REQUIRE(json.find("\"total_bytes\": ") != std::string::npos);
+    REQUIRE(json.find("\"name\": \"MemoryStatsTests::Position\", \"count\": 1") != std::string::npos);
+    REQUIRE(json.find("\"entities\": {\"capacity\": ") != std::string::npos);
+    REQUIRE(json.find("\"name\": \"physics_events\"") != std::string::npos);
+    REQUIRE(json.find("\"command_arena\": {\"blocks\": ") != std::string::npos);
+}
@@ -0,0 +1,86 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <string>
+
+#include "../include/SystemWorld.hpp"
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    struct ActiveCamera {
+        EntityId entity;
+    };
+
+    struct MazeInfo {
+        std::string name;
+        int width;
+    };
+}
+
+TEST_CASE("World::GetResource - Missing resources are null", "[ecs][fast]") {
+    const World world;
+
+    REQUIRE(world.GetResource<ActiveCamera>() == nullptr);
+    REQUIRE(world.ModifyResource<ActiveCamera>() == nullptr);
+    REQUIRE_FALSE(world.IsResourceChanged<ActiveCamera>(0));
+    REQUIRE_NOTHROW(world.RemoveResource<ActiveCamera>());
+}
+
+TEST_CASE("World::SetResource - Stores one value per type and replaces it", "[ecs][fast]") {
+    const World world;
+    world.SetResource(ActiveCamera{7});
+    world.SetResource(MazeInfo{"Labyrinth", 21});
+
+    REQUIRE(world.GetResource<ActiveCamera>()->entity == 7);
+    REQUIRE(world.GetResource<MazeInfo>()->name == "Labyrinth");
+
+    world.SetResource(ActiveCamera{9});
+    REQUIRE(world.GetResource<ActiveCamera>()->entity == 9);
+
+    world.RemoveResource<ActiveCamera>();
+    REQUIRE(world.GetResource<ActiveCamera>() == nullptr);
+    REQUIRE(world.GetResource<MazeInfo>()->width == 21);
+}
+
+TEST_CASE("World::IsResourceChanged - Reports sets, writes and removals after the tick", "[ecs][fast]") {
+    World world;
+    SystemWorld system_world(&world);
+    world.SetResource(MazeInfo{"Labyrinth", 21});
+
+    const auto last_run = world.AdvanceChangeTick();
+    REQUIRE_FALSE(system_world.IsResourceChanged<MazeInfo>(last_run));
+
+    world.AdvanceChangeTick();
+    system_world.ModifyResource<MazeInfo>()->width = 31;
+    REQUIRE(system_world.IsResourceChanged<MazeInfo>(last_run));
+    REQUIRE(system_world.GetResource<MazeInfo>()->width == 31);
+
+    const auto after_write = world.AdvanceChangeTick();
+    REQUIRE(system_world.GetResource<MazeInfo>() != nullptr);
+    REQUIRE_FALSE(system_world.IsResourceChanged<MazeInfo>(after_write));
+
+    world.AdvanceChangeTick();
+    world.RemoveResource<MazeInfo>();
+    REQUIRE(system_world.IsResourceChanged<MazeInfo>(after_write));
+}
+
+TEST_CASE("World::Reset - Drops all resources and reports them as changed", "[ecs][fast]") {
+    const World world;
+    world.SetResource(ActiveCamera{3});
+    const auto before_reset = world.AdvanceChangeTick();
+
+    world.AdvanceChangeTick();
+    world.Reset();
+
+    REQUIRE(world.GetResource<ActiveCamera>() == nullptr);
+    REQUIRE(world.IsResourceChanged<ActiveCamera>(before_reset));
+    REQUIRE_FALSE(world.IsResourceChanged<MazeInfo>(before_reset));
+
+    world.SetResource(ActiveCamera{5});
+    REQUIRE(world.GetResource<ActiveCamera>()->entity == 5);
+}
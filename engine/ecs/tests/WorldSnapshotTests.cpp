@@ -0,0 +1,275 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+
+namespace {
+    struct SnapshotPosition {
+        float x;
+        float y;
+    };
+
+    struct SnapshotHealth {
+        int value;
+    };
+
+    struct SnapshotLabel {
+        std::string text;
+    };
+
+    struct SnapshotTooltip {
+        std::string text;
+        int priority;
+    };
+}
+
+template<>
+struct Engine::Ecs::ComponentSerializer<SnapshotTooltip> {
+    static void Write(SnapshotWriter& writer, const SnapshotTooltip& tooltip) {
+        writer.WriteString(tooltip.text);
+        writer.Write(tooltip.priority);
+    }
+
+    static SnapshotTooltip Read(SnapshotReader& reader) {
+        SnapshotTooltip tooltip;
+        tooltip.text = reader.ReadString();
+        tooltip.priority = reader.Read<int>();
+        return tooltip;
+    }
+};
+
+TEST_CASE("World::Restore - Restores entities, names and components", "[ecs][fast]") {
+    World world;
+    const auto player = world.CreateEntity("Player");
+    std::vector<EntityId> tiles(100);
+    world.CreateEntities(tiles.size(), tiles);
+    world.AddComponent(player, SnapshotHealth{42});
+    world.AddComponent(player, SnapshotTooltip{"You", 3});
+    for (std::size_t i = 0; i < tiles.size(); ++i) {
+        world.AddComponent(tiles[i], SnapshotPosition{static_cast<float>(i), 1.0f});
+    }
+    world.ApplyEngineEvents();
+
+    const auto snapshot = world.Snapshot();
+    REQUIRE_FALSE(snapshot.Empty());
+
+    world.DestroyEntity(tiles[5]);
+    world.GetComponent<SnapshotHealth>(player)->value = 0;
+    const auto extra = world.CreateEntity("Extra");
+    world.AddComponent(extra, SnapshotHealth{1});
+    world.ApplyEngineEvents();
+
+    world.Restore(snapshot);
+    REQUIRE(world.GetEntityByName("Player") == player);
+    REQUIRE(world.GetEntityByName("Extra") == INVALID_ENTITY_ID);
+    REQUIRE(world.GetComponent<SnapshotHealth>(player)->value == 42);
+    REQUIRE(world.GetComponent<SnapshotTooltip>(player)->text == "You");
+    REQUIRE(world.GetComponent<SnapshotTooltip>(player)->priority == 3);
+    REQUIRE(world.GetComponentView<SnapshotHealth>().Size() == 1);
+    REQUIRE(world.GetComponentView<SnapshotPosition>().Size() == tiles.size());
+    for (std::size_t i = 0; i < tiles.size(); ++i) {
+        REQUIRE(world.GetComponent<SnapshotPosition>(tiles[i])->x == static_cast<float>(i));
+    }
+    REQUIRE(world.HasComponents<SnapshotHealth, SnapshotTooltip>(player));
+    REQUIRE_FALSE(world.HasComponents<SnapshotPosition>(player));
+}
+
+TEST_CASE("World::Restore - Raises remove events for current and add events for restored components", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity("Entity");
+    world.AddComponent(entity, SnapshotPosition{1.0f, 2.0f});
+    world.ApplyEngineEvents();
+    const auto snapshot = world.Snapshot();
+
+    const auto other = world.CreateEntity("Other");
+    world.AddComponent(other, SnapshotHealth{7});
+    world.ApplyEngineEvents();
+
+    std::vector<EntityId> added;
+    std::vector<EntityId> removed;
+    world.GetComponentEventBus()->SubscribeOnComponentAddEvent<SnapshotPosition>(
+        [&added](const EntityId added_entity, const SnapshotPosition&) { added.push_back(added_entity); });
+    world.GetComponentEventBus()->SubscribeOnComponentRemoveEvent<SnapshotHealth>(
+        [&removed](const EntityId removed_entity) { removed.push_back(removed_entity); });
+
+    world.Restore(snapshot);
+    REQUIRE(added == std::vector<EntityId>{entity});
+    REQUIRE(removed == std::vector<EntityId>{other});
+}
+
+TEST_CASE("World::Restore - Restored components count as changed", "[ecs][fast]") {
+    World world;
+    std::vector<EntityId> entities(10);
+    world.CreateEntities(entities.size(), entities);
+    world.AddComponents<SnapshotPosition>(entities, std::vector<SnapshotPosition>(entities.size(), SnapshotPosition{0.0f, 0.0f}));
+    world.ApplyEngineEvents();
+    const auto snapshot = world.Snapshot();
+
+    const auto last_run = world.GetChangeTick();
+    world.AdvanceChangeTick();
+    world.Restore(snapshot);
+    std::size_t changed = 0;
+    for (const auto [position, entity]: world.Changed<SnapshotPosition>(last_run)) {
+        changed++;
+    }
+    REQUIRE(changed == entities.size());
+}
+
+TEST_CASE("World::Restore - Discards queued structural changes", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity("Entity");
+    world.AddComponent(entity, SnapshotHealth{1});
+    world.ApplyEngineEvents();
+    const auto snapshot = world.Snapshot();
+
+    world.AddComponent(entity, SnapshotPosition{1.0f, 1.0f});
+    world.Restore(snapshot);
+    world.ApplyEngineEvents();
+    REQUIRE(world.GetComponent<SnapshotPosition>(entity) == nullptr);
+    REQUIRE(world.GetComponent<SnapshotHealth>(entity)->value == 1);
+}
+
+TEST_CASE("World::Restore - New entities do not reuse restored ids", "[ecs][fast]") {
+    World world;
+    std::vector<EntityId> entities(4);
+    world.CreateEntities(entities.size(), entities);
+    world.DestroyEntity(entities[1]);
+    world.ApplyEngineEvents();
+    const auto snapshot = world.Snapshot();
+
+    World restored;
+    restored.Restore(snapshot);
+    const auto created = restored.CreateEntity();
+    for (const auto entity: {entities[0], entities[2], entities[3]}) {
+        REQUIRE(created != entity);
+    }
+}
+
+TEST_CASE("World::Snapshot - Throws while structural changes are queued", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity("Entity");
+    world.AddComponent(entity, SnapshotHealth{1});
+    REQUIRE_THROWS_AS(world.Snapshot(), std::logic_error);
+    world.ApplyEngineEvents();
+    REQUIRE_NOTHROW(world.Snapshot());
+}
+
+TEST_CASE("World::Snapshot - Throws for components without a serializer", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity("Entity");
+    world.AddComponent(entity, SnapshotLabel{"Door"});
+    world.ApplyEngineEvents();
+    REQUIRE_THROWS_AS(world.Snapshot(), std::runtime_error);
+}
+
+TEST_CASE("World::Restore - Rejects corrupt and truncated snapshots", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity("Entity");
+    world.AddComponent(entity, SnapshotPosition{1.0f, 2.0f});
+    world.ApplyEngineEvents();
+    const auto snapshot = world.Snapshot();
+    const auto data = snapshot.GetData();
+
+    REQUIRE_THROWS_AS(world.Restore(WorldSnapshot{}), std::runtime_error);
+
+    std::vector<std::byte> wrong_magic(data.begin(), data.end());
+    wrong_magic[0] = std::byte{0};
+    REQUIRE_THROWS_AS(world.Restore(WorldSnapshot(wrong_magic)), std::runtime_error);
+
+    const std::vector<std::byte> truncated(data.begin(), data.end() - 3);
+    REQUIRE_THROWS_AS(world.Restore(WorldSnapshot(truncated)), std::runtime_error);
+}
+
+TEST_CASE("World::Restore - Leaves the world unchanged if the snapshot is corrupt", "[ecs][fast]") {
+    World world;
+    const auto player = world.CreateEntity("Player");
+    world.AddComponent(player, SnapshotHealth{42});
+    world.AddComponent(player, SnapshotTooltip{"You", 3});
+    world.ApplyEngineEvents();
+    const auto data = world.Snapshot().GetData();
+
+    const auto extra = world.CreateEntity("Extra");
+    world.AddComponent(extra, SnapshotPosition{1.0f, 2.0f});
+    world.GetComponent<SnapshotHealth>(player)->value = 7;
+    world.ApplyEngineEvents();
+    const auto query = world.RegisterQuery<const SnapshotPosition>();
+
+    int removed = 0;
+    world.GetComponentEventBus()->SubscribeOnComponentRemoveEvent<SnapshotPosition>([&removed](EntityId) { removed++; });
+
+    const std::vector<std::byte> truncated(data.begin(), data.end() - 3);
+    std::vector<std::byte> trailing(data.begin(), data.end());
+    trailing.push_back(std::byte{0});
+    for (const auto& corrupt: {truncated, trailing}) {
+        REQUIRE_THROWS_AS(world.Restore(WorldSnapshot(corrupt)), std::runtime_error);
+
+        REQUIRE(removed == 0);
+        REQUIRE(world.GetEntityByName("Extra") == extra);
+        REQUIRE(world.GetComponent<SnapshotPosition>(extra)->y == 2.0f);
+        REQUIRE(world.GetComponent<SnapshotHealth>(player)->value == 7);
+        REQUIRE(world.GetComponent<SnapshotTooltip>(player)->text == "You");
+        REQUIRE(world.HasComponents<SnapshotPosition>(extra));
+        REQUIRE(query.Size() == 1);
+    }
+}
+
+TEST_CASE("World::Restore - Event handlers can call into the world", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity("Entity");
+    world.AddComponent(entity, SnapshotPosition{1.0f, 2.0f});
+    world.ApplyEngineEvents();
+    const auto snapshot = world.Snapshot();
+
+    const auto other = world.CreateEntity("Other");
+    world.AddComponent(other, SnapshotHealth{7});
+    world.ApplyEngineEvents();
+
+    int removed_health = 0;
+    float added_x = 0.0f;
+    EntityId created = INVALID_ENTITY_ID;
+    world.GetComponentEventBus()->SubscribeOnComponentRemoveEvent<SnapshotHealth>(
+        [&world, &removed_health](const EntityId removed_entity) {
+            removed_health = world.GetComponent<SnapshotHealth>(removed_entity)->value;
+        });
+    world.GetComponentEventBus()->SubscribeOnComponentAddEvent<SnapshotPosition>(
+        [&world, &added_x, &created](const EntityId added_entity, const SnapshotPosition&) {
+            added_x = world.GetComponent<SnapshotPosition>(added_entity)->x;
+            created = world.CreateEntity();
+        });
+
+    world.Restore(snapshot);
+    REQUIRE(removed_health == 7);
+    REQUIRE(added_x == 1.0f);
+    REQUIRE(created != INVALID_ENTITY_ID);
+    REQUIRE(world.GetEntityByName("Other") == INVALID_ENTITY_ID);
+}
+
+TEST_CASE("WorldSnapshot - Round trips through a file", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity("Entity");
+    world.AddComponent(entity, SnapshotPosition{4.0f, 5.0f});
+    world.ApplyEngineEvents();
+    const auto snapshot = world.Snapshot();
+
+    const auto path = std::filesystem::temp_directory_path() / "maze_world_snapshot_test.bin";
+    snapshot.SaveToFile(path);
+    const auto loaded = WorldSnapshot::LoadFromFile(path);
+    std::filesystem::remove(path);
+    REQUIRE(loaded.Size() == snapshot.Size());
+
+    World restored;
+    restored.Restore(loaded);
+    REQUIRE(restored.GetEntityByName("Entity") == entity);
+    REQUIRE(restored.GetComponent<SnapshotPosition>(entity)->y == 5.0f);
+
+    REQUIRE_THROWS_AS(WorldSnapshot::LoadFromFile(path), std::runtime_error);
+}
@@ -0,0 +1,462 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/World.hpp"
+
+using namespace Engine::Ecs;
+using namespace Engine::Ecs::Literals;
+
+namespace {
+    struct Position {
+        float x;
+        float y;
+    };
+
+    struct Health {
+        int value;
+    };
+
+    template<int N>
+    struct FirstUseTag {
+    };
+}
+
+TEST_CASE("World::GetComponentView - Empty view for unknown component type", "[ecs][fast]") {
+    World world;
+    const auto view = world.GetComponentView<Health>();
+    REQUIRE(view.Empty());
+    REQUIRE(view.begin() == view.end());
+}
+
+TEST_CASE("World::GetComponentView - Only visits entities owning the component", "[ecs][fast]") {
+    World world;
+    std::vector<EntityId> with_health;
+    for (int i = 0; i < 100; ++i) {
+        const auto entity = world.CreateEntity("Entity" + std::to_string(i));
+        world.AddComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 10 == 0) {
+            world.AddComponent(entity, Health{i});
+            with_health.push_back(entity);
+        }
+    }
+    world.ApplyEngineEvents();
+
+    const auto view = world.GetComponentView<Health>();
+    REQUIRE(view.Size() == with_health.size());
+
+    std::vector<EntityId> visited;
+    for (const auto [health, entity]: view) {
+        REQUIRE(health == world.GetComponent<Health>(entity));
+        visited.push_back(entity);
+    }
+    REQUIRE(visited == with_health);
+}
+
+TEST_CASE("World::GetComponentView - Reflects deferred removals after applying events", "[ecs][fast]") {
+    World world;
+    const auto entity_a = world.CreateEntity("A");
+    const auto entity_b = world.CreateEntity("B");
+    world.AddComponent(entity_a, Health{1});
+    world.AddComponent(entity_b, Health{2});
+    world.ApplyEngineEvents();
+
+    world.DestroyEntity(entity_a);
+    REQUIRE(world.GetComponentView<Health>().Size() == 2);
+    world.ApplyEngineEvents();
+
+    const auto view = world.GetComponentView<Health>();
+    REQUIRE(view.Size() == 1);
+    REQUIRE(view[0].second == entity_b);
+    REQUIRE(view[0].first->value == 2);
+}
+
+TEST_CASE("World::View - Joins multiple component types", "[ecs][fast]") {
+    World world;
+    std::vector<EntityId> expected;
+    for (int i = 0; i < 50; ++i) {
+        const auto entity = world.CreateEntity("Entity" + std::to_string(i));
+        world.AddComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 5 == 0) {
+            world.AddComponent(entity, Health{i});
+            expected.push_back(entity);
+        }
+    }
+    world.ApplyEngineEvents();
+
+    auto view = world.View<Position, Health>();
+    REQUIRE(view.SizeHint() == expected.size());
+
+    std::vector<EntityId> visited;
+    for (auto [entity, position, health]: view) {
+        REQUIRE(static_cast<int>(position.x) == health.value);
+        position.y = 1.0f;
+        visited.push_back(entity);
+    }
+    REQUIRE(visited == expected);
+    REQUIRE(world.GetComponent<Position>(expected[0])->y == 1.0f);
+}
+
+TEST_CASE("World::View - ParallelForEach visits matching entities once", "[ecs][fast]") {
+    Engine::Jobs::JobSystem job_system(2);
+    World world;
+    for (int i = 0; i < 1'000; ++i) {
+        const auto entity = world.CreateEntity("Entity" + std::to_string(i));
+        world.AddComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            world.AddComponent(entity, Health{i});
+        }
+    }
+    world.ApplyEngineEvents();
+
+    std::atomic<int> visited = 0;
+    world.View<Position, const Health>().ParallelForEach(job_system, [&visited](EntityId, Position& position,
+                                                                                 const Health& health) {
+        position.y = static_cast<float>(health.value);
+        ++visited;
+    }, 16);
+
+    REQUIRE(visited == 500);
+    for (const auto [position, entity]: world.GetComponentView<Position>()) {
+        REQUIRE(position->y == (static_cast<int>(position->x) % 2 == 0 ? position->x : 0.0f));
+    }
+}
+
+TEST_CASE("World::View - Exclude filter skips entities", "[ecs][fast]") {
+    World world;
+    const auto entity_a = world.CreateEntity("A");
+    const auto entity_b = world.CreateEntity("B");
+    world.AddComponent(entity_a, Position{1.0f, 1.0f});
+    world.AddComponent(entity_b, Position{2.0f, 2.0f});
+    world.AddComponent(entity_b, Health{10});
+    world.ApplyEngineEvents();
+
+    std::vector<EntityId> visited;
+    for (const auto [entity, position]: world.View<const Position>(Exclude<Health>{})) {
+        visited.push_back(entity);
+    }
+    REQUIRE(visited == std::vector{entity_a});
+}
+
+TEST_CASE("World::View - Empty when a required pool does not exist", "[ecs][fast]") {
+    struct Unused {
+        int value;
+    };
+    World world;
+    const auto entity = world.CreateEntity("A");
+    world.AddComponent(entity, Position{1.0f, 1.0f});
+    world.ApplyEngineEvents();
+
+    auto view = world.View<Position, Unused>();
+    REQUIRE(view.begin() == view.end());
+    REQUIRE(view.SizeHint() == 0);
+}
+
+TEST_CASE("World::CreateEntities - Bulk created entities receive bulk added components", "[ecs][fast]") {
+    World world;
+    std::vector<EntityId> entities(1000);
+    world.CreateEntities(entities.size(), entities);
+    std::vector<Position> positions;
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        positions.push_back(Position{static_cast<float>(i), 0.0f});
+    }
+
+    int add_events = 0;
+    world.GetComponentEventBus()->SubscribeOnComponentAddEvent<Position>(
+        [&add_events](EntityId, const Position&) { add_events++; });
+    world.AddComponents<Position>(entities, positions);
+    REQUIRE(world.GetComponent<Position>(entities[0]) == nullptr);
+
+    world.ApplyEngineEvents();
+    REQUIRE(add_events == 1000);
+    REQUIRE(world.GetComponentView<Position>().Size() == entities.size());
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        REQUIRE(world.GetComponent<Position>(entities[i])->x == static_cast<float>(i));
+    }
+}
+
+TEST_CASE("World::AddComponents - Skips entities that do not exist", "[ecs][fast]") {
+    World world;
+    const auto alive = world.CreateEntity();
+    const auto destroyed = world.CreateEntity();
+    world.ApplyEngineEvents();
+    world.DestroyEntity(destroyed);
+    world.ApplyEngineEvents();
+
+    const std::vector entities{alive, destroyed};
+    const std::vector healths{Health{1}, Health{2}};
+    world.AddComponents<Health>(entities, healths);
+    world.ApplyEngineEvents();
+
+    REQUIRE(world.GetComponentView<Health>().Size() == 1);
+    REQUIRE(world.GetComponent<Health>(alive)->value == 1);
+    REQUIRE_THROWS_AS(world.AddComponents<Health>(entities, std::span<const Health>(healths).first(1)),
+                      std::invalid_argument);
+}
+
+TEST_CASE("World::AddComponents - Raises add events only for entities without the component", "[ecs][fast]") {
+    World world;
+    const auto owner = world.CreateEntity();
+    const auto other = world.CreateEntity();
+    world.AddComponent(owner, Health{1});
+    world.ApplyEngineEvents();
+
+    std::vector<EntityId> added;
+    world.GetComponentEventBus()->SubscribeOnComponentAddEvent<Health>(
+        [&added](const EntityId entity, const Health&) { added.push_back(entity); });
+    const std::vector entities{owner, other};
+    const std::vector healths{Health{2}, Health{3}};
+    world.AddComponents<Health>(entities, healths);
+    world.ApplyEngineEvents();
+
+    REQUIRE(added == std::vector{other});
+    REQUIRE(world.GetComponent<Health>(owner)->value == 1);
+    REQUIRE(world.GetComponent<Health>(other)->value == 3);
+}
+
+TEST_CASE("World::DestroyEntity - Anonymous entities can be destroyed", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, Health{10});
+    world.ApplyEngineEvents();
+    REQUIRE(world.GetComponent<Health>(entity) != nullptr);
+
+    world.DestroyEntity(entity);
+    world.ApplyEngineEvents();
+    REQUIRE(world.GetComponent<Health>(entity) == nullptr);
+    REQUIRE(world.GetComponentView<Health>().Empty());
+}
+
+TEST_CASE("World::Resolve - Named handles follow recreated entities", "[ecs][fast]") {
+    World world;
+    NamedEntity player("Player"_name);
+    REQUIRE(world.Resolve(player) == INVALID_ENTITY_ID);
+
+    const auto first = world.CreateEntity("Player");
+    world.ApplyEngineEvents();
+    REQUIRE(world.Resolve(player) == first);
+    REQUIRE(world.Resolve(player) == first);
+
+    world.DestroyEntity(first);
+    world.ApplyEngineEvents();
+    REQUIRE(world.Resolve(player) == INVALID_ENTITY_ID);
+
+    const auto second = world.CreateEntity("Player");
+    world.ApplyEngineEvents();
+    REQUIRE(second != first);
+    REQUIRE(world.Resolve(player) == second);
+}
+
+TEST_CASE("World::Changed - Visits components modified since the tick", "[ecs][fast]") {
+    World world;
+    std::vector<EntityId> entities(50);
+    world.CreateEntities(entities.size(), entities);
+    const std::vector<Position> positions(entities.size(), Position{0.0f, 0.0f});
+    world.AddComponents<Position>(entities, positions);
+    world.ApplyEngineEvents();
+    REQUIRE(world.Changed<Health>(0).Empty());
+
+    const auto last_run = world.GetChangeTick();
+    world.AdvanceChangeTick();
+    REQUIRE(world.Changed<Position>(last_run).Empty());
+
+    world.Modify<Position>(entities[3])->x = 3.0f;
+    world.GetComponent<Position>(entities[8])->x = 8.0f;
+    world.MarkChanged<Position>(entities[8]);
+
+    std::vector<EntityId> changed;
+    for (const auto [position, entity]: world.Changed<Position>(last_run)) {
+        changed.push_back(entity);
+    }
+    REQUIRE(changed == std::vector<EntityId>{entities[3], entities[8]});
+}
+
+TEST_CASE("World::Removed - Reports entities that lost a component", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, Health{10});
+    world.ApplyEngineEvents();
+
+    const auto last_run = world.AdvanceChangeTick();
+    world.RemoveComponent<Health>(entity);
+    world.ApplyEngineEvents();
+
+    REQUIRE(world.Removed<Health>(last_run - 1).begin() != world.Removed<Health>(last_run - 1).end());
+    REQUIRE(*world.Removed<Health>(last_run - 1).begin() == entity);
+    REQUIRE(world.Changed<Health>(0).Empty());
+
+    world.TrimChanges(world.AdvanceChangeTick());
+    REQUIRE(world.Removed<Health>(0).Empty());
+}
+
+TEST_CASE("World::HasComponents - Checks several components with one signature", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, Position{1.0f, 2.0f});
+    world.AddComponent(entity, Health{3});
+    REQUIRE_FALSE(world.HasComponents<Position>(entity));
+    world.ApplyEngineEvents();
+
+    REQUIRE(world.HasComponents<Position>(entity));
+    REQUIRE(world.HasComponents<Position, Health>(entity));
+    REQUIRE(world.HasComponents<const Position, const Health>(entity));
+
+    world.RemoveComponent<Health>(entity);
+    world.ApplyEngineEvents();
+    REQUIRE(world.HasComponents<Position>(entity));
+    REQUIRE_FALSE(world.HasComponents<Position, Health>(entity));
+    REQUIRE_FALSE(world.HasComponents<const Health>(entity));
+
+    world.DestroyEntity(entity);
+    world.ApplyEngineEvents();
+    REQUIRE_FALSE(world.HasComponents<Position>(entity));
+    REQUIRE(world.GetComponentView<Position>().Empty());
+}
+
+TEST_CASE("World::DestroyEntity - Removes the owned components and raises their remove events", "[ecs][fast]") {
+    World world;
+    std::vector<EntityId> removed;
+    world.GetComponentEventBus()->SubscribeOnComponentRemoveEvent<Health>([&removed](const EntityId entity) {
+        removed.push_back(entity);
+    });
+    std::vector<EntityId> entities(20);
+    world.CreateEntities(entities.size(), entities);
+    world.AddComponents<Position>(entities, std::vector<Position>(entities.size(), Position{0.0f, 0.0f}));
+    world.AddComponent(entities[4], Health{1});
+    world.ApplyEngineEvents();
+
+    world.ClearEntities();
+
+    REQUIRE(removed == std::vector<EntityId>{entities[4]});
+    REQUIRE(world.GetComponentView<Position>().Empty());
+    REQUIRE(world.GetComponentView<Health>().Empty());
+}
+
+TEST_CASE("World::Reset - Raises a single reset event instead of remove events", "[ecs][fast]") {
+    World world;
+    std::size_t removed = 0;
+    std::size_t resets = 0;
+    world.GetComponentEventBus()->SubscribeOnComponentRemoveEvent<Position>([&removed](EntityId) { ++removed; });
+    world.GetComponentEventBus()->SubscribeOnWorldResetEvent([&resets] { ++resets; });
+    std::vector<EntityId> entities(100);
+    world.CreateEntities(entities.size(), entities);
+    world.AddComponents<Position>(entities, std::vector<Position>(entities.size(), Position{1.0f, 2.0f}));
+    world.AddComponent(entities[7], Health{5});
+    world.ApplyEngineEvents();
+    const auto capacity = world.GetMemoryStats().entities.capacity;
+
+    world.Reset();
+
+    REQUIRE(removed == 0);
+    REQUIRE(resets == 1);
+    REQUIRE(world.GetComponentView<Position>().Empty());
+    REQUIRE(world.GetComponentView<Health>().Empty());
+    REQUIRE(world.Removed<Position>(0).Empty());
+    REQUIRE(world.Changed<Position>(0).Empty());
+    const auto stats = world.GetMemoryStats();
+    REQUIRE(stats.entities.alive == 0);
+    REQUIRE(stats.entities.free_indices == 0);
+    REQUIRE(stats.entities.capacity == capacity);
+}
+
+TEST_CASE("World::Reset - Handles from before the reset are no longer alive", "[ecs][fast]") {
+    World world;
+    const auto old_entity = world.CreateEntity("Player");
+    world.AddComponent(old_entity, Health{10});
+    const auto pending = world.CreateEntity();
+    world.ApplyEngineEvents();
+
+    world.Reset();
+    world.ApplyEngineEvents();
+    REQUIRE(world.GetEntityByName("Player") == INVALID_ENTITY_ID);
+    REQUIRE(world.GetComponent<Health>(old_entity) == nullptr);
+
+    // The freed indices are handed out again with a new generation
+    const auto new_entity = world.CreateEntity("Player");
+    world.AddComponent(new_entity, Health{20});
+    world.ApplyEngineEvents();
+    REQUIRE(new_entity != old_entity);
+    REQUIRE(new_entity != pending);
+    REQUIRE(world.GetEntityByName("Player") == new_entity);
+    REQUIRE(world.GetComponent<Health>(old_entity) == nullptr);
+    REQUIRE(world.GetComponent<Health>(new_entity)->value == 20);
+}
+
+TEST_CASE("World::Reset - Drops queued events and keeps the subscriptions", "[ecs][fast]") {
+    World world;
+    std::vector<EntityId> added;
+    world.GetComponentEventBus()->SubscribeOnComponentAddEvent<Health>(
+            [&added](const EntityId entity, const Health&) { added.push_back(entity); });
+    const auto queued = world.CreateEntity();
+    world.AddComponent(queued, Health{1});
+
+    world.Reset();
+    world.ApplyEngineEvents();
+    REQUIRE(added.empty());
+    REQUIRE(world.GetComponentView<Health>().Empty());
+
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, Health{2});
+    world.ApplyEngineEvents();
+    REQUIRE(added == std::vector<EntityId>{entity});
+
+    world.ClearSubscriptions();
+    world.AddComponent(world.CreateEntity(), Health{3});
+    world.ApplyEngineEvents();
+    REQUIRE(added.size() == 1);
+}
+
+TEST_CASE("World::CreateEntity - Lookups stay valid while another thread reserves entities", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, Health{42});
+    world.ApplyEngineEvents();
+
+    // Reserving grows the entity table several times, while the lookups read it
+    std::thread creator([&world] {
+        for (int i = 0; i < 20'000; ++i) {
+            static_cast<void>(world.CreateEntity());
+        }
+    });
+    int found = 0;
+    for (int i = 0; i < 20'000; ++i) {
+        if (world.GetComponent<Health>(entity)->value == 42 && world.HasComponents<Health>(entity)) {
+            found++;
+        }
+    }
+    creator.join();
+
+    REQUIRE(found == 20'000);
+}
+
+TEST_CASE("World::AddComponent - Views stay valid while another thread adds new component types", "[ecs][fast]") {
+    World world;
+    const auto entity = world.CreateEntity();
+    world.AddComponent(entity, Health{42});
+    world.ApplyEngineEvents();
+
+    // Every first use of a tag type creates a pool and may grow the pool table
+    std::thread adder([&world, entity] {
+        [&]<int... N>(std::integer_sequence<int, N...>) {
+            (world.AddComponent(entity, FirstUseTag<N>{}), ...);
+        }(std::make_integer_sequence<int, 64>{});
+    });
+    int found = 0;
+    for (int i = 0; i < 5'000; ++i) {
+        for (const auto [viewed, health]: world.View<const Health>()) {
+            found += health.value == 42 ? 1 : 0;
+        }
+    }
+    adder.join();
+    world.ApplyEngineEvents();
+
+    REQUIRE(found == 5'000);
+    REQUIRE(world.HasComponents<Health, FirstUseTag<0>, FirstUseTag<63> >(entity));
+}
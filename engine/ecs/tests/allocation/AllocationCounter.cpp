@@ -0,0 +1,103 @@
+#include "AllocationCounter.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+// Defined in their own translation unit, so the compiler never sees an inlined std::free next to a call of the
+// replaced operator new.
+namespace {
+    thread_local bool t_count_allocations = false;
+    thread_local std::size_t t_allocations = 0;
+}
+
+namespace AllocationTests {
+    AllocationCounter::AllocationCounter() {
+        t_allocations = 0;
+        t_count_allocations = true;
+    }
+
+    AllocationCounter::~AllocationCounter() {
+        t_count_allocations = false;
+    }
+
+    std::size_t AllocationCounter::Count() const {
+        return t_allocations;
+    }
+} // namespace
+
+void* operator new(const std::size_t size) {
+    if (t_count_allocations) {
+        t_allocations++;
+    }
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+// The over-aligned overloads are used by the CacheLineAllocator of the pools.
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+    if (t_count_allocations) {
+        t_allocations++;
+    }
+    const auto align = static_cast<std::size_t>(alignment);
+    // aligned_alloc requires the size to be a multiple of the alignment
+    const auto aligned_size = (std::max<std::size_t>(size, 1) + align - 1) / align * align;
+#ifdef _WIN32
+    void* memory = _aligned_malloc(aligned_size, align);
+#else
+    void* memory = std::aligned_alloc(align, aligned_size);
+#endif
+    if (memory != nullptr) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+void* operator new[](const std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+void operator delete(void* memory, std::size_t, const std::align_val_t alignment) noexcept {
+    ::operator delete(memory, alignment);
+}
+
+void operator delete[](void* memory, const std::align_val_t alignment) noexcept {
+    ::operator delete(memory, alignment);
+}
+
+void operator delete[](void* memory, std::size_t, const std::align_val_t alignment) noexcept {
+    ::operator delete(memory, alignment);
+}
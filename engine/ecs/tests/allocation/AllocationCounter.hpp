@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+
+namespace AllocationTests {
+    /**
+     * Counts the heap allocations of the current thread while it is alive. The counting operator new lives in
+     * AllocationCounter.cpp and replaces the global one for the whole executable, so the allocation tests are built
+     * into their own executable and counting stays off outside of the measured sections.
+     */
+    class AllocationCounter {
+    public:
+        AllocationCounter();
+
+        ~AllocationCounter();
+
+        [[nodiscard]] std::size_t Count() const;
+    };
+} // namespace
@@ -0,0 +1,131 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "../../include/World.hpp"
+#include "../../src/ParallelIteration.hpp"
+
+using namespace Engine::Ecs;
+using AllocationTests::AllocationCounter;
+
+namespace {
+    // Mirrors the component set of a maze wall tile (Transform, MeshRenderer, BoxCollider)
+    struct TileTransform {
+        float position[3];
+        float rotation[3];
+        float scale[3];
+        uint64_t version;
+    };
+
+    struct TileMeshRenderer {
+        uint64_t mesh;
+        uint64_t material;
+    };
+
+    struct TileCollider {
+        float width;
+        float height;
+        float depth;
+        bool is_static;
+        bool is_trigger;
+    };
+
+    struct TrackedName {
+        static inline int alive = 0;
+        std::string name;
+
+        explicit TrackedName(std::string value) : name(std::move(value)) { alive++; }
+
+        TrackedName(const TrackedName& other) : name(other.name) { alive++; }
+
+        TrackedName(TrackedName&& other) noexcept : name(std::move(other.name)) { alive++; }
+
+        TrackedName& operator=(const TrackedName&) = default;
+
+        TrackedName& operator=(TrackedName&&) noexcept = default;
+
+        ~TrackedName() { alive--; }
+    };
+
+    void AddTileComponents(World& world, const std::vector<EntityId>& tiles) {
+        for (const auto entity: tiles) {
+            world.AddComponent(entity, TileTransform{{1.0f, 0.0f, 1.0f}, {}, {1.0f, 1.0f, 1.0f}, 0});
+            world.AddComponent(entity, TileMeshRenderer{1, 2});
+            world.AddComponent(entity, TileCollider{2.0f, 2.0f, 0.1f, true, false});
+        }
+    }
+
+    void RemoveTileComponents(World& world, const std::vector<EntityId>& tiles) {
+        for (const auto entity: tiles) {
+            world.RemoveComponent<TileTransform>(entity);
+            world.RemoveComponent<TileMeshRenderer>(entity);
+            world.RemoveComponent<TileCollider>(entity);
+        }
+    }
+}
+
+TEST_CASE("World::AddComponent - Queued components do not allocate once the arena is warm", "[ecs][fast]") {
+    // A 50x50 maze creates about five tile entities per cell.
+    World world;
+    std::vector<EntityId> tiles;
+    for (int i = 0; i < 50 * 50 * 5; ++i) {
+        tiles.push_back(world.CreateEntity("Tile" + std::to_string(i)));
+    }
+    AddTileComponents(world, tiles);
+    world.ApplyEngineEvents();
+    RemoveTileComponents(world, tiles);
+    world.ApplyEngineEvents();
+
+    std::size_t allocations;
+    {
+        const AllocationCounter counter;
+        AddTileComponents(world, tiles);
+        world.ApplyEngineEvents();
+        allocations = counter.Count();
+    }
+
+    REQUIRE(allocations == 0);
+    REQUIRE(world.GetComponentView<TileTransform>().Size() == tiles.size());
+    REQUIRE(world.GetComponent<TileCollider>(tiles.back())->depth == 0.1f);
+}
+
+TEST_CASE("World::ApplyEngineEvents - Non trivial components are moved and destroyed", "[ecs][fast]") {
+    {
+        World world;
+        const auto entity_a = world.CreateEntity("A");
+        const auto entity_b = world.CreateEntity("B");
+        world.AddComponent(entity_a, TrackedName("Alpha"));
+        world.AddComponent(entity_b, TrackedName("Beta"));
+        world.ApplyEngineEvents();
+
+        // Only the components inside the pool are left, the queued payloads were destroyed on apply
+        REQUIRE(TrackedName::alive == 2);
+        REQUIRE(world.GetComponent<TrackedName>(entity_a)->name == "Alpha");
+        REQUIRE(world.GetComponent<TrackedName>(entity_b)->name == "Beta");
+
+        // Payloads which are never applied are destroyed together with the world
+        const auto entity_c = world.CreateEntity("C");
+        world.AddComponent(entity_c, TrackedName("Gamma"));
+        REQUIRE(TrackedName::alive == 3);
+    }
+    REQUIRE(TrackedName::alive == 0);
+}
+
+TEST_CASE("AllocationCounter - Counts cache line aligned allocations", "[ecs][fast]") {
+    std::size_t allocations;
+    {
+        const AllocationCounter counter;
+        std::vector<TileTransform, CacheLineAllocator<TileTransform> > transforms(100);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(transforms.data()) % CACHE_LINE_SIZE == 0);
+        allocations = counter.Count();
+    }
+
+    REQUIRE(allocations == 1);
+}
@@ -95,6 +95,17 @@ namespace Engine::Environment {
          */
         virtual void SwapBuffers() = 0;
 
+        /**
+         * Bind the render context of this window to the calling thread. A context can only be current on one
+         * thread at a time, so release it on the previous thread first.
+         */
+        virtual void MakeContextCurrent() = 0;
+
+        /**
+         * Unbind the render context of this window from the calling thread.
+         */
+        virtual void ReleaseContext() = 0;
+
         /**
          * Destroy the window and all its content. Note: Destroy all dependencies
          * in this window first to avoid errors.
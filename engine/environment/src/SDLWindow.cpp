@@ -75,6 +75,27 @@ namespace Engine::Environment
         SDL_GL_SwapWindow(m_window);
     }
 
+    void SDLWindow::MakeContextCurrent()
+    {
+        if (m_context.openGLContext.context == nullptr)
+        {
+            return;
+        }
+        if (SDL_GL_MakeCurrent(m_window, m_context.openGLContext.context) != 0)
+        {
+            throw std::runtime_error(SDL_GetError());
+        }
+    }
+
+    void SDLWindow::ReleaseContext()
+    {
+        if (m_context.openGLContext.context == nullptr)
+        {
+            return;
+        }
+        SDL_GL_MakeCurrent(m_window, nullptr);
+    }
+
     void SDLWindow::Shutdown()
     {
         SDL_DestroyWindow(m_window);
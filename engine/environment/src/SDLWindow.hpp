@@ -19,6 +19,11 @@ namespace Engine::Environment {
         WindowContext &GetWindowContext() override;
 
         void SwapBuffers() override;
+
+        void MakeContextCurrent() override;
+
+        void ReleaseContext() override;
+
         void Shutdown() override;
 
         void PollEvents(const std::function<void(const SDL_Event &)> &callback);
@@ -0,0 +1,198 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Engine::Ecs {
+    using CommandTypeId = std::size_t;
+    using CommandSubscriptionId = std::size_t;
+
+    class ICommandChannel {
+    public:
+        virtual ~ICommandChannel() = default;
+
+        virtual void Dispatch() = 0;
+
+        virtual void Unsubscribe(CommandSubscriptionId subscription) = 0;
+
+        virtual void ClearPending() = 0;
+
+        [[nodiscard]] virtual std::size_t GetPendingCount() const = 0;
+    };
+
+    /**
+     * @class CommandChannel
+     * @brief Queue and subscribers of a single command type.
+     *
+     * Commands are collected in a pending buffer and handed to the subscribers in the order they were sent. The
+     * buffers are swapped on dispatch and keep their capacity, so after the first frames sending and dispatching
+     * commands does not allocate. Commands sent while the channel dispatches are delivered on the next dispatch.
+     * @tparam T The command type
+     */
+    template<class T>
+    class CommandChannel final : public ICommandChannel {
+    public:
+        using Handler = std::function<void(const T&)>;
+
+        /**
+         * Queue a command. Safe to call from several systems running in parallel.
+         * @param command The command to queue
+         */
+        void Push(T command) {
+            std::lock_guard lock(m_mutex);
+            m_pending.push_back(std::move(command));
+        }
+
+        void Subscribe(const CommandSubscriptionId subscription, Handler handler) {
+            m_handlers.emplace_back(subscription, std::move(handler));
+        }
+
+        void Unsubscribe(const CommandSubscriptionId subscription) override {
+            // Only clear the handler, a dispatch might currently walk the handler list. Empty slots are compacted
+            // after the next dispatch.
+            for (auto& [id, handler]: m_handlers) {
+                if (id == subscription) {
+                    handler = nullptr;
+                }
+            }
+        }
+
+        void Dispatch() override {
+            {
+                std::lock_guard lock(m_mutex);
+                m_dispatching.swap(m_pending);
+            }
+            for (const auto& command: m_dispatching) {
+                for (std::size_t i = 0; i < m_handlers.size(); ++i) {
+                    if (m_handlers[i].second) {
+                        m_handlers[i].second(command);
+                    }
+                }
+            }
+            m_dispatching.clear();
+            std::erase_if(m_handlers, [](const auto& entry) { return entry.second == nullptr; });
+        }
+
+        void ClearPending() override {
+            std::lock_guard lock(m_mutex);
+            m_pending.clear();
+        }
+
+        [[nodiscard]] std::size_t GetPendingCount() const override {
+            std::lock_guard lock(m_mutex);
+            return m_pending.size();
+        }
+
+    private:
+        std::vector<T> m_pending;
+        std::vector<T> m_dispatching;
+        std::vector<std::pair<CommandSubscriptionId, Handler> > m_handlers;
+        mutable std::mutex m_mutex;
+    };
+
+    /**
+     * @class CommandBus
+     * @brief Routes commands sent by systems to their subscribers, with one channel per command type.
+     *
+     * Channels are looked up by a per type id, so routing a command only touches the subscribers of its type.
+     * A channel is created by the first subscription of its type. Commands nobody subscribed to are dropped when
+     * they are sent. Subscribing and unsubscribing must happen outside of the system updates, sending is safe from
+     * any system, including systems running in parallel.
+     */
+    class CommandBus {
+    public:
+        /**
+         * Subscribe to all commands of a type.
+         * @tparam T The command type
+         * @param handler Called once per dispatched command
+         * @return The id to unsubscribe with
+         */
+        template<class T>
+        CommandSubscriptionId Subscribe(std::function<void(const T&)> handler) {
+            const auto type_id = TypeId<T>();
+            if (type_id >= m_channels.size()) {
+                m_channels.resize(type_id + 1);
+            }
+            if (!m_channels[type_id]) {
+                m_channels[type_id] = std::make_unique<CommandChannel<T> >();
+                m_dispatch_order.push_back(type_id);
+            }
+
+            const auto subscription = m_next_subscription++;
+            static_cast<CommandChannel<T>*>(m_channels[type_id].get())->Subscribe(subscription, std::move(handler));
+            return subscription;
+        }
+
+        void Unsubscribe(const CommandSubscriptionId subscription) const {
+            for (const auto& channel: m_channels) {
+                if (channel) {
+                    channel->Unsubscribe(subscription);
+                }
+            }
+        }
+
+        /**
+         * Queue a command for the next dispatch.
+         * @tparam T The command type
+         * @param command The command to send
+         */
+        template<class T>
+        void Send(T command) const {
+            const auto type_id = TypeId<T>();
+            if (type_id >= m_channels.size() || !m_channels[type_id]) {
+                return;
+            }
+            static_cast<CommandChannel<T>*>(m_channels[type_id].get())->Push(std::move(command));
+        }
+
+        /**
+         * Hand all queued commands to their subscribers. Channels are dispatched in the order they were created.
+         */
+        void Dispatch() const {
+            for (const auto type_id: m_dispatch_order) {
+                m_channels[type_id]->Dispatch();
+            }
+        }
+
+        /**
+         * Drop all queued commands without dispatching them. The subscriptions are kept.
+         */
+        void ClearPending() const {
+            for (const auto type_id: m_dispatch_order) {
+                m_channels[type_id]->ClearPending();
+            }
+        }
+
+        /**
+         * @return The number of queued commands of a type, 0 if nobody subscribed to it
+         */
+        template<class T>
+        [[nodiscard]] std::size_t GetPendingCount() const {
+            const auto type_id = TypeId<T>();
+            if (type_id >= m_channels.size() || !m_channels[type_id]) {
+                return 0;
+            }
+            return m_channels[type_id]->GetPendingCount();
+        }
+
+        template<class T>
+        static CommandTypeId TypeId() {
+            static const CommandTypeId id = NextTypeId();
+            return id;
+        }
+
+    private:
+        static CommandTypeId NextTypeId() {
+            static std::atomic<CommandTypeId> next{0};
+            return next++;
+        }
+
+        std::vector<std::unique_ptr<ICommandChannel> > m_channels;
+        std::vector<CommandTypeId> m_dispatch_order;
+        CommandSubscriptionId m_next_subscription = 0;
+    };
+}
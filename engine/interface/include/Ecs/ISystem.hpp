@@ -3,8 +3,8 @@
 //
 
 #pragma once
-#include <any>
-#include <functional>
+#include <utility>
+#include "CommandBus.hpp"
 #include "Types.hpp"
 
 namespace Engine::Input {
@@ -12,18 +12,31 @@ namespace Engine::Input {
 }
 
 namespace Engine::Ecs {
-#define ECS_SYSTEM(name, phase, tags, dependencies)
+    /**
+     * Marks a system for the system codegen. The macro itself expands to nothing.
+     * Besides name, phase, TAGS(...) and DEPENDENCIES(...) a system can optionally declare READS(...) and WRITES(...)
+     * with the component (or cache) type names its Run() touches. Systems declaring their access may run in parallel
+     * with other non-conflicting systems of the same phase, systems without a declaration always run alone on the
+     * main thread.
+     */
+#define ECS_SYSTEM(name, phase, tags, dependencies, ...)
 
     class SystemWorld;
     struct EngineBindToken;
 
     class ISystem {
     public:
-        using CommandEvent = std::function<void(const std::any& command)>;
-
         virtual ~ISystem() = default;
 
-        void Bind(EngineBindToken, Input::IInput& input, SystemWorld& world, CommandEvent command_event);
+        void Bind(EngineBindToken, Input::IInput& input, SystemWorld& world, CommandBus& command_bus);
+
+        /**
+         * Set by the system manager after every run, so the next run can ask for the changes since then.
+         * @param tick The change tick of the stage the system ran in
+         */
+        void SetLastRunTick(EngineBindToken, ChangeTick tick);
+
+        [[nodiscard]] ChangeTick GetLastRunTick() const { return m_last_run_tick; }
 
         virtual void Initialize() {
         }
@@ -46,13 +59,26 @@ namespace Engine::Ecs {
         [[nodiscard]] SystemWorld* GameWorld() const { return m_world; }
         [[nodiscard]] Input::IInput* Input() const { return m_input; }
 
-        void SendCommand(const std::any& command) const {
-            m_command_event(command);
+        /**
+         * The change tick of the previous run, 0 before the first run. Pass it to the Changed/Added/Removed views of
+         * the world to only visit the components touched since the system last ran.
+         */
+        [[nodiscard]] ChangeTick LastRunTick() const { return m_last_run_tick; }
+
+        /**
+         * Send a command to everyone subscribed to its type. The command is delivered during the command phase.
+         * @tparam T The command type
+         * @param command The command to send
+         */
+        template<class T>
+        void SendCommand(T command) const {
+            m_command_bus->Send(std::move(command));
         }
 
     private:
         Input::IInput* m_input = nullptr;
         SystemWorld* m_world = nullptr;
-        CommandEvent m_command_event{};
+        CommandBus* m_command_bus = nullptr;
+        ChangeTick m_last_run_tick = 0;
     };
 }
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Engine::Ecs {
+    /**
+     * Stable id of an entity name. It is the 64 bit FNV-1a hash of the name, so the same name yields the same id in
+     * every run and the id of a constant name can be computed at compile time.
+     */
+    using NameId = uint64_t;
+
+    inline constexpr NameId INVALID_NAME_ID = 0;
+
+    constexpr NameId HashName(const std::string_view name) {
+        NameId hash = 0xcbf29ce484222325ull;
+        for (const char character: name) {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    namespace Literals {
+        /**
+         * Compile time name id, e.g. "Player"_name.
+         */
+        consteval NameId operator""_name(const char* name, const std::size_t length) {
+            return HashName(std::string_view(name, length));
+        }
+    }
+}
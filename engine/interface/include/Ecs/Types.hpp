@@ -7,4 +7,9 @@
 
 namespace Engine::Ecs {
     using EntityId = uint64_t;
+
+    /**
+     * Monotonic counter of the world, advanced before every system stage. Changes to components are stamped with it.
+     */
+    using ChangeTick = uint32_t;
 }
@@ -0,0 +1,59 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../include/JobSystem.hpp"
+
+using namespace Engine::Jobs;
+
+namespace {
+    // Small amount of arithmetic per job, so the benchmark measures the scheduling overhead rather than the work.
+    float Work(const std::size_t index) {
+        float value = static_cast<float>(index);
+        for (int i = 0; i < 32; ++i) {
+            value = std::sqrt(value * value + 1.0f);
+        }
+        return value;
+    }
+}
+
+TEST_CASE("JobSystem - job throughput", "[benchmark][jobs]") {
+    const std::size_t job_count = GENERATE(1'000, 10'000, 100'000);
+    JobSystem job_system;
+    std::vector<float> results(job_count);
+
+    BENCHMARK("Serial loop - " + std::to_string(job_count) + " items") {
+        for (std::size_t i = 0; i < job_count; ++i) {
+            results[i] = Work(i);
+        }
+        return results.back();
+    };
+
+    BENCHMARK("Schedule + Wait - " + std::to_string(job_count) + " jobs, " +
+              std::to_string(job_system.GetThreadCount()) + " threads") {
+        JobCounter counter;
+        for (std::size_t i = 0; i < job_count; ++i) {
+            job_system.Schedule([&results, i] { results[i] = Work(i); }, &counter);
+        }
+        job_system.Wait(counter);
+        return results.back();
+    };
+
+    BENCHMARK("ParallelFor - " + std::to_string(job_count) + " items, " +
+              std::to_string(job_system.GetThreadCount()) + " threads") {
+        job_system.ParallelFor(job_count, 256, [&results](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                results[i] = Work(i);
+            }
+        });
+        return results.back();
+    };
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+namespace Engine::Jobs {
+    /**
+     * @class JobCounter
+     * @brief Tracks the number of unfinished jobs of a group.
+     *
+     * Every job scheduled with a counter increments it and decrements it once the job finished. A counter can have a
+     * parent counter. While the child has pending jobs, it keeps its parent pending as well, so waiting on the parent
+     * also waits for all jobs of its children. Exceptions thrown by jobs are stored in the counter and its parents and
+     * rethrown by JobSystem::Wait.
+     */
+    class JobCounter {
+    public:
+        JobCounter() = default;
+
+        explicit JobCounter(JobCounter* parent) : m_parent(parent) {
+        }
+
+        JobCounter(const JobCounter&) = delete;
+
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        [[nodiscard]] bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+        [[nodiscard]] uint32_t GetPending() const { return m_pending.load(std::memory_order_acquire); }
+
+    private:
+        friend class JobSystem;
+
+        void Increment() {
+            if (m_pending.fetch_add(1, std::memory_order_acq_rel) == 0 && m_parent != nullptr) {
+                m_parent->Increment();
+            }
+        }
+
+        /**
+         * @return True if this was the last pending job, i.e. a waiting thread has to be woken up
+         */
+        bool Decrement() {
+            // Once the count hits zero a waiting thread may destroy the counter, so nothing of it is touched afterward.
+            JobCounter* parent = m_parent;
+            if (m_pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return false;
+            }
+            if (parent != nullptr) {
+                parent->Decrement();
+            }
+            return true;
+        }
+
+        void StoreException(std::exception_ptr exception) {
+            std::lock_guard lock(m_exception_mutex);
+            if (!m_exception) {
+                m_exception = exception;
+            }
+            if (m_parent != nullptr) {
+                m_parent->StoreException(std::move(exception));
+            }
+        }
+
+        std::exception_ptr TakeException() {
+            std::lock_guard lock(m_exception_mutex);
+            return std::exchange(m_exception, nullptr);
+        }
+
+        JobCounter* m_parent = nullptr;
+        std::atomic<uint32_t> m_pending{0};
+        std::mutex m_exception_mutex;
+        std::exception_ptr m_exception;
+    };
+} // namespace
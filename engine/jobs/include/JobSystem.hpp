@@ -0,0 +1,144 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "JobCounter.hpp"
+
+namespace Engine::Jobs {
+    using JobFunction = std::function<void()>;
+
+    /**
+     * @class JobSystem
+     * @brief Engine wide pool of worker threads executing small jobs.
+     *
+     * Every worker owns a deque. Jobs scheduled from a worker are pushed to its own deque and popped in LIFO order,
+     * idle workers steal the oldest jobs from the deques of the others. The thread creating the job system is the main
+     * thread. It owns a deque as well, so waiting on the main thread executes jobs instead of blocking.
+     * Jobs with main thread affinity, e.g. everything calling into OpenGL, are kept in a separate queue and only run
+     * on the main thread, either in ExecuteMainThreadJobs() or while the main thread waits on a counter.
+     * Destroying the job system executes all jobs that are still queued before the workers are stopped.
+     */
+    class JobSystem {
+    public:
+        /**
+         * @param worker_count The number of worker threads spawned next to the main thread
+         */
+        explicit JobSystem(std::size_t worker_count = GetDefaultWorkerCount());
+
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * Schedule a job on any thread.
+         * @param job The job to execute
+         * @param counter Optional counter tracking the job. Without a counter, an exception thrown by the job
+         *                terminates the application.
+         */
+        void Schedule(JobFunction job, JobCounter* counter = nullptr);
+
+        /**
+         * Schedule a job that is only executed on the main thread.
+         * @param job The job to execute
+         * @param counter Optional counter tracking the job
+         */
+        void ScheduleOnMainThread(JobFunction job, JobCounter* counter = nullptr);
+
+        /**
+         * Block until all jobs of the counter finished. The waiting thread executes pending jobs in the meantime, so it
+         * is safe to wait from inside a job. Once there is nothing left to execute, it sleeps until a job is scheduled
+         * or the counter is done. Rethrows the first exception thrown by one of the jobs.
+         * @param counter The counter to wait for
+         */
+        void Wait(JobCounter& counter);
+
+        /**
+         * Call fn(begin, end) for consecutive ranges covering [0, count) and block until all ranges are processed.
+         * @param count The number of indices
+         * @param grain_size The maximum number of indices per range
+         * @param fn The function to call per range
+         */
+        template<typename Fn>
+        void ParallelFor(std::size_t count, std::size_t grain_size, Fn&& fn);
+
+        /**
+         * Execute all jobs that were scheduled for the main thread so far. Must be called from the main thread.
+         */
+        void ExecuteMainThreadJobs();
+
+        [[nodiscard]] bool IsMainThread() const;
+
+        [[nodiscard]] std::size_t GetWorkerCount() const { return m_workers.size(); }
+
+        /**
+         * @return The number of threads executing jobs, including the main thread
+         */
+        [[nodiscard]] std::size_t GetThreadCount() const { return m_workers.size() + 1; }
+
+        /**
+         * @return One worker per hardware thread, minus the main thread
+         */
+        static std::size_t GetDefaultWorkerCount();
+
+    private:
+        struct Job {
+            JobFunction function;
+            JobCounter* counter = nullptr;
+        };
+
+        struct WorkQueue {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        void WorkerLoop(std::size_t queue_index);
+
+        void Push(std::size_t queue_index, Job job);
+
+        bool TryPop(std::size_t queue_index, Job& job);
+
+        bool TrySteal(std::size_t thief_index, Job& job);
+
+        bool TryExecuteJob();
+
+        bool TryExecuteMainThreadJob();
+
+        void Execute(Job& job);
+
+        void WakeWaiters();
+
+        [[nodiscard]] std::size_t GetCurrentQueueIndex() const;
+
+        static constexpr std::size_t MAIN_QUEUE_INDEX = 0;
+
+        std::thread::id m_main_thread_id;
+        std::vector<std::unique_ptr<WorkQueue> > m_queues;
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_main_thread_mutex;
+        std::deque<Job> m_main_thread_jobs;
+
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake_up;
+        /**
+         * Wakes threads blocked in Wait(). Kept apart from m_wake_up, so finishing a counter does not wake idle workers.
+         */
+        std::condition_variable m_wake_waiters;
+        std::size_t m_waiting = 0;
+        std::atomic<std::size_t> m_queued_jobs{0};
+        std::atomic<std::size_t> m_queued_main_thread_jobs{0};
+        mutable std::atomic<std::size_t> m_next_queue{0};
+        bool m_stopping = false;
+    };
+} // namespace
+
+#include "../src/JobSystem.inl"
@@ -0,0 +1,226 @@
+#include "JobSystem.hpp"
+
+namespace Engine::Jobs {
+    namespace {
+        // Identifies the job system and queue a worker thread belongs to.
+        thread_local const JobSystem* t_owner = nullptr;
+        thread_local std::size_t t_queue_index = 0;
+    }
+
+    JobSystem::JobSystem(const std::size_t worker_count) : m_main_thread_id(std::this_thread::get_id()) {
+        m_queues.reserve(worker_count + 1);
+        for (std::size_t i = 0; i < worker_count + 1; ++i) {
+            m_queues.push_back(std::make_unique<WorkQueue>());
+        }
+
+        m_workers.reserve(worker_count);
+        for (std::size_t i = 0; i < worker_count; ++i) {
+            m_workers.emplace_back([this, queue_index = i + 1] { WorkerLoop(queue_index); });
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        // Workers only stop once the queues are empty, since a queued job may be tracked by a counter somebody waits on
+        {
+            std::lock_guard lock(m_sleep_mutex);
+            m_stopping = true;
+        }
+        m_wake_up.notify_all();
+        for (auto& worker: m_workers) {
+            worker.join();
+        }
+        // Without workers the queued jobs are left to the destroying thread
+        while (TryExecuteJob() || (IsMainThread() && TryExecuteMainThreadJob())) {
+        }
+    }
+
+    void JobSystem::Schedule(JobFunction job, JobCounter* counter) {
+        if (counter != nullptr) {
+            counter->Increment();
+        }
+        Push(GetCurrentQueueIndex(), Job{std::move(job), counter});
+    }
+
+    void JobSystem::ScheduleOnMainThread(JobFunction job, JobCounter* counter) {
+        if (counter != nullptr) {
+            counter->Increment();
+        }
+        {
+            std::lock_guard lock(m_main_thread_mutex);
+            m_main_thread_jobs.push_back(Job{std::move(job), counter});
+            m_queued_main_thread_jobs++;
+        }
+        WakeWaiters();
+    }
+
+    void JobSystem::Wait(JobCounter& counter) {
+        const bool is_main_thread = IsMainThread();
+        while (!counter.IsDone()) {
+            if (is_main_thread && TryExecuteMainThreadJob()) {
+                continue;
+            }
+            if (TryExecuteJob()) {
+                continue;
+            }
+
+            std::unique_lock lock(m_sleep_mutex);
+            m_waiting++;
+            m_wake_waiters.wait(lock, [&] {
+                return counter.IsDone() || m_queued_jobs.load() > 0 ||
+                       (is_main_thread && m_queued_main_thread_jobs.load() > 0);
+            });
+            m_waiting--;
+        }
+
+        if (const auto exception = counter.TakeException()) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void JobSystem::ExecuteMainThreadJobs() {
+        std::deque<Job> jobs;
+        {
+            std::lock_guard lock(m_main_thread_mutex);
+            jobs.swap(m_main_thread_jobs);
+            m_queued_main_thread_jobs -= jobs.size();
+        }
+        for (auto& job: jobs) {
+            Execute(job);
+        }
+    }
+
+    bool JobSystem::IsMainThread() const {
+        return std::this_thread::get_id() == m_main_thread_id;
+    }
+
+    std::size_t JobSystem::GetDefaultWorkerCount() {
+        const auto hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+        return hardware_threads - 1;
+    }
+
+    void JobSystem::WorkerLoop(const std::size_t queue_index) {
+        t_owner = this;
+        t_queue_index = queue_index;
+
+        while (true) {
+            if (TryExecuteJob()) {
+                continue;
+            }
+
+            std::unique_lock lock(m_sleep_mutex);
+            m_wake_up.wait(lock, [this] { return m_stopping || m_queued_jobs.load() > 0; });
+            if (m_stopping && m_queued_jobs.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    void JobSystem::Push(const std::size_t queue_index, Job job) {
+        {
+            auto& queue = *m_queues[queue_index];
+            std::lock_guard lock(queue.mutex);
+            queue.jobs.push_back(std::move(job));
+            m_queued_jobs++;
+        }
+        // Taking the sleep mutex makes sure a worker is either already waiting or still going to see the new job.
+        bool has_waiters;
+        {
+            std::lock_guard lock(m_sleep_mutex);
+            has_waiters = m_waiting > 0;
+        }
+        m_wake_up.notify_one();
+        if (has_waiters) {
+            m_wake_waiters.notify_all();
+        }
+    }
+
+    bool JobSystem::TryPop(const std::size_t queue_index, Job& job) {
+        auto& queue = *m_queues[queue_index];
+        std::lock_guard lock(queue.mutex);
+        if (queue.jobs.empty()) {
+            return false;
+        }
+        job = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        m_queued_jobs--;
+        return true;
+    }
+
+    bool JobSystem::TrySteal(const std::size_t thief_index, Job& job) {
+        for (std::size_t offset = 1; offset < m_queues.size(); ++offset) {
+            auto& queue = *m_queues[(thief_index + offset) % m_queues.size()];
+            std::lock_guard lock(queue.mutex);
+            if (queue.jobs.empty()) {
+                continue;
+            }
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            m_queued_jobs--;
+            return true;
+        }
+        return false;
+    }
+
+    bool JobSystem::TryExecuteJob() {
+        const auto queue_index = GetCurrentQueueIndex();
+        Job job;
+        if (!TryPop(queue_index, job) && !TrySteal(queue_index, job)) {
+            return false;
+        }
+        Execute(job);
+        return true;
+    }
+
+    bool JobSystem::TryExecuteMainThreadJob() {
+        Job job;
+        {
+            std::lock_guard lock(m_main_thread_mutex);
+            if (m_main_thread_jobs.empty()) {
+                return false;
+            }
+            job = std::move(m_main_thread_jobs.front());
+            m_main_thread_jobs.pop_front();
+            m_queued_main_thread_jobs--;
+        }
+        Execute(job);
+        return true;
+    }
+
+    void JobSystem::Execute(Job& job) {
+        if (job.counter == nullptr) {
+            job.function();
+            return;
+        }
+
+        try {
+            job.function();
+        } catch (...) {
+            job.counter->StoreException(std::current_exception());
+        }
+        if (job.counter->Decrement()) {
+            WakeWaiters();
+        }
+    }
+
+    void JobSystem::WakeWaiters() {
+        bool has_waiters;
+        {
+            std::lock_guard lock(m_sleep_mutex);
+            has_waiters = m_waiting > 0;
+        }
+        if (has_waiters) {
+            m_wake_waiters.notify_all();
+        }
+    }
+
+    std::size_t JobSystem::GetCurrentQueueIndex() const {
+        if (t_owner == this) {
+            return t_queue_index;
+        }
+        if (IsMainThread()) {
+            return MAIN_QUEUE_INDEX;
+        }
+        // Threads outside the job system spread their jobs over all queues.
+        return m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    }
+} // namespace
@@ -0,0 +1,38 @@
+#pragma once
+#include <algorithm>
+#include <exception>
+
+#include "../include/JobSystem.hpp"
+
+namespace Engine::Jobs {
+    template<typename Fn>
+    void JobSystem::ParallelFor(const std::size_t count, std::size_t grain_size, Fn&& fn) {
+        if (count == 0) {
+            return;
+        }
+        grain_size = std::max<std::size_t>(grain_size, 1);
+        if (count <= grain_size || m_workers.empty()) {
+            fn(std::size_t{0}, count);
+            return;
+        }
+
+        JobCounter counter;
+        for (std::size_t begin = grain_size; begin < count; begin += grain_size) {
+            const auto end = std::min(begin + grain_size, count);
+            Schedule([&fn, begin, end] { fn(begin, end); }, &counter);
+        }
+
+        // The calling thread processes the first range itself, but has to wait for the scheduled ranges before an
+        // exception may leave this function, since they still reference fn.
+        std::exception_ptr exception;
+        try {
+            fn(std::size_t{0}, grain_size);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        Wait(counter);
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+} // namespace
@@ -0,0 +1,207 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/JobSystem.hpp"
+
+using namespace Engine::Jobs;
+
+TEST_CASE("JobSystem - executes every scheduled job", "[jobs][fast]") {
+    JobSystem job_system(3);
+    JobCounter counter;
+    std::atomic<int> executed = 0;
+
+    for (int i = 0; i < 1000; ++i) {
+        job_system.Schedule([&executed] { executed++; }, &counter);
+    }
+    job_system.Wait(counter);
+
+    REQUIRE(executed == 1000);
+    REQUIRE(counter.IsDone());
+}
+
+TEST_CASE("JobSystem - jobs run on worker threads", "[jobs][fast]") {
+    JobSystem job_system(2);
+    JobCounter counter;
+    std::atomic<bool> first_started = false;
+    std::atomic<bool> second_started = false;
+
+    // Both jobs wait for each other, which only finishes if two threads execute them at the same time.
+    job_system.Schedule([&] {
+        first_started = true;
+        while (!second_started) {
+        }
+    }, &counter);
+    job_system.Schedule([&] {
+        second_started = true;
+        while (!first_started) {
+        }
+    }, &counter);
+    job_system.Wait(counter);
+
+    REQUIRE(first_started);
+    REQUIRE(second_started);
+}
+
+TEST_CASE("JobSystem - nested jobs can wait inside a job", "[jobs][fast]") {
+    JobSystem job_system(2);
+    JobCounter outer_counter;
+    std::atomic<int> executed = 0;
+
+    for (int i = 0; i < 8; ++i) {
+        job_system.Schedule([&job_system, &executed] {
+            JobCounter inner_counter;
+            for (int j = 0; j < 8; ++j) {
+                job_system.Schedule([&executed] { executed++; }, &inner_counter);
+            }
+            job_system.Wait(inner_counter);
+        }, &outer_counter);
+    }
+    job_system.Wait(outer_counter);
+
+    REQUIRE(executed == 64);
+}
+
+TEST_CASE("JobSystem - a parent counter waits for its children", "[jobs][fast]") {
+    JobSystem job_system(2);
+    JobCounter parent;
+    JobCounter child_a(&parent);
+    JobCounter child_b(&parent);
+    std::atomic<int> executed = 0;
+
+    for (int i = 0; i < 16; ++i) {
+        job_system.Schedule([&executed] { executed++; }, &child_a);
+        job_system.Schedule([&executed] { executed++; }, &child_b);
+    }
+    job_system.Wait(parent);
+
+    REQUIRE(executed == 32);
+    REQUIRE(child_a.IsDone());
+    REQUIRE(child_b.IsDone());
+}
+
+TEST_CASE("JobSystem - ParallelFor covers every index exactly once", "[jobs][fast]") {
+    JobSystem job_system(3);
+    std::vector<int> values(10'007, 0);
+
+    job_system.ParallelFor(values.size(), 64, [&values](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            values[i]++;
+        }
+    });
+
+    REQUIRE(std::accumulate(values.begin(), values.end(), 0) == 10'007);
+    REQUIRE(std::ranges::all_of(values, [](const int value) { return value == 1; }));
+}
+
+TEST_CASE("JobSystem - ParallelFor without workers runs on the caller", "[jobs][fast]") {
+    JobSystem job_system(0);
+    std::vector<std::pair<std::size_t, std::size_t> > ranges;
+
+    job_system.ParallelFor(100, 10, [&ranges](const std::size_t begin, const std::size_t end) {
+        ranges.emplace_back(begin, end);
+    });
+
+    REQUIRE(ranges == std::vector<std::pair<std::size_t, std::size_t> >{{0, 100}});
+}
+
+TEST_CASE("JobSystem - main thread jobs only run on the main thread", "[jobs][fast]") {
+    JobSystem job_system(2);
+    JobCounter counter;
+    const auto main_thread = std::this_thread::get_id();
+    std::atomic<bool> ran_on_main_thread = false;
+
+    job_system.Schedule([&] {
+        job_system.ScheduleOnMainThread([&] {
+            ran_on_main_thread = std::this_thread::get_id() == main_thread;
+        }, &counter);
+    }, &counter);
+    job_system.Wait(counter);
+
+    REQUIRE(ran_on_main_thread);
+}
+
+TEST_CASE("JobSystem - ExecuteMainThreadJobs runs queued main thread jobs", "[jobs][fast]") {
+    JobSystem job_system(1);
+    int executed = 0;
+
+    job_system.ScheduleOnMainThread([&executed] { executed++; });
+    job_system.ScheduleOnMainThread([&executed] { executed++; });
+    REQUIRE(executed == 0);
+
+    job_system.ExecuteMainThreadJobs();
+    REQUIRE(executed == 2);
+}
+
+TEST_CASE("JobSystem - Wait rethrows exceptions of jobs", "[jobs][fast]") {
+    JobSystem job_system(2);
+    JobCounter counter;
+    std::atomic<int> executed = 0;
+
+    job_system.Schedule([] { throw std::runtime_error("Job failed"); }, &counter);
+    for (int i = 0; i < 10; ++i) {
+        job_system.Schedule([&executed] { executed++; }, &counter);
+    }
+
+    REQUIRE_THROWS_AS(job_system.Wait(counter), std::runtime_error);
+    REQUIRE(executed == 10);
+    REQUIRE_NOTHROW(job_system.Wait(counter));
+}
+
+TEST_CASE("JobSystem - ParallelFor rethrows after all ranges finished", "[jobs][fast]") {
+    JobSystem job_system(2);
+    std::atomic<std::size_t> processed = 0;
+
+    REQUIRE_THROWS_AS(job_system.ParallelFor(1000, 100, [&processed](const std::size_t begin, const std::size_t end) {
+        if (begin == 500) {
+            throw std::runtime_error("Range failed");
+        }
+        processed += end - begin;
+    }), std::runtime_error);
+    REQUIRE(processed == 900);
+}
+
+TEST_CASE("JobSystem - Wait sleeps until a running job finishes or schedules more work", "[jobs][fast]") {
+    JobSystem job_system(1);
+    JobCounter counter;
+    std::atomic<int> executed = 0;
+
+    // The main thread runs out of work while the worker still sleeps, then gets woken up by the main thread job
+    job_system.Schedule([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        job_system.ScheduleOnMainThread([&executed] { executed++; }, &counter);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        executed++;
+    }, &counter);
+    job_system.Wait(counter);
+
+    REQUIRE(executed == 2);
+}
+
+TEST_CASE("JobSystem - destroying the job system executes the queued jobs", "[jobs][fast]") {
+    std::atomic<int> executed = 0;
+    for (const std::size_t worker_count: {std::size_t{0}, std::size_t{2}}) {
+        executed = 0;
+        {
+            JobSystem job_system(worker_count);
+            for (int i = 0; i < 100; ++i) {
+                job_system.Schedule([&job_system, &executed] {
+                    executed++;
+                    job_system.Schedule([&executed] { executed++; });
+                });
+            }
+            job_system.ScheduleOnMainThread([&executed] { executed++; });
+        }
+        REQUIRE(executed == 201);
+    }
+}
@@ -33,4 +33,20 @@ namespace Engine::Renderer {
         glm::mat4 Model;
         glm::vec4 Color;
     };
+
+    /**
+     * @struct RenderFrameData
+     * All state needed to draw one frame, copied out of the world at the end of the update phase.
+     * The renderer only reads this copy, so the simulation can already advance the world while it is drawn.
+     */
+    struct RenderFrameData {
+        CameraAsset camera{};
+        bool has_camera = false;
+        std::vector<DrawAsset> draw_assets;
+
+        void Clear() {
+            has_camera = false;
+            draw_assets.clear();
+        }
+    };
 }
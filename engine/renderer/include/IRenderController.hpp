@@ -16,7 +16,24 @@ namespace Engine::Renderer
 
         virtual void SubmitDebugInfos(const std::vector<DrawAsset>& debug_draw_assets) = 0;
 
-        virtual void RenderFrame(const CameraAsset& camera_asset, std::vector<DrawAsset> draw_assets) const = 0;
+        /**
+         * Get the frame the simulation is currently extracting its draw state into. The renderer never reads
+         * this buffer until it is submitted.
+         * @return The write buffer of the current frame
+         */
+        virtual RenderFrameData& GetFrameData() = 0;
+
+        /**
+         * Hand the extracted frame over to the renderer and present it. With a render thread this only waits
+         * until the previous frame is drawn, so the next simulation frame runs while this one is rendered.
+         */
+        virtual void SubmitFrame() = 0;
+
+        /**
+         * Finish the last submitted frame, stop the render thread and bind the render context to the calling
+         * thread again. Must be called before the window is destroyed.
+         */
+        virtual void StopRenderThread() = 0;
 
         virtual Assets::MeshHandle GetUIMeshHandle() const = 0;
 
@@ -9,7 +9,14 @@
 namespace Engine::Renderer {
     class RenderControllerFactory {
     public:
+        /**
+         * Create the render controller for the API of the window.
+         * @param window The window to render into, its render context has to be current on the calling thread
+         * @param asset_handler The asset handler providing meshes, materials, textures and shaders
+         * @param use_render_thread If true, frames are drawn on a dedicated render thread owning the render context
+         * @return The render controller
+         */
         static std::unique_ptr<IRenderController> CreateRenderController(
-                const Environment::WindowContext& window_context, AssetHandling::AssetHandler* asset_handler);
+                Environment::IWindow& window, AssetHandling::AssetHandler* asset_handler, bool use_render_thread);
     };
 } // namespace
@@ -11,11 +11,12 @@
 
 namespace Engine::Renderer
 {
-    RenderController::RenderController(const Environment::WindowContext& window_context,
-                                       AssetHandling::AssetHandler* asset_handler)
+    RenderController::RenderController(Environment::IWindow& window,
+                                       AssetHandling::AssetHandler* asset_handler,
+                                       const bool use_render_thread) : m_window(window)
     {
-        m_window_context = window_context;
         m_asset_handler = asset_handler;
+        const auto& window_context = m_window.GetWindowContext();
 
         switch (window_context.renderApi)
         {
@@ -26,7 +27,7 @@ namespace Engine::Renderer
                     auto texture_library = std::make_shared<RenderFramework::OpenGl::OpenGLTextureLibrary>();
                     auto shader_library = std::make_shared<RenderFramework::OpenGl::OpenGlShaderLibrary>(asset_handler);
                     m_renderer = std::make_unique<RenderFramework::OpenGl::OpenGlRenderer>(
-                        m_window_context,
+                        window_context,
                         m_asset_handler,
                         material_library,
                         shader_library,
@@ -47,10 +48,18 @@ namespace Engine::Renderer
         m_renderer->Initialize();
 
         m_ui_mesh_handle = m_asset_handler->RegisterAsset(CreateUiPrimitive());
+
+        if (use_render_thread)
+        {
+            // The render context can only be current on one thread, hand it from the creating thread to the render thread
+            m_window.ReleaseContext();
+            m_render_thread = std::thread(&RenderController::RenderThreadLoop, this);
+        }
     }
 
     RenderController::~RenderController()
     {
+        StopRenderThread();
         m_asset_handler = nullptr;
         m_renderer->Shutdown();
         m_renderer.reset();
@@ -62,16 +71,43 @@ namespace Engine::Renderer
         m_debug_draw_assets = debug_draw_assets;
     }
 
-    void RenderController::RenderFrame(const CameraAsset& camera_asset, std::vector<DrawAsset> draw_assets) const
+    RenderFrameData& RenderController::GetFrameData()
     {
-        for (auto& debug_draw_asset : m_debug_draw_assets)
+        return m_frames[m_write_index].data;
+    }
+
+    void RenderController::SubmitFrame()
+    {
+        auto& slot = m_frames[m_write_index];
+        slot.data.draw_assets.insert(slot.data.draw_assets.end(), m_debug_draw_assets.begin(),
+                                     m_debug_draw_assets.end());
+        CollectGpuUploads(slot);
+
+        if (!m_render_thread.joinable())
         {
-            draw_assets.push_back(debug_draw_asset);
+            RenderSlot(slot);
+            slot.Clear();
+            return;
         }
 
-        PrepareGpuResources(draw_assets);
-        m_renderer->PrepareFrame(camera_asset);
-        m_renderer->DrawFrame(draw_assets);
+        HandOverToRenderThread();
+        m_write_index = 1 - m_write_index;
+        m_frames[m_write_index].Clear();
+    }
+
+    void RenderController::StopRenderThread()
+    {
+        if (!m_render_thread.joinable())
+        {
+            return;
+        }
+        {
+            std::lock_guard lock(m_frame_mutex);
+            m_stop_requested = true;
+        }
+        m_frame_condition.notify_all();
+        m_render_thread.join();
+        m_window.MakeContextCurrent();
     }
 
     Assets::MeshHandle RenderController::GetUIMeshHandle() const
@@ -81,72 +117,179 @@ namespace Engine::Renderer
 
     uint32_t RenderController::GetDrawCalls() const
     {
-        return m_renderer->GetDrawCalls();
+        return m_draw_calls.load(std::memory_order_relaxed);
     }
 
+    void RenderController::FrameSlot::Clear()
+    {
+        data.Clear();
+        mesh_uploads.clear();
+        material_uploads.clear();
+        texture_uploads.clear();
+    }
 
-    void RenderController::PrepareGpuResources(const std::vector<DrawAsset>& draw_assets) const
+    void RenderController::CollectGpuUploads(FrameSlot& slot)
     {
-        for (const auto& draw_asset : draw_assets)
+        for (const auto& draw_asset : slot.data.draw_assets)
         {
-            PrepareMeshesForGpu(draw_asset.Mesh);
-            PrepareMaterialsForGpu(draw_asset.Material);
+            CollectMeshUpload(slot, draw_asset.Mesh);
+            CollectMaterialUpload(slot, draw_asset.Material);
         }
     }
 
-    void RenderController::PrepareMeshesForGpu(const Assets::MeshHandle& mesh_handle) const
+    void RenderController::CollectMeshUpload(FrameSlot& slot, const Assets::MeshHandle mesh_handle)
     {
-        const auto mesh_revision = m_asset_handler->GetAssetRevision<AssetHandling::MeshAsset>(mesh_handle);
-        if (!m_mesh_library->HasMesh(mesh_handle))
+        const auto revision = m_asset_handler->GetAssetRevision<AssetHandling::MeshAsset>(mesh_handle);
+        auto [it, inserted] = m_submitted_mesh_revisions.try_emplace(mesh_handle, revision);
+        if (!inserted && it->second == revision)
         {
-            const auto mesh_asset = m_asset_handler->GetAsset<AssetHandling::MeshAsset>(mesh_handle);
-            m_mesh_library->AddMesh(mesh_handle, *mesh_asset, mesh_revision);
+            return;
         }
-        else if (m_mesh_library->GetMeshRevision(mesh_handle) != mesh_revision)
+        it->second = revision;
+        slot.mesh_uploads.push_back({
+            mesh_handle, m_asset_handler->GetAsset<AssetHandling::MeshAsset>(mesh_handle), revision
+        });
+    }
+
+    void RenderController::CollectMaterialUpload(FrameSlot& slot, const Assets::MaterialHandle material_handle)
+    {
+        const auto revision = m_asset_handler->GetAssetRevision<AssetHandling::MaterialAsset>(material_handle);
+        auto [it, inserted] = m_submitted_material_revisions.try_emplace(material_handle, revision);
+        if (inserted || it->second != revision)
+        {
+            it->second = revision;
+            const auto material_asset = m_asset_handler->GetAsset<AssetHandling::MaterialAsset>(material_handle);
+            m_material_textures[material_handle] = material_asset->albedo_texture.texture;
+            slot.material_uploads.push_back({material_handle, material_asset, revision});
+        }
+
+        const auto albedo_texture_handle = m_material_textures[material_handle];
+        if (!albedo_texture_handle)
         {
-            const auto mesh_asset = m_asset_handler->GetAsset<AssetHandling::MeshAsset>(mesh_handle);
-            m_mesh_library->RemoveMesh(mesh_handle);
-            m_mesh_library->AddMesh(mesh_handle, *mesh_asset, mesh_revision);
+            return;
         }
+
+        CollectTextureUpload(slot, albedo_texture_handle);
     }
 
+    void RenderController::CollectTextureUpload(FrameSlot& slot, const Assets::TextureHandle texture_handle)
+    {
+        const auto revision = m_asset_handler->GetAssetRevision<AssetHandling::TextureAsset>(texture_handle);
+        auto [it, inserted] = m_submitted_texture_revisions.try_emplace(texture_handle, revision);
+        if (!inserted && it->second == revision)
+        {
+            return;
+        }
+        it->second = revision;
+        slot.texture_uploads.push_back({
+            texture_handle, m_asset_handler->GetAsset<AssetHandling::TextureAsset>(texture_handle), revision
+        });
+    }
 
-    void RenderController::PrepareMaterialsForGpu(const Assets::MaterialHandle& handle) const
+    void RenderController::HandOverToRenderThread()
     {
-        const auto material_revision = m_asset_handler->GetAssetRevision<AssetHandling::MaterialAsset>(handle);
-        const auto material_asset = m_asset_handler->GetAsset<AssetHandling::MaterialAsset>(handle);
-        if (!m_material_library->HasMaterial(handle))
+        std::unique_lock lock(m_frame_mutex);
+        // Only two buffers exist, so the previous frame has to be drawn before its buffer is written again
+        m_frame_condition.wait(lock, [this] { return !m_pending_frame.has_value() && !m_render_busy; });
+        if (m_render_error)
         {
-            m_material_library->AddMaterial(handle, *material_asset, material_revision);
+            std::rethrow_exception(std::exchange(m_render_error, nullptr));
         }
-        else if (m_material_library->GetMaterialRevision(handle) != material_revision)
+        m_pending_frame = m_write_index;
+        lock.unlock();
+        m_frame_condition.notify_all();
+    }
+
+    void RenderController::RenderThreadLoop()
+    {
+        // Without a context no frame can be drawn, so the failure is handed back for every submitted frame
+        std::exception_ptr context_error;
+        try
+        {
+            m_window.MakeContextCurrent();
+        }
+        catch (...)
         {
-            m_material_library->RemoveMaterial(handle);
-            m_material_library->AddMaterial(handle, *material_asset, material_revision);
+            context_error = std::current_exception();
         }
+        while (true)
+        {
+            std::unique_lock lock(m_frame_mutex);
+            m_frame_condition.wait(lock, [this] { return m_pending_frame.has_value() || m_stop_requested; });
+            if (!m_pending_frame.has_value())
+            {
+                break;
+            }
+            auto& slot = m_frames[*m_pending_frame];
+            m_pending_frame.reset();
+            m_render_busy = true;
+            lock.unlock();
 
-        const auto albedo_texture_handle = material_asset->albedo_texture.texture;
-        if (!albedo_texture_handle)
+            try
+            {
+                if (context_error)
+                {
+                    std::rethrow_exception(context_error);
+                }
+                RenderSlot(slot);
+            }
+            catch (...)
+            {
+                lock.lock();
+                m_render_error = std::current_exception();
+                lock.unlock();
+            }
+
+            lock.lock();
+            m_render_busy = false;
+            lock.unlock();
+            m_frame_condition.notify_all();
+        }
+        if (!context_error)
         {
-            return;
+            m_window.ReleaseContext();
         }
+    }
 
-        PrepareTexturesForGpu(albedo_texture_handle);
+    void RenderController::RenderSlot(FrameSlot& slot)
+    {
+        UploadGpuResources(slot);
+        if (slot.data.has_camera)
+        {
+            m_renderer->PrepareFrame(slot.data.camera);
+            m_renderer->DrawFrame(slot.data.draw_assets);
+            m_draw_calls.store(m_renderer->GetDrawCalls(), std::memory_order_relaxed);
+        }
+        m_window.SwapBuffers();
     }
 
-    void RenderController::PrepareTexturesForGpu(const Assets::TextureHandle handle) const
+    void RenderController::UploadGpuResources(const FrameSlot& slot) const
     {
-        const auto texture_revision = m_asset_handler->GetAssetRevision<AssetHandling::TextureAsset>(handle);
-        if (!m_texture_library->HasTexture(handle))
+        for (const auto& [handle, asset, revision] : slot.texture_uploads)
+        {
+            if (m_texture_library->HasTexture(handle))
+            {
+                m_texture_library->RemoveTexture(handle);
+            }
+            m_texture_library->AddTexture(handle, *asset, revision);
+        }
+
+        for (const auto& [handle, asset, revision] : slot.mesh_uploads)
         {
-            const auto texture_asset = m_asset_handler->GetAsset<AssetHandling::TextureAsset>(handle);
-            m_texture_library->AddTexture(handle, *texture_asset, texture_revision);
+            if (m_mesh_library->HasMesh(handle))
+            {
+                m_mesh_library->RemoveMesh(handle);
+            }
+            m_mesh_library->AddMesh(handle, *asset, revision);
         }
-        else if (m_texture_library->GetTextureRevision(handle) != texture_revision)
+
+        for (const auto& [handle, asset, revision] : slot.material_uploads)
         {
-            m_texture_library->RemoveTexture(handle);
-            const auto texture_asset = m_asset_handler->GetAsset<AssetHandling::TextureAsset>(handle);
-            m_texture_library->AddTexture(handle, *texture_asset, texture_revision);
+            if (m_material_library->HasMaterial(handle))
+            {
+                m_material_library->RemoveMaterial(handle);
+            }
+            m_material_library->AddMaterial(handle, *asset, revision);
         }
     }
 }
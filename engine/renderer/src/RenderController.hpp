@@ -1,5 +1,14 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 #include "AssetHandler.hpp"
 #include "Window.hpp"
@@ -13,37 +22,96 @@
 
 namespace Engine::Renderer
 {
+    /**
+     * Snapshot of an asset that changed since it was last handed to the GPU. Assets are copied on write by the
+     * asset handler, so the referenced version stays untouched while the render thread uploads it.
+     */
+    template <typename Handle, typename Asset>
+    struct GpuUpload
+    {
+        Handle handle;
+        std::shared_ptr<const Asset> asset;
+        uint32_t revision;
+    };
+
     class RenderController : public IRenderController
     {
     public:
-        explicit RenderController(const Environment::WindowContext& window_context,
-                                  AssetHandling::AssetHandler* asset_handler);
+        explicit RenderController(Environment::IWindow& window,
+                                  AssetHandling::AssetHandler* asset_handler,
+                                  bool use_render_thread);
 
         ~RenderController() override;
 
         void SubmitDebugInfos(const std::vector<DrawAsset>& debug_draw_assets) override;
-        
-        void RenderFrame(const CameraAsset& camera_asset, std::vector<DrawAsset> draw_assets) const override;
+
+        RenderFrameData& GetFrameData() override;
+
+        void SubmitFrame() override;
+
+        void StopRenderThread() override;
 
         Assets::MeshHandle GetUIMeshHandle() const override;
 
         [[nodiscard]] uint32_t GetDrawCalls() const override;
-        void PrepareMaterialsForGpu(const Assets::MaterialHandle& handle) const;
-        void PrepareMeshesForGpu(const Assets::MeshHandle& mesh_handle) const;
-        void PrepareTexturesForGpu(Assets::TextureHandle handle) const;
 
     private:
-        Environment::WindowContext m_window_context;
+        /**
+         * One side of the double buffer. The simulation thread fills it, the render thread consumes it.
+         */
+        struct FrameSlot
+        {
+            RenderFrameData data;
+            std::vector<GpuUpload<Assets::MeshHandle, AssetHandling::MeshAsset>> mesh_uploads;
+            std::vector<GpuUpload<Assets::MaterialHandle, AssetHandling::MaterialAsset>> material_uploads;
+            std::vector<GpuUpload<Assets::TextureHandle, AssetHandling::TextureAsset>> texture_uploads;
+
+            void Clear();
+        };
+
+        Environment::IWindow& m_window;
         AssetHandling::AssetHandler* m_asset_handler;
         std::unique_ptr<RenderFramework::IRenderer> m_renderer;
         std::vector<DrawAsset> m_debug_draw_assets;
         Assets::MeshHandle m_ui_mesh_handle;
-        
+
         std::shared_ptr<Resources::IGpuMaterialLibrary> m_material_library;
         std::shared_ptr<Resources::IGpuMeshLibrary> m_mesh_library;
         std::shared_ptr<Resources::IGpuTextureLibrary> m_texture_library;
         std::shared_ptr<Resources::IShaderLibrary> m_shader_library;
-        
-        void PrepareGpuResources(const std::vector<DrawAsset>& draw_assets) const;
+
+        // Owned by the simulation thread: the revisions already handed to the renderer
+        std::unordered_map<Assets::MeshHandle, uint32_t> m_submitted_mesh_revisions;
+        std::unordered_map<Assets::MaterialHandle, uint32_t> m_submitted_material_revisions;
+        std::unordered_map<Assets::TextureHandle, uint32_t> m_submitted_texture_revisions;
+        std::unordered_map<Assets::MaterialHandle, Assets::TextureHandle> m_material_textures;
+
+        std::array<FrameSlot, 2> m_frames;
+        std::size_t m_write_index = 0;
+        std::atomic<uint32_t> m_draw_calls = 0;
+
+        std::thread m_render_thread;
+        std::mutex m_frame_mutex;
+        std::condition_variable m_frame_condition;
+        std::optional<std::size_t> m_pending_frame;
+        bool m_render_busy = false;
+        bool m_stop_requested = false;
+        std::exception_ptr m_render_error;
+
+        void CollectGpuUploads(FrameSlot& slot);
+
+        void CollectMeshUpload(FrameSlot& slot, Assets::MeshHandle mesh_handle);
+
+        void CollectMaterialUpload(FrameSlot& slot, Assets::MaterialHandle material_handle);
+
+        void CollectTextureUpload(FrameSlot& slot, Assets::TextureHandle texture_handle);
+
+        void HandOverToRenderThread();
+
+        void RenderThreadLoop();
+
+        void RenderSlot(FrameSlot& slot);
+
+        void UploadGpuResources(const FrameSlot& slot) const;
     };
 }
@@ -4,8 +4,7 @@
 
 namespace Engine::Renderer {
     std::unique_ptr<IRenderController> RenderControllerFactory::CreateRenderController(
-            const Environment::WindowContext& window_context, AssetHandling::
-            AssetHandler* asset_handler) {
-        return std::make_unique<RenderController>(window_context,  asset_handler);
+            Environment::IWindow& window, AssetHandling::AssetHandler* asset_handler, const bool use_render_thread) {
+        return std::make_unique<RenderController>(window, asset_handler, use_render_thread);
     }
 } // namespace
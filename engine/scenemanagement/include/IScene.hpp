@@ -4,8 +4,10 @@
 
 #pragma once
 #include <exception>
+#include <functional>
 #include <iostream>
 #include <ostream>
+#include <vector>
 #include <spdlog/spdlog.h>
 
 #include "../src/SceneContext.hpp"
@@ -44,18 +46,15 @@ namespace Engine::SceneManagement
             std::cout << "Initializing scene" << m_scene_name << "..." << std::endl;
             m_context = &scene_context;
             m_initialized = true;
-            m_context->system_manager.RegisterForSystemCommands(
-                m_scene_name,
-                [this](const std::vector<std::any>& commands)
-                {
-                    this->EvaluateSystemCommands(commands);
-                }
-            );
+            SubscribeToCommands();
         }
 
         virtual void OnStart() = 0;
 
-        virtual void EvaluateSystemCommands(const std::vector<std::any>& commands)
+        /**
+         * Called once the scene is initialized. Override to subscribe to the commands of the systems with OnCommand().
+         */
+        virtual void SubscribeToCommands()
         {
         }
 
@@ -79,13 +78,32 @@ namespace Engine::SceneManagement
         void UnloadScene()
         {
             std::cout << "Unloading scene " << m_scene_name << "..." << std::endl;
-            m_context->world.ClearEntities();
-            m_context->system_manager.DeregisterForSystemCommands(m_scene_name);
+            m_context->world.Reset();
+            for (const auto subscription : m_command_subscriptions)
+            {
+                m_context->world.GetCommandBus()->Unsubscribe(subscription);
+            }
+            m_command_subscriptions.clear();
 
             m_initialized = false;
         }
 
     protected:
+        /**
+         * Subscribe to a command type sent by the systems. The subscription ends when the scene is unloaded.
+         * @tparam T The command type
+         * @param handler Called once per command during the command phase
+         */
+        template<class T>
+        void OnCommand(std::function<void(const T&)> handler)
+        {
+            if (m_context == nullptr)
+            {
+                throw SceneRuntimeException();
+            }
+            m_command_subscriptions.push_back(m_context->world.GetCommandBus()->Subscribe<T>(std::move(handler)));
+        }
+
         [[nodiscard]] SceneWorld& World() const
         {
             if (m_context == nullptr)
@@ -143,6 +161,7 @@ namespace Engine::SceneManagement
     private:
         std::string m_scene_name;
         const SceneContext* m_context{};
+        std::vector<Ecs::CommandSubscriptionId> m_command_subscriptions;
         bool m_initialized = false;
     };
 }
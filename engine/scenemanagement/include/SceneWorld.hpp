@@ -13,11 +13,28 @@ namespace Engine::SceneManagement {
             return m_world.CreateEntity(name);
         };
 
+        [[nodiscard]] Ecs::EntityId CreateEntity() const {
+            return m_world.CreateEntity();
+        };
+
+        void CreateEntities(const std::size_t count, const std::span<Ecs::EntityId> out) const {
+            m_world.CreateEntities(count, out);
+        };
+
+        void Instantiate(const Ecs::Prefab& prefab, const std::size_t count, const std::span<Ecs::EntityId> out,
+                         const Ecs::PrefabOverrides& overrides = {}) const {
+            m_world.Instantiate(prefab, count, out, overrides);
+        };
+
         void DestroyEntity(const Ecs::EntityId entity) const {
             m_world.DestroyEntity(entity);
         };
 
-        [[nodiscard]] Ecs::EntityId GetEntityByName(const std::string& name) const {
+        [[nodiscard]] Ecs::EntityId GetEntityByName(const std::string_view name) const {
+            return m_world.GetEntityByName(name);
+        };
+
+        [[nodiscard]] Ecs::EntityId GetEntityByName(const Ecs::NameId name) const {
             return m_world.GetEntityByName(name);
         };
 
@@ -26,21 +43,64 @@ namespace Engine::SceneManagement {
             m_world.AddComponent(entity, component);
         }
 
+        template<typename T>
+        void AddComponents(std::span<const Ecs::EntityId> entities, std::span<const T> components) {
+            m_world.AddComponents<T>(entities, components);
+        }
+
         template<typename T>
         void RemoveComponent(const Ecs::EntityId entity) const {
             m_world.RemoveComponent<T>(entity);
         }
 
+        [[nodiscard]] Ecs::WorldSnapshot Snapshot() const {
+            return m_world.Snapshot();
+        }
+
+        void Restore(const Ecs::WorldSnapshot& snapshot) const {
+            m_world.Restore(snapshot);
+        }
+
         template<typename T>
         T* GetComponent(const Ecs::EntityId entity) const {
             return m_world.GetComponent<T>(entity);
         }
 
+        template<typename... Ts>
+        [[nodiscard]] bool HasComponents(const Ecs::EntityId entity) const {
+            return m_world.HasComponents<Ts...>(entity);
+        }
+
+        template<typename T>
+        Ecs::ComponentView<T> GetComponentView() const {
+            return m_world.GetComponentView<T>();
+        }
+
+        template<typename... Ts, typename... Ex>
+        Ecs::EntityView<Ecs::Exclude<Ex...>, Ts...> View(Ecs::Exclude<Ex...> exclude = {}) const {
+            return m_world.View<Ts...>(exclude);
+        }
+
         template<typename T>
         std::vector<std::pair<T*, Ecs::EntityId>> GetComponentsOfType() const {
             return m_world.GetComponentsOfType<T>();
         }
 
+        template<typename T>
+        void SetResource(T resource) const {
+            m_world.SetResource<T>(std::move(resource));
+        }
+
+        template<typename T>
+        [[nodiscard]] const T* GetResource() const {
+            return m_world.GetResource<T>();
+        }
+
+        template<typename T>
+        void RemoveResource() const {
+            m_world.RemoveResource<T>();
+        }
+
     private:
         Ecs::World& m_world;
     };
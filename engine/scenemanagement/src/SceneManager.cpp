@@ -81,20 +81,28 @@ namespace Engine::SceneManagement
         }
     }
 
+    Ecs::WorldMemoryStats SceneManager::GetWorldMemoryStats() const
+    {
+        return m_active_world->GetMemoryStats();
+    }
+
     void SceneManager::ApplyTransitionToPendingScene()
     {
         if (m_current_scene)
         {
+            // Logged per scene, so entities or pools that keep growing across transitions stand out
+            const auto stats = m_active_world->GetMemoryStats();
+            spdlog::info("Leaving scene with {} alive entities, {} component pools and {} KB of world memory",
+                         stats.entities.alive, stats.components.size(), stats.GetTotalBytes() / 1024);
+
             m_current_scene->OnExit();
             m_current_scene->UnloadScene();
             m_current_scene.reset();
         }
 
-        m_world_adapter.reset();
-        m_active_world.reset();
-
-        m_active_world = std::make_unique<Ecs::World>();
-        m_world_adapter = std::make_unique<SceneWorld>(*m_active_world);
+        // The world is reused, so the pools, the entity table and the command arena keep the capacity the previous
+        // scene grew them to. UnloadScene() already reset it, only the subscriptions of the old systems are left.
+        m_active_world->ClearSubscriptions();
 
         const auto old_context = m_context.value();
         auto new_context = SceneContext{\
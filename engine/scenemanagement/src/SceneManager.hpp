@@ -28,6 +28,11 @@ namespace Engine::SceneManagement
 
         void Update(float delta_time) const;
 
+        /**
+         * @return The memory stats of the world of the current scene
+         */
+        [[nodiscard]] Ecs::WorldMemoryStats GetWorldMemoryStats() const;
+
     private:
         std::optional<SceneContext> m_context;
         std::unique_ptr<IScene> m_current_scene;
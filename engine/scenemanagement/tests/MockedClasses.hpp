@@ -62,15 +62,6 @@ public:
     void UpdateSystems(float delta_time) override
     {
     }
-
-    void RegisterForSystemCommands(std::string subscriber_name,
-                                   std::function<void(std::vector<std::any>)> command_callback) override
-    {
-    }
-
-    void DeregisterForSystemCommands(const std::string& subscriber_name) override
-    {
-    }
 };
 
 class FakeAssetLibrary : public Engine::Assets::IAssetLibrary
@@ -175,3 +175,59 @@ TEST_CASE("SceneManagerTests - Update but no scene is loaded")
     scene_manager.Update(1.0f);
     REQUIRE(scenes.empty());
 }
+
+class SpawningScene : public Engine::SceneManagement::IScene
+{
+public:
+    void OnStart() override
+    {
+        for (int i = 0; i < 32; ++i)
+        {
+            spawned.push_back(World().CreateEntity("Spawned" + std::to_string(i)));
+        }
+    }
+
+    void OnExit() override
+    {
+    }
+
+    std::vector<Engine::Ecs::EntityId> spawned;
+};
+
+TEST_CASE("SceneManagerTests - Switching scenes resets the world and keeps its capacity")
+{
+    FakeApplication app{};
+    FakeInput input{};
+    FakeSystemManager system_manager{};
+    FakeAssetLibrary asset_library{};
+
+    auto scene_manager = Engine::SceneManagement::SceneManager(
+        app,
+        system_manager,
+        input,
+        asset_library,
+        1280,
+        720
+    );
+    scene_manager.RegisterScene("Spawning", [](const Engine::SceneManagement::SceneArgs&)
+    {
+        return std::make_unique<SpawningScene>();
+    });
+    scene_manager.RegisterScene("Demo", [](const Engine::SceneManagement::SceneArgs&)
+    {
+        return std::make_unique<DemoScene>();
+    });
+
+    scene_manager.LoadScene("Spawning", Engine::SceneManagement::SceneArgs{});
+    scene_manager.PreFixed(1.0f);
+    const auto spawned = scene_manager.GetWorldMemoryStats();
+    REQUIRE(spawned.entities.pending == 32);
+    REQUIRE(spawned.entities.named == 32);
+
+    scene_manager.LoadScene("Demo", Engine::SceneManagement::SceneArgs{});
+    scene_manager.PreFixed(1.0f);
+    const auto switched = scene_manager.GetWorldMemoryStats();
+    REQUIRE(switched.entities.pending == 0);
+    REQUIRE(switched.entities.named == 0);
+    REQUIRE(switched.entities.capacity == spawned.entities.capacity);
+}
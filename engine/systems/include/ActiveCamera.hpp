@@ -0,0 +1,12 @@
+#pragma once
+#include "Ecs/Types.hpp"
+
+namespace Engine::Systems {
+    /**
+     * World resource naming the camera the scene is rendered from. The CameraSystem makes the first camera of a
+     * scene the active one, scenes switch cameras by setting the resource themselves.
+     */
+    struct ActiveCamera {
+        Ecs::EntityId entity;
+    };
+}
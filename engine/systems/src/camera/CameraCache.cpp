@@ -11,17 +11,24 @@ namespace Engine::Systems::Camera {
             throw std::runtime_error("Camera Cache register: Entity already exists");
         }
         m_cache.emplace(entity, Element{});
+        m_entities.push_back(entity);
     }
 
     void CameraCache::DeregisterEntity(const uint64_t entity) {
         if (m_cache.contains(entity)) {
             m_cache.erase(entity);
+            std::erase(m_entities, entity);
             return;
         }
 
         throw std::runtime_error("Camera Cache unregister: Entity does not exists");
     }
 
+    void CameraCache::Clear() {
+        m_cache.clear();
+        m_entities.clear();
+    }
+
     void CameraCache::SetCacheValue(const uint64_t entity, const glm::mat4& view, const glm::mat4& projection,
                                     const uint64_t version) {
         if (!m_cache.contains(entity)) {
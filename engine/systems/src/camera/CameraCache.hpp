@@ -1,5 +1,6 @@
 #pragma once
 #include <unordered_map>
+#include <vector>
 #include <glm/fwd.hpp>
 #include <glm/ext/matrix_transform.hpp>
 
@@ -20,11 +21,22 @@ namespace Engine::Systems::Camera {
 
         void DeregisterEntity(uint64_t entity);
 
+        /**
+         * Drop all entries at once, e.g. after the world was reset.
+         */
+        void Clear();
+
         void SetCacheValue(uint64_t entity, const glm::mat4& view, const glm::mat4& projection, uint64_t version);
 
         const Element &GetCacheValue(uint64_t entity);
 
+        /**
+         * @return The registered camera entities, in the order they were registered
+         */
+        [[nodiscard]] const std::vector<uint64_t> &GetEntities() const { return m_entities; }
+
     private:
         std::unordered_map<uint64_t, Element> m_cache;
+        std::vector<uint64_t> m_entities;
     };
 } // namespace
@@ -1,39 +1,58 @@
 #include "CameraSystem.hpp"
 
+#include "ActiveCamera.hpp"
+
 namespace Engine::Systems {
     CameraSystem::CameraSystem() = default;
 
     CameraSystem::~CameraSystem() = default;
 
     void CameraSystem::Initialize() {
+        m_cameras = EcsWorld()->RegisterQuery<const Components::Camera, const Components::Transform>();
         EcsWorld()->GetComponentEventBus()->SubscribeOnComponentAddEvent<Components::Camera>(
                 [this](const Ecs::EntityId entity, const Components::Camera& _) {
                     if (this->Cache()->GetCameraCache() == nullptr) {
                         throw std::runtime_error("CameraSystem::Initialize() - cache is null");
                     }
                     this->Cache()->GetCameraCache()->RegisterEntity(entity);
+                    if (EcsWorld()->GetResource<ActiveCamera>() == nullptr) {
+                        EcsWorld()->SetResource(ActiveCamera{entity});
+                    }
                 }
                 );
         EcsWorld()->GetComponentEventBus()->SubscribeOnComponentRemoveEvent<Components::Camera>(
                 [this](const Ecs::EntityId entity) {
-                    this->Cache()->GetCameraCache()->DeregisterEntity(entity);
+                    auto* camera_cache = this->Cache()->GetCameraCache();
+                    camera_cache->DeregisterEntity(entity);
+                    const auto* active_camera = EcsWorld()->GetResource<ActiveCamera>();
+                    if (active_camera == nullptr || active_camera->entity != entity) {
+                        return;
+                    }
+                    // Fall back to the oldest remaining camera, so rendering goes on
+                    const auto& cameras = camera_cache->GetEntities();
+                    if (cameras.empty()) {
+                        EcsWorld()->RemoveResource<ActiveCamera>();
+                    } else {
+                        EcsWorld()->SetResource(ActiveCamera{cameras.front()});
+                    }
                 }
                 );
+        EcsWorld()->GetComponentEventBus()->SubscribeOnWorldResetEvent([this] {
+            this->Cache()->GetCameraCache()->Clear();
+        });
     }
 
     void CameraSystem::Run(float delta_time) {
-        auto camera_components = EcsWorld()->GetComponentsOfType<Components::Camera>();
-        for (const auto [camera, entity]: camera_components) {
-            const auto camera_transform = EcsWorld()->GetComponent<Components::Transform>(entity);
-            auto view_mat = CalculatedViewMat(camera_transform);
+        for (const auto [entity, camera, camera_transform]: m_cameras) {
+            auto view_mat = CalculatedViewMat(&camera_transform);
 
             const auto cache_val = Cache()->GetCameraCache()->GetCacheValue(entity);
             auto proj_mat = cache_val.projection;
-            if (cache_val.version != camera->GetVersion()) {
-                proj_mat = CalculateProjectionMat(camera);
+            if (cache_val.version != camera.GetVersion()) {
+                proj_mat = CalculateProjectionMat(&camera);
             }
 
-            Cache()->GetCameraCache()->SetCacheValue(entity, view_mat, proj_mat, camera->GetVersion());
+            Cache()->GetCameraCache()->SetCacheValue(entity, view_mat, proj_mat, camera.GetVersion());
         }
     }
 
@@ -6,7 +6,7 @@
 #include <Transform.hpp>
 #include "IEngineSystem.hpp"
 
-ECS_SYSTEM(CameraSystem, LateUpdate, TAGS(ENGINE), DEPENDENCIES())
+ECS_SYSTEM(CameraSystem, LateUpdate, TAGS(ENGINE), DEPENDENCIES(), READS(Camera, Transform), WRITES(CameraCache))
 
 namespace Engine::Systems {
     class CameraSystem final : public Ecs::IEngineSystem {
@@ -20,6 +20,8 @@ namespace Engine::Systems {
         void Run(float delta_time) override;
 
     private:
+        Ecs::Query<Ecs::Exclude<>, const Components::Camera, const Components::Transform> m_cameras;
+
         static glm::mat4 CalculatedViewMat(
                 const Components::Transform* transform);
         static glm::mat4 CalculateProjectionMat(const Components::Camera *camera_component);
@@ -32,6 +32,7 @@ namespace Engine::Systems::Physics
     void PhysicsSystem::Initialize()
     {
         m_transform_cache = Cache()->GetTransformCache();
+        m_movers = EcsWorld()->RegisterQuery<Components::Rigidbody, Components::Transform>();
 
         EcsWorld()->GetComponentEventBus()->SubscribeOnComponentAddEvent<Components::BoxCollider>(
             [this](const Ecs::EntityId entity, const Components::BoxCollider& box_collider)
@@ -60,25 +61,34 @@ namespace Engine::Systems::Physics
                 this->BuildSphereCollider(entity, sphere_collider, transform->GetPosition());
             }
         );
+
+        EcsWorld()->GetComponentEventBus()->SubscribeOnWorldResetEvent([this]
+        {
+            // A fresh broadphase is cheaper than removing every proxy, the query service refers to the old one
+            this->m_collider_cache->box_colliders.clear();
+            this->m_collider_cache->sphere_colliders.clear();
+            this->m_broadphase = Collision::BroadphaseBuilder::BuildBroadphase(2);
+            this->m_collision_query_service = std::make_unique<Collision::CollisionQueryService>(
+                *this->m_broadphase,
+                *this->m_collider_cache
+            );
+            this->m_collided_entities.clear();
+            this->m_triggered_entities.clear();
+        });
     }
 
     void PhysicsSystem::Run(const float fixed_delta_time)
     {
-        const auto movable_objects = EcsWorld()->GetComponentsOfType<Components::Rigidbody>();
-        for (const auto [rigidbody, entity] : movable_objects)
+        m_sweeps.clear();
+        for (auto [entity, rigidbody, transform] : m_movers)
         {
-            auto transform = EcsWorld()->GetComponent<Components::Transform>(entity);
-            if (transform == nullptr)
-            {
-                throw std::runtime_error("A moveable object without a transform component is impossible to handle!");
-            }
-            auto velocity = rigidbody->GetVelocity();
+            auto velocity = rigidbody.GetVelocity();
             if (glm::length2(velocity) < m_epsilon)
             {
                 continue;
             }
 
-            const glm::vec3 old_position = transform->GetPosition();
+            const glm::vec3 old_position = transform.GetPosition();
             glm::vec3 move_delta = velocity * fixed_delta_time;
 
             if (length2(move_delta) < m_epsilon)
@@ -90,26 +100,56 @@ namespace Engine::Systems::Physics
             {
                 continue;
             }
-            const float radius = it_sphere->second.world_sphere.radius;
             it_sphere->second.world_sphere.center = old_position;
 
-            std::vector<Ecs::EntityId> blocking_candidates;
-            std::vector<Ecs::EntityId> trigger_candidates;
-            RunBroadphase(entity, radius, old_position, move_delta, blocking_candidates, trigger_candidates);
+            SweepResult sweep{};
+            sweep.entity = entity;
+            sweep.rigidbody = &rigidbody;
+            sweep.transform = &transform;
+            sweep.position = old_position;
+            sweep.move_delta = move_delta;
+            sweep.radius = it_sphere->second.world_sphere.radius;
+            m_sweeps.push_back(std::move(sweep));
+        }
+
+        // The sweeps only read the static colliders, so they run in parallel. Events and the new positions are applied
+        // afterward in view order, which keeps the results independent of the thread count.
+        Workers()->ParallelFor(m_sweeps.size(), 16, [this](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                SweepMover(m_sweeps[i]);
+            }
+        });
 
-            glm::vec3 final_position;
-            PerformCollisionSweep(entity, old_position, move_delta, radius, blocking_candidates, &final_position);
-            DetectTriggerInteractions(final_position, radius, entity, trigger_candidates);
+        for (auto& sweep : m_sweeps)
+        {
+            RaiseCollisionEvents(sweep.entity, sweep.mover_result);
+            RaiseTriggerEvents(sweep.entity, sweep.inside_triggers);
 
-            if (rigidbody->IsVelocityFixed())
+            if (sweep.rigidbody->IsVelocityFixed())
             {
                 constexpr auto zero_velocity = glm::vec3(0);
-                rigidbody->SetVelocity(zero_velocity);
+                sweep.rigidbody->SetVelocity(zero_velocity);
             }
-            transform->SetPosition(final_position);
+            sweep.transform->SetPosition(sweep.mover_result.new_position);
+            EcsWorld()->MarkChanged<Components::Transform>(sweep.entity);
         }
     }
 
+    void PhysicsSystem::SweepMover(SweepResult& sweep) const
+    {
+        std::vector<Ecs::EntityId> blocking_candidates;
+        std::vector<Ecs::EntityId> trigger_candidates;
+        RunBroadphase(sweep.entity, sweep.radius, sweep.position, sweep.move_delta, blocking_candidates,
+                      trigger_candidates);
+
+        sweep.mover_result = PerformCollisionSweep(sweep.position, sweep.move_delta, sweep.radius,
+                                                   blocking_candidates);
+        sweep.inside_triggers = DetectTriggerInteractions(sweep.mover_result.new_position, sweep.radius,
+                                                          trigger_candidates);
+    }
+
     void PhysicsSystem::BuildBoxCollider(Ecs::EntityId entity, const Components::BoxCollider box_collider,
                                          const glm::vec3& position, const glm::vec3& rotation,
                                          const glm::vec3& scale) const
@@ -202,10 +242,10 @@ namespace Engine::Systems::Physics
         }
     }
 
-    void PhysicsSystem::PerformCollisionSweep(const Ecs::EntityId target_entity,
-                                              const glm::vec3 position, const glm::vec3 move_delta, const float radius,
-                                              const std::vector<Ecs::EntityId>& blocking_candidates,
-                                              glm::vec3* final_position)
+    Collision::MoverResult PhysicsSystem::PerformCollisionSweep(const glm::vec3 position, const glm::vec3 move_delta,
+                                                                const float radius,
+                                                                const std::vector<Ecs::EntityId>& blocking_candidates)
+        const
     {
         spdlog::debug("Performing collision sweep");
         Collision::MoverInput input;
@@ -214,10 +254,7 @@ namespace Engine::Systems::Physics
         input.delta = move_delta;
         input.max_iterations = 3;
 
-        const auto result = Collision::MoverSolver::Solve(input, *m_collision_query_service, blocking_candidates);
-        *final_position = result.new_position;
-
-        RaiseCollisionEvents(target_entity, result);
+        return Collision::MoverSolver::Solve(input, *m_collision_query_service, blocking_candidates);
     }
 
     void PhysicsSystem::RaiseCollisionEvents(const Ecs::EntityId target_entity,
@@ -256,9 +293,8 @@ namespace Engine::Systems::Physics
         }
     }
 
-    void PhysicsSystem::DetectTriggerInteractions(const glm::vec3 final_position,
-                                                  const float radius, const Ecs::EntityId target_entity,
-                                                  const std::vector<Ecs::EntityId>& trigger_candidates)
+    std::unordered_set<Ecs::EntityId> PhysicsSystem::DetectTriggerInteractions(const glm::vec3 final_position,
+        const float radius, const std::vector<Ecs::EntityId>& trigger_candidates) const
     {
         std::unordered_set<Ecs::EntityId> current_inside;
         current_inside.reserve(trigger_candidates.size());
@@ -285,7 +321,7 @@ namespace Engine::Systems::Physics
             }
         }
 
-        RaiseTriggerEvents(target_entity, current_inside);
+        return current_inside;
     }
 
     void PhysicsSystem::RaiseTriggerEvents(Ecs::EntityId target_entity,
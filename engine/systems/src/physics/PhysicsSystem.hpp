@@ -1,8 +1,12 @@
 #pragma once
 #include <memory>
+#include <unordered_set>
+#include <vector>
 
 #include "Collider.hpp"
 #include "IEngineSystem.hpp"
+#include "Rigidbody.hpp"
+#include "Transform.hpp"
 #include "collision/ColliderCache.hpp"
 #include "collision/CollisionQueryService.hpp"
 #include "collision/IBroadphase.hpp"
@@ -22,15 +26,31 @@ namespace Engine::Systems::Physics {
         void Run(float fixed_delta_time) override;
 
     private:
+        /**
+         * Input and result of the collision sweep of a single moving rigidbody.
+         */
+        struct SweepResult {
+            Ecs::EntityId entity;
+            Components::Rigidbody* rigidbody;
+            Components::Transform* transform;
+            glm::vec3 position;
+            glm::vec3 move_delta;
+            float radius;
+            Engine::Physics::Collision::MoverResult mover_result;
+            std::unordered_set<Ecs::EntityId> inside_triggers;
+        };
+
         const float m_epsilon = 1e-12f;
 
         Transform::TransformCache* m_transform_cache = nullptr;
+        Ecs::Query<Ecs::Exclude<>, Components::Rigidbody, Components::Transform> m_movers;
         std::unique_ptr<Engine::Physics::Collision::ColliderCache> m_collider_cache;
         std::unique_ptr<Engine::Physics::Collision::IBroadphase> m_broadphase;
         std::unique_ptr<Engine::Physics::Collision::ICollisionQueryService> m_collision_query_service;
 
         std::unordered_map<Ecs::EntityId, Ecs::EntityId> m_collided_entities;
         std::unordered_map<Ecs::EntityId, std::unordered_set<Ecs::EntityId> > m_triggered_entities;
+        std::vector<SweepResult> m_sweeps;
 
         void BuildBoxCollider(Ecs::EntityId entity, Components::BoxCollider box_collider, const glm::vec3& position,
                               const glm::vec3& rotation, const
@@ -43,14 +63,14 @@ namespace Engine::Systems::Physics {
                            std::vector<Ecs::EntityId>& blocking_candidates,
                            std::vector<Ecs::EntityId>& trigger_candidates) const;
 
-        void PerformCollisionSweep(Ecs::EntityId target_entity, glm::vec3 position,
-                                   glm::vec3 move_delta, float radius,
-                                   const std::vector<Ecs::EntityId>& blocking_candidates,
-                                   glm::vec3* final_position);
+        void SweepMover(SweepResult& sweep) const;
+
+        [[nodiscard]] Engine::Physics::Collision::MoverResult PerformCollisionSweep(
+                glm::vec3 position, glm::vec3 move_delta, float radius,
+                const std::vector<Ecs::EntityId>& blocking_candidates) const;
 
-        void DetectTriggerInteractions(glm::vec3 final_position, float radius,
-                                       Ecs::EntityId target_entity,
-                                       const std::vector<Ecs::EntityId>& trigger_candidates);
+        [[nodiscard]] std::unordered_set<Ecs::EntityId> DetectTriggerInteractions(
+                glm::vec3 final_position, float radius, const std::vector<Ecs::EntityId>& trigger_candidates) const;
 
         void RaiseCollisionEvents(Ecs::EntityId target_entity,
                                   const Engine::Physics::Collision::MoverResult& mover_result);
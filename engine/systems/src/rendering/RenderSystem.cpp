@@ -1,6 +1,6 @@
 #include "RenderSystem.hpp"
 
-#include <Camera.hpp>
+#include <ActiveCamera.hpp>
 #include <MeshRenderer.hpp>
 #include <Transform.hpp>
 #include <ui/Button.hpp>
@@ -15,8 +15,7 @@ namespace Engine::Systems
 
     void RenderSystem::Initialize()
     {
-        const auto* render_controller = ServiceLocator()->GetService<Renderer::IRenderController>();
-        m_render_controller = render_controller;
+        m_render_controller = ServiceLocator()->GetService<Renderer::IRenderController>();
         const auto* asset_handler = ServiceLocator()->GetService<AssetHandling::AssetHandler>();
         m_asset_handler = asset_handler;
         EcsWorld()->GetComponentEventBus()->SubscribeOnComponentAddEvent<Components::MeshRenderer>(
@@ -59,18 +58,33 @@ namespace Engine::Systems
             {
                 this->m_ui_text_asset_map.erase(entity);
             });
-        m_draw_assets = std::vector<Renderer::DrawAsset>();
+        EcsWorld()->GetComponentEventBus()->SubscribeOnWorldResetEvent([this]
+        {
+            this->m_draw_asset_map.clear();
+            this->m_ui_draw_asset_map.clear();
+            this->m_ui_text_asset_map.clear();
+        });
     }
 
     void RenderSystem::Run(float delta_time)
     {
-        const auto [camera, cameraEntity] = EcsWorld()->GetComponentsOfType<Components::Camera>()[0];
-        const auto camera_transform = EcsWorld()->GetComponent<Components::Transform>(cameraEntity);
-        const auto camera_asset = CreateCameraAsset(cameraEntity, camera_transform);
-        ClearDrawAssets();
-        FillMeshDrawAssets();
-        FillUiDrawAssets();
-        m_render_controller->RenderFrame(camera_asset, m_draw_assets);
+        // Only extract the draw state here, the engine submits the frame to the renderer at the end of the tick
+        auto& frame = m_render_controller->GetFrameData();
+        const auto* active_camera = EcsWorld()->GetResource<ActiveCamera>();
+        if (active_camera == nullptr)
+        {
+            return;
+        }
+        const auto camera_transform = EcsWorld()->GetComponent<Components::Transform>(active_camera->entity);
+        if (camera_transform == nullptr)
+        {
+            return;
+        }
+        frame.camera = CreateCameraAsset(active_camera->entity, camera_transform);
+        frame.has_camera = true;
+        ReserveDrawAssets(frame.draw_assets);
+        FillMeshDrawAssets(frame.draw_assets);
+        FillUiDrawAssets(frame.draw_assets);
     }
 
     Renderer::CameraAsset RenderSystem::CreateCameraAsset(const Ecs::EntityId& camera_entity,
@@ -84,13 +98,13 @@ namespace Engine::Systems
         return camera_asset;
     }
 
-    void RenderSystem::ClearDrawAssets()
+    void RenderSystem::ReserveDrawAssets(std::vector<Renderer::DrawAsset>& draw_assets) const
     {
-        m_draw_assets.clear();
-        m_draw_assets.reserve(m_draw_asset_map.size() + m_ui_draw_asset_map.size() + m_ui_text_asset_map.size());
+        draw_assets.reserve(draw_assets.size() + m_draw_asset_map.size() + m_ui_draw_asset_map.size() +
+                            m_ui_text_asset_map.size());
     }
 
-    void RenderSystem::FillMeshDrawAssets()
+    void RenderSystem::FillMeshDrawAssets(std::vector<Renderer::DrawAsset>& draw_assets) const
     {
         for (auto [entity, mesh_draw_asset] : m_draw_asset_map)
         {
@@ -100,12 +114,12 @@ namespace Engine::Systems
             }
 
             mesh_draw_asset.Model = Cache()->GetTransformCache()->GetTransformValue(entity).transform_matrix;
-            m_draw_assets.push_back(mesh_draw_asset);
+            draw_assets.push_back(mesh_draw_asset);
         }
     }
 
 
-    void RenderSystem::FillUiDrawAssets()
+    void RenderSystem::FillUiDrawAssets(std::vector<Renderer::DrawAsset>& draw_assets) const
     {
         const auto transform_cache = Cache()->GetTransformCache();
         const auto ui_cache = Cache()->GetUiCache();
@@ -121,7 +135,7 @@ namespace Engine::Systems
             ui_draw_asset.RenderQueueIndex = rect_transform.layer;
 
             ui_draw_asset.Color = ui_cache->GetColorElement(entity).color;
-            m_draw_assets.push_back(ui_draw_asset);
+            draw_assets.push_back(ui_draw_asset);
         }
         
         for (auto [entity, ui_draw_asset] : m_ui_text_asset_map)
@@ -135,7 +149,7 @@ namespace Engine::Systems
             ui_draw_asset.Model = rect_transform.global_matrix;
             ui_draw_asset.RenderQueueIndex = rect_transform.layer;
 
-            m_draw_assets.push_back(ui_draw_asset);
+            draw_assets.push_back(ui_draw_asset);
         }
         
     }
@@ -24,9 +24,8 @@ namespace Engine::Systems {
         void Run(float delta_time) override;
 
     private:
-        const Renderer::IRenderController* m_render_controller{};
+        Renderer::IRenderController* m_render_controller{};
         const AssetHandling::AssetHandler* m_asset_handler{};
-        std::vector<Renderer::DrawAsset> m_draw_assets;
         std::unordered_map<Ecs::EntityId, Renderer::DrawAsset> m_draw_asset_map;
         std::unordered_map<Ecs::EntityId, Renderer::DrawAsset> m_ui_draw_asset_map;
         std::unordered_map<Ecs::EntityId, Renderer::DrawAsset> m_ui_text_asset_map;
@@ -34,13 +33,13 @@ namespace Engine::Systems {
         Renderer::CameraAsset CreateCameraAsset(const Ecs::EntityId& camera_entity,
                                                 const Components::Transform* camera_transform) const;
 
-        void ClearDrawAssets();
+        void ReserveDrawAssets(std::vector<Renderer::DrawAsset>& draw_assets) const;
 
-        void FillMeshDrawAssets();
+        void FillMeshDrawAssets(std::vector<Renderer::DrawAsset>& draw_assets) const;
 
         bool IsDrawAssetValid(const Renderer::DrawAsset& ui_draw_asset) const;
 
-        void FillUiDrawAssets();
+        void FillUiDrawAssets(std::vector<Renderer::DrawAsset>& draw_assets) const;
 
         void RegisterDrawAssets(const Ecs::EntityId& entity, const Components::MeshRenderer& mesh_renderer);
 
@@ -1,4 +1,5 @@
 #include "RectTransformSystem.hpp"
+#include <Parent.hpp>
 #include <glm/ext/matrix_transform.hpp>
 
 namespace Engine::Systems {
@@ -9,28 +10,66 @@ namespace Engine::Systems {
                         throw std::runtime_error("TransformSystem: Transform cache is null");
                     }
                     this->Cache()->GetTransformCache()->RegisterRectTransformEntity(entity);
+                    // Entities that got their parent before their rect transform
+                    if (const auto* parent = EcsWorld()->GetComponent<Components::Parent>(entity)) {
+                        m_hierarchy.SetParent(entity, parent->entity);
+                    }
                 }
                 );
 
         EcsWorld()->GetComponentEventBus()->SubscribeOnComponentRemoveEvent<Components::UI::RectTransform>(
                 [this](const Ecs::EntityId entity) {
                     this->Cache()->GetTransformCache()->DeregisterRectTransformEntity(entity);
+                    m_hierarchy.RemoveEntity(entity);
                 }
                 );
+
+        EcsWorld()->GetComponentEventBus()->SubscribeOnWorldResetEvent([this] {
+            this->Cache()->GetTransformCache()->ClearRectTransformEntities();
+            m_hierarchy.Clear();
+        });
     }
 
     void RectTransformSystem::Run(float delta_time) {
-        const auto rect_transform_components = EcsWorld()->GetComponentsOfType<Components::UI::RectTransform>();
-        for (const auto [rect_transform, entity]: rect_transform_components) {
-            auto rect_transform_cache_value = Cache()->GetTransformCache()->GetRectTransformValue(entity);
+        auto* transform_cache = Cache()->GetTransformCache();
+        SyncHierarchy();
+        for (const auto [rect_transform, entity]: EcsWorld()->GetComponentView<Components::UI::RectTransform>()) {
+            const auto& rect_transform_cache_value = transform_cache->GetRectTransformValue(entity);
             if (rect_transform->GetVersion() == rect_transform_cache_value.last_version) {
                 continue;
             }
 
-            const auto layout_data = CreateLayoutData(rect_transform);
-            auto ui_layout = CreateUiLayoutResult(layout_data);
+            // Children are laid out by the propagation below, once the layout of their parent is final
+            if (!m_hierarchy.HasParent(entity)) {
+                const auto layout_data = CreateLayoutData(rect_transform, nullptr);
+                auto ui_layout = CreateUiLayoutResult(layout_data);
+                ui_layout.last_version = rect_transform->GetVersion();
+                transform_cache->SetValue(entity, ui_layout);
+            }
+            m_hierarchy.MarkDirty(entity);
+        }
+
+        m_hierarchy.Propagate([this, transform_cache](const Ecs::EntityId entity,
+                                                      const std::optional<Ecs::EntityId> parent) {
+            const auto* rect_transform = EcsWorld()->GetComponent<Components::UI::RectTransform>(entity);
+            if (rect_transform == nullptr || transform_cache->FindRectTransformValue(entity) == nullptr) {
+                return;
+            }
+            const auto* parent_value = parent.has_value() ? transform_cache->FindRectTransformValue(*parent) : nullptr;
+            auto ui_layout = CreateUiLayoutResult(CreateLayoutData(rect_transform, parent_value));
             ui_layout.last_version = rect_transform->GetVersion();
-            Cache()->GetTransformCache()->SetValue(entity, ui_layout);
+            transform_cache->SetValue(entity, ui_layout);
+        });
+    }
+
+    void RectTransformSystem::SyncHierarchy() {
+        for (const auto entity: EcsWorld()->Removed<Components::Parent>(LastRunTick())) {
+            m_hierarchy.RemoveParent(entity);
+        }
+        for (const auto [parent, entity]: EcsWorld()->Changed<Components::Parent>(LastRunTick())) {
+            if (EcsWorld()->HasComponents<Components::UI::RectTransform>(entity)) {
+                m_hierarchy.SetParent(entity, parent->entity);
+            }
         }
     }
 
@@ -59,7 +98,8 @@ namespace Engine::Systems {
         };
     }
 
-    LayoutData RectTransformSystem::CreateLayoutData(const Components::UI::RectTransform* rect_transform) {
+    LayoutData RectTransformSystem::CreateLayoutData(const Components::UI::RectTransform* rect_transform,
+                                                     const Transform::RectTransformCacheValue* parent) const {
         LayoutData result{};
         result.local_position = rect_transform->GetLocalPosition();
         result.local_size = rect_transform->GetLocalSize();
@@ -67,10 +107,9 @@ namespace Engine::Systems {
 
         const auto anchor_value = GetAnchorValue(rect_transform->GetAnchor());
 
-        if (rect_transform->GetParent().has_value()) {
-            const auto parent_layout = GetParentLayoutResult(rect_transform->GetParent().value());
-            result.parent_layer = parent_layout.layer;
-            result.anchor_point = parent_layout.global_position + parent_layout.global_size * anchor_value;
+        if (parent != nullptr) {
+            result.parent_layer = parent->layer;
+            result.anchor_point = parent->global_position + parent->global_size * anchor_value;
         } else {
             result.anchor_point = m_world_origin + m_world_scale * anchor_value;
             result.parent_layer = 0;
@@ -95,17 +134,4 @@ namespace Engine::Systems {
 
         return result;
     }
-
-    Transform::RectTransformCacheValue RectTransformSystem::GetParentLayoutResult(const Ecs::EntityId& parent_entity) {
-        const auto parent_rect_transform = EcsWorld()->GetComponent<Components::UI::RectTransform>(parent_entity);
-        const auto rect_transform_cache = Cache()->GetTransformCache()->GetRectTransformValue(parent_entity);
-        if (parent_rect_transform->GetVersion() == rect_transform_cache.last_version) {
-            return rect_transform_cache;
-        }
-
-        const auto layout_data = CreateLayoutData(parent_rect_transform);
-        const auto layout = CreateUiLayoutResult(layout_data);
-        Cache()->GetTransformCache()->SetValue(parent_entity, layout);
-        return layout;
-    }
 } // namespace
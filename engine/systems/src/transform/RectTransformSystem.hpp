@@ -2,9 +2,11 @@
 #include <glm/vec2.hpp>
 #include <ui/RectTransform.hpp>
 #include "IEngineSystem.hpp"
+#include "TransformHierarchy.hpp"
 
 namespace Engine::Systems {
-    ECS_SYSTEM(RectTransformSystem, LateUpdate, TAGS(ENGINE), DEPENDENCIES())
+    ECS_SYSTEM(RectTransformSystem, LateUpdate, TAGS(ENGINE), DEPENDENCIES(), READS(RectTransform, Parent),
+               WRITES(TransformCache))
 
     struct LayoutData {
         glm::vec2 local_position;
@@ -25,13 +27,23 @@ namespace Engine::Systems {
         void Run(float delta_time) override;
 
     private:
+        /**
+         * Apply the Parent components added, changed or removed since the last run to the hierarchy.
+         */
+        void SyncHierarchy();
+
         static glm::vec2 GetAnchorValue(const Components::UI::Anchor& anchor);
 
-        LayoutData CreateLayoutData(const Components::UI::RectTransform* rect_transform);
+        /**
+         * @param rect_transform The rect to lay out
+         * @param parent The final layout of the parent, nullptr to anchor the rect to the screen
+         */
+        LayoutData CreateLayoutData(const Components::UI::RectTransform* rect_transform,
+                                    const Transform::RectTransformCacheValue* parent) const;
 
         static Transform::RectTransformCacheValue CreateUiLayoutResult(const LayoutData& rect_layout);
 
-        Transform::RectTransformCacheValue GetParentLayoutResult(const Ecs::EntityId& parent_entity);
+        Transform::TransformHierarchy m_hierarchy;
 
         glm::vec2 m_world_origin = glm::vec2(0.0f);
         glm::vec2 m_world_scale = glm::vec2(1920, 1080);
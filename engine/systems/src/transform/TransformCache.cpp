@@ -16,6 +16,13 @@ namespace Engine::Systems::Transform {
         m_transform_cache[entity] = TransformCacheValue();
     }
 
+    void TransformCache::RegisterTransformEntities(const std::span<const uint64_t> entities) {
+        m_transform_cache.reserve(m_transform_cache.size() + entities.size());
+        for (const auto entity: entities) {
+            RegisterTransformEntity(entity);
+        }
+    }
+
     void TransformCache::RegisterRectTransformEntity(const uint64_t entity) {
         if (m_rect_transform_cache.contains(entity)) {
             throw std::runtime_error("Entity already exists in Rect Transform cache");
@@ -37,31 +44,39 @@ namespace Engine::Systems::Transform {
         m_rect_transform_cache.erase(entity);
     }
 
-    bool TransformCache::IsDirty(const uint64_t entity, const Components::Transform* transform) {
-        if (!m_transform_cache.contains(entity)) {
-            throw std::runtime_error("Transform cache does not exist for entity " + std::to_string(entity));
-        }
+    void TransformCache::ClearTransformEntities() {
+        m_transform_cache.clear();
+    }
 
-        const auto cache_val = m_transform_cache[entity].last_version;
-        const auto transform_version = transform->GetVersion();
-        return cache_val != transform_version;
+    void TransformCache::ClearRectTransformEntities() {
+        m_rect_transform_cache.clear();
     }
 
     void TransformCache::SetValue(const uint64_t entity, const Components::Transform* transform,
                                   const glm::mat4& transform_mat) {
-        if (!m_transform_cache.contains(entity)) {
+        const auto it = m_transform_cache.find(entity);
+        if (it == m_transform_cache.end()) {
             throw std::runtime_error("Entity does not exist in Transform cache.");
         }
 
-        m_transform_cache[entity] = TransformCacheValue{
+        it->second = TransformCacheValue{
             .last_position = transform->GetPosition(),
             .last_rotation = transform->GetRotation(),
             .last_scale = transform->GetScale(),
             .last_version = transform->GetVersion(),
+            .local_matrix = transform_mat,
             .transform_matrix = transform_mat,
         };
     }
 
+    void TransformCache::SetWorldMatrix(const uint64_t entity, const glm::mat4& world_matrix) {
+        const auto it = m_transform_cache.find(entity);
+        if (it == m_transform_cache.end()) {
+            throw std::runtime_error("Entity does not exist in Transform cache.");
+        }
+        it->second.transform_matrix = world_matrix;
+    }
+
     void TransformCache::SetValue(const uint64_t entity, const RectTransformCacheValue& rect_transform_cache_value) {
         if (!m_rect_transform_cache.contains(entity)) {
             throw std::runtime_error("Entity does not exist in Rect Transform cache.");
@@ -82,4 +97,14 @@ namespace Engine::Systems::Transform {
         }
         throw std::runtime_error("Entity does not exist in Rect Transform cache.");
     }
+
+    const TransformCacheValue* TransformCache::FindTransformValue(const uint64_t entity) const {
+        const auto it = m_transform_cache.find(entity);
+        return it == m_transform_cache.end() ? nullptr : &it->second;
+    }
+
+    const RectTransformCacheValue* TransformCache::FindRectTransformValue(const uint64_t entity) const {
+        const auto it = m_rect_transform_cache.find(entity);
+        return it == m_rect_transform_cache.end() ? nullptr : &it->second;
+    }
 } // namespace
@@ -1,4 +1,5 @@
 #pragma once
+#include <span>
 #include <unordered_map>
 #include <glm/fwd.hpp>
 #include <glm/vec3.hpp>
@@ -11,6 +12,13 @@ namespace Engine::Systems::Transform {
         glm::vec3 last_rotation;
         glm::vec3 last_scale;
         uint64_t last_version;
+        /**
+         * The matrix of the transform itself, relative to the parent of the entity.
+         */
+        glm::mat4 local_matrix;
+        /**
+         * The world matrix, equal to the local matrix for entities without a parent.
+         */
         glm::mat4 transform_matrix;
     };
 
@@ -30,23 +38,56 @@ namespace Engine::Systems::Transform {
 
         void RegisterTransformEntity(uint64_t entity);
 
+        /**
+         * Register a batch of entities, growing the cache once for the whole batch.
+         */
+        void RegisterTransformEntities(std::span<const uint64_t> entities);
+
         void RegisterRectTransformEntity(uint64_t entity);
 
         void DeregisterTransformEntity(uint64_t entity);
 
         void DeregisterRectTransformEntity(uint64_t entity);
 
-        bool IsDirty(uint64_t entity, const Components::Transform* transform);
+        /**
+         * Drop all transform entries at once, e.g. after the world was reset.
+         */
+        void ClearTransformEntities();
+
+        /**
+         * Drop all rect transform entries at once, e.g. after the world was reset.
+         */
+        void ClearRectTransformEntities();
 
+        /**
+         * Store the local matrix of a registered entity, which is also its world matrix until a parent is applied.
+         * Only writes the entry of the given entity, so it may be called concurrently for different registered
+         * entities.
+         */
         void SetValue(uint64_t entity, const Components::Transform* transform,
                       const glm::mat4& transform_mat);
 
+        /**
+         * Replace the world matrix of a registered entity, keeping its local matrix.
+         */
+        void SetWorldMatrix(uint64_t entity, const glm::mat4& world_matrix);
+
         void SetValue(uint64_t entity, const RectTransformCacheValue& rect_transform_cache_value);
 
         const TransformCacheValue &GetTransformValue(uint64_t entity);
 
         const RectTransformCacheValue &GetRectTransformValue(uint64_t entity);
 
+        /**
+         * @return The cached value, or nullptr if the entity is not registered
+         */
+        [[nodiscard]] const TransformCacheValue* FindTransformValue(uint64_t entity) const;
+
+        /**
+         * @return The cached value, or nullptr if the entity is not registered
+         */
+        [[nodiscard]] const RectTransformCacheValue* FindRectTransformValue(uint64_t entity) const;
+
     private:
         std::unordered_map<uint64_t, TransformCacheValue> m_transform_cache;
         std::unordered_map<uint64_t, RectTransformCacheValue> m_rect_transform_cache;
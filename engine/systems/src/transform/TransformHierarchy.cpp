@@ -0,0 +1,147 @@
+#include "TransformHierarchy.hpp"
+
+#include <stdexcept>
+
+namespace Engine::Systems::Transform {
+    void TransformHierarchy::SetParent(const uint64_t child, const uint64_t parent) {
+        if (child == parent) {
+            throw std::invalid_argument("TransformHierarchy: Entity can not be its own parent");
+        }
+        // Linking an entity again revives it
+        m_removed.erase(child);
+        m_removed.erase(parent);
+        const auto [it, inserted] = m_parents.try_emplace(child, parent);
+        if (!inserted) {
+            if (it->second == parent) {
+                return;
+            }
+            it->second = parent;
+        }
+        m_relinked.push_back(child);
+        m_order_valid = false;
+    }
+
+    void TransformHierarchy::RemoveParent(const uint64_t child) {
+        if (m_parents.erase(child) == 0) {
+            return;
+        }
+        m_relinked.push_back(child);
+        m_order_valid = false;
+    }
+
+    void TransformHierarchy::RemoveEntity(const uint64_t entity) {
+        // While the order is stale, the entity might be a parent that is not part of the nodes yet
+        if (m_order_valid && !m_node_indices.contains(entity)) {
+            return;
+        }
+        m_parents.erase(entity);
+        m_removed.insert(entity);
+        m_order_valid = false;
+    }
+
+    void TransformHierarchy::MarkDirty(const uint64_t entity) {
+        if (!m_order_valid) {
+            m_marked.push_back(entity);
+            return;
+        }
+        if (const auto it = m_node_indices.find(entity); it != m_node_indices.end()) {
+            m_dirty[it->second] = 1;
+        }
+    }
+
+    void TransformHierarchy::Clear() {
+        m_parents.clear();
+        m_nodes.clear();
+        m_node_indices.clear();
+        m_dirty.clear();
+        m_relinked.clear();
+        m_removed.clear();
+        m_marked.clear();
+        m_order_valid = true;
+    }
+
+    void TransformHierarchy::EnsureOrder() {
+        if (!m_order_valid) {
+            RebuildOrder();
+        }
+    }
+
+    void TransformHierarchy::RebuildOrder() {
+        // Detach the children of all removed entities in a single pass over the links
+        if (!m_removed.empty()) {
+            for (auto it = m_parents.begin(); it != m_parents.end();) {
+                if (m_removed.contains(it->second)) {
+                    m_relinked.push_back(it->first);
+                    it = m_parents.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            std::erase_if(m_relinked, [this](const uint64_t entity) { return m_removed.contains(entity); });
+            m_removed.clear();
+        }
+
+        // Depth of every linked entity, the roots are the parents that have no parent themselves
+        std::unordered_map<uint64_t, uint32_t> depths;
+        depths.reserve(m_parents.size() * 2);
+        std::vector<uint64_t> path;
+        for (const auto& [child, parent]: m_parents) {
+            if (!m_parents.contains(parent)) {
+                depths.try_emplace(parent, 0);
+            }
+        }
+        for (const auto& [child, _]: m_parents) {
+            auto entity = child;
+            path.clear();
+            while (!depths.contains(entity)) {
+                if (path.size() > m_parents.size()) {
+                    throw std::runtime_error("TransformHierarchy: Parent links form a cycle");
+                }
+                path.push_back(entity);
+                entity = m_parents.at(entity);
+            }
+            auto depth = depths.at(entity);
+            for (auto i = path.rbegin(); i != path.rend(); ++i) {
+                depths.emplace(*i, ++depth);
+            }
+        }
+
+        std::vector<std::pair<uint32_t, uint64_t>> order;
+        order.reserve(depths.size());
+        for (const auto& [entity, depth]: depths) {
+            order.emplace_back(depth, entity);
+        }
+        // Sorting by entity within a depth keeps the order independent of the hash map
+        std::ranges::sort(order);
+
+        // Flags of entities marked dirty before the rebuild move with them
+        std::vector<uint8_t> dirty(order.size(), 0);
+        const auto previous_indices = std::move(m_node_indices);
+        m_node_indices.clear();
+        m_node_indices.reserve(order.size());
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            const auto entity = order[i].second;
+            if (const auto it = previous_indices.find(entity); it != previous_indices.end()) {
+                dirty[i] = m_dirty[it->second];
+            }
+            m_node_indices.emplace(entity, i);
+        }
+        m_nodes.clear();
+        m_nodes.reserve(order.size());
+        for (const auto& [depth, entity]: order) {
+            const auto parent = m_parents.find(entity);
+            m_nodes.push_back(Node{
+                .entity = entity,
+                .parent_index = parent == m_parents.end() ? NO_PARENT : m_node_indices.at(parent->second),
+            });
+        }
+        for (const auto entity: m_marked) {
+            if (const auto it = m_node_indices.find(entity); it != m_node_indices.end()) {
+                dirty[it->second] = 1;
+            }
+        }
+        m_marked.clear();
+        m_dirty = std::move(dirty);
+        m_order_valid = true;
+    }
+} // namespace
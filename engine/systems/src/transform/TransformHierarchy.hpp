@@ -0,0 +1,117 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Engine::Systems::Transform {
+    /**
+     * @class TransformHierarchy
+     * @brief The parent links of one kind of transform, kept in depth order.
+     *
+     * Every parent is stored before its children, so world values propagate from the roots to the leaves in a single
+     * linear pass. Only the subtrees below entities marked dirty are visited by the update callback. Link changes,
+     * removals and dirty marks made while the order is stale are only recorded, the order is rebuilt once by the next
+     * propagation.
+     */
+    class TransformHierarchy {
+    public:
+        static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+        struct Node {
+            uint64_t entity;
+            /**
+             * Index of the parent node, NO_PARENT for the roots.
+             */
+            uint32_t parent_index;
+        };
+
+        /**
+         * Attach a child to a parent, replacing its previous parent. The child is updated by the next propagation.
+         * @throws std::invalid_argument if the child is its own parent
+         */
+        void SetParent(uint64_t child, uint64_t parent);
+
+        /**
+         * Detach a child from its parent. It is handed to the next propagation as a root.
+         */
+        void RemoveParent(uint64_t child);
+
+        /**
+         * Drop an entity that lost its transform. Its children are detached by the next propagation and handed to it
+         * as roots.
+         */
+        void RemoveEntity(uint64_t entity);
+
+        [[nodiscard]] bool HasParent(uint64_t entity) const { return m_parents.contains(entity); }
+
+        /**
+         * Mark the value of an entity as changed, so its subtree is updated by the next propagation. Entities outside
+         * of the hierarchy are ignored.
+         */
+        void MarkDirty(uint64_t entity);
+
+        /**
+         * Call update(entity, parent) for every child below a dirty entity and for every entity whose parent
+         * changed, parents first. Entities that were detached from their parent are passed without one.
+         * @throws std::runtime_error if the parent links form a cycle
+         */
+        template<class Fn>
+        void Propagate(Fn&& update);
+
+        void Clear();
+
+    private:
+        std::unordered_map<uint64_t, uint64_t> m_parents;
+        std::vector<Node> m_nodes;
+        std::unordered_map<uint64_t, uint32_t> m_node_indices;
+        std::vector<uint8_t> m_dirty;
+        /**
+         * Entities whose parent changed since the last propagation.
+         */
+        std::vector<uint64_t> m_relinked;
+        /**
+         * Entities removed since the order was built, their children are detached by the next rebuild.
+         */
+        std::unordered_set<uint64_t> m_removed;
+        /**
+         * Entities marked dirty while the order was stale, flagged by the next rebuild.
+         */
+        std::vector<uint64_t> m_marked;
+        bool m_order_valid = true;
+
+        void EnsureOrder();
+
+        void RebuildOrder();
+    };
+
+    template<class Fn>
+    void TransformHierarchy::Propagate(Fn&& update) {
+        EnsureOrder();
+        for (const auto entity: m_relinked) {
+            const auto it = m_node_indices.find(entity);
+            if (it != m_node_indices.end()) {
+                m_dirty[it->second] = 1;
+            }
+            if (it == m_node_indices.end() || m_nodes[it->second].parent_index == NO_PARENT) {
+                update(entity, std::optional<uint64_t>());
+            }
+        }
+        m_relinked.clear();
+
+        for (std::size_t i = 0; i < m_nodes.size(); ++i) {
+            const auto& node = m_nodes[i];
+            if (node.parent_index == NO_PARENT) {
+                continue;
+            }
+            m_dirty[i] |= m_dirty[node.parent_index];
+            if (m_dirty[i]) {
+                update(node.entity, std::optional(m_nodes[node.parent_index].entity));
+            }
+        }
+        std::ranges::fill(m_dirty, 0);
+    }
+} // namespace
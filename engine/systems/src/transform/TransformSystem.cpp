@@ -1,4 +1,5 @@
 #include "TransformSystem.hpp"
+#include <Parent.hpp>
 #include <Transform.hpp>
 #include <glm/ext/matrix_transform.hpp>
 
@@ -8,33 +9,70 @@ namespace Engine::Systems {
     TransformSystem::~TransformSystem() = default;
 
     void TransformSystem::Initialize() {
-        EcsWorld()->GetComponentEventBus()->SubscribeOnComponentAddEvent<Components::Transform>(
-                [this](const Ecs::EntityId entity, const Components::Transform& _) {
+        EcsWorld()->GetComponentEventBus()->SubscribeOnComponentsAddEvent<Components::Transform>(
+                [this](const std::span<const Ecs::EntityId> entities) {
                     if (this->Cache()->GetTransformCache() == nullptr) {
                         throw std::runtime_error("TransformSystem: Transform cache is null");
                     }
-                    this->Cache()->GetTransformCache()->RegisterTransformEntity(entity);
+                    this->Cache()->GetTransformCache()->RegisterTransformEntities(entities);
+                    // Entities that got their parent before their transform
+                    for (const auto entity: entities) {
+                        if (const auto* parent = EcsWorld()->GetComponent<Components::Parent>(entity)) {
+                            m_hierarchy.SetParent(entity, parent->entity);
+                        }
+                    }
                 }
                 );
 
         EcsWorld()->GetComponentEventBus()->SubscribeOnComponentRemoveEvent<Components::Transform>(
                 [this](const Ecs::EntityId entity) {
                     this->Cache()->GetTransformCache()->DeregisterTransformEntity(entity);
+                    m_hierarchy.RemoveEntity(entity);
                 }
                 );
+
+        EcsWorld()->GetComponentEventBus()->SubscribeOnWorldResetEvent([this] {
+            this->Cache()->GetTransformCache()->ClearTransformEntities();
+            m_hierarchy.Clear();
+        });
     }
 
     void TransformSystem::Run(float delta_time) {
-        const auto transform_components = EcsWorld()->GetComponentsOfType<Components::Transform>();
-        for (const auto [transform, entity]: transform_components) {
-            if (!Cache()->GetTransformCache()->IsDirty(entity, transform)) {
-                continue;
-            }
-            auto matrix = CalculateModelMatrix(transform->GetPosition(),
-                                               transform->GetRotation(),
-                                               transform->GetScale()
+        // Only the transforms added or marked as changed since the last run are visited, the static maze tiles are
+        // skipped entirely after their first frame.
+        auto* transform_cache = Cache()->GetTransformCache();
+        SyncHierarchy();
+        for (const auto [transform, entity]: EcsWorld()->Changed<Components::Transform>(LastRunTick())) {
+            const auto matrix = CalculateModelMatrix(transform->GetPosition(),
+                                                     transform->GetRotation(),
+                                                     transform->GetScale()
                     );
-            Cache()->GetTransformCache()->SetValue(entity, transform, matrix);
+            transform_cache->SetValue(entity, transform, matrix);
+            m_hierarchy.MarkDirty(entity);
+        }
+
+        // Parents come first, so the world matrix of the parent is final when its children read it. Children of a
+        // moved parent are updated even if their own transform did not change.
+        m_hierarchy.Propagate([transform_cache](const Ecs::EntityId entity, const std::optional<Ecs::EntityId> parent) {
+            const auto* value = transform_cache->FindTransformValue(entity);
+            if (value == nullptr) {
+                return;
+            }
+            const auto* parent_value = parent.has_value() ? transform_cache->FindTransformValue(*parent) : nullptr;
+            transform_cache->SetWorldMatrix(entity, parent_value == nullptr
+                                                        ? value->local_matrix
+                                                        : parent_value->transform_matrix * value->local_matrix);
+        });
+    }
+
+    void TransformSystem::SyncHierarchy() {
+        for (const auto entity: EcsWorld()->Removed<Components::Parent>(LastRunTick())) {
+            m_hierarchy.RemoveParent(entity);
+        }
+        for (const auto [parent, entity]: EcsWorld()->Changed<Components::Parent>(LastRunTick())) {
+            if (EcsWorld()->HasComponents<Components::Transform>(entity)) {
+                m_hierarchy.SetParent(entity, parent->entity);
+            }
         }
     }
 
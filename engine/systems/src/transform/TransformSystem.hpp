@@ -3,7 +3,9 @@
 #include <glm/glm.hpp>
 
 #include "IEngineSystem.hpp"
-ECS_SYSTEM(TransformSystem, LateUpdate, TAGS(ENGINE), DEPENDENCIES())
+#include "TransformHierarchy.hpp"
+ECS_SYSTEM(TransformSystem, LateUpdate, TAGS(ENGINE), DEPENDENCIES(), READS(Transform, Parent),
+           WRITES(TransformCache))
 
 namespace Engine::Systems {
     class TransformSystem : public Ecs::IEngineSystem {
@@ -17,6 +19,13 @@ namespace Engine::Systems {
         void Run(float delta_time) override;
 
     private:
+        Transform::TransformHierarchy m_hierarchy;
+
+        /**
+         * Apply the Parent components added, changed or removed since the last run to the hierarchy.
+         */
+        void SyncHierarchy();
+
         static glm::mat4 CalculateModelMatrix(glm::vec3 position, glm::vec3 rotation, glm::vec3 scale);
     };
 } // namespace
@@ -34,6 +34,10 @@ namespace Engine::Systems
                 this->m_ui_cache->DeregisterColorElement(entity);
             }
         );
+        EcsWorld()->GetComponentEventBus()->SubscribeOnWorldResetEvent([this]
+        {
+            this->m_ui_cache->ClearColorElements();
+        });
     }
 
     void UiButtonSystem::Run(float delta_time)
@@ -90,8 +94,7 @@ namespace Engine::Systems
 
     void UiButtonSystem::HandleButtons(const Input::InputBuffer& input) const
     {
-        auto buttons_with_entities = EcsWorld()->GetComponentsOfType<Components::UI::Button>();
-        for (auto [button, entity] : buttons_with_entities)
+        for (auto [button, entity] : EcsWorld()->GetComponentView<Components::UI::Button>())
         {
             UiCache::ColorElement cached_button = m_ui_cache->GetColorElement(entity);
             if (!button->enabled)
@@ -113,7 +116,7 @@ namespace Engine::Systems
                 else if (input.HasAction("UiButtonUp"))
                 {
                     const auto command = Commands::UI::ButtonClickedCommand(button->button_id);
-                    EcsWorld()->PushCommand(command);
+                    EcsWorld()->GetCommandBus()->Send(command);
                 }
             }
             m_ui_cache->SetColorElementValue(entity, cached_button);
@@ -37,6 +37,14 @@ namespace Engine::Systems::UI {
         throw std::runtime_error("UI Cache::ButtonEntity was not registered");
     }
 
+    void UiCache::ClearTextElements() {
+        m_text_cache.clear();
+    }
+
+    void UiCache::ClearColorElements() {
+        m_color_element_cache.clear();
+    }
+
     void UiCache::SetTextElementValue(const uint64_t entity, const TextElement text_element) {
         if (m_text_cache.contains(entity)) {
             m_text_cache[entity] = text_element;
@@ -34,6 +34,10 @@ namespace Engine::Systems::UI {
 
         void DeregisterColorElement(uint64_t entity);
 
+        void ClearTextElements();
+
+        void ClearColorElements();
+
         void SetTextElementValue(uint64_t entity, TextElement text_element);
 
         void SetColorElementValue(uint64_t entity, ColorElement color_element);
@@ -36,6 +36,10 @@ namespace Engine::Systems
                  this->m_ui_cache->DeregisterColorElement(entity);
              }
             );
+        EcsWorld()->GetComponentEventBus()->SubscribeOnWorldResetEvent([this]
+        {
+            this->m_ui_cache->ClearColorElements();
+        });
     }
 
     void UiImageSystem::RegisterImageElement(const Ecs::EntityId entity, const glm::vec4 color) const
@@ -69,8 +73,7 @@ namespace Engine::Systems
 
     void UiImageSystem::Run(float delta_time)
     {
-        auto images_with_entities = EcsWorld()->GetComponentsOfType<Components::UI::Image>();
-        for (auto [image, entity] : images_with_entities)
+        for (auto [image, entity] : EcsWorld()->GetComponentView<Components::UI::Image>())
         {
             UiCache::ColorElement color_element = m_ui_cache->GetColorElement(entity);
             color_element.color = image->color;
@@ -34,6 +34,10 @@ namespace Engine::Systems
                  this->m_ui_cache->DeregisterTextElement(entity);
              }
             );
+        EcsWorld()->GetComponentEventBus()->SubscribeOnWorldResetEvent([this]
+        {
+            this->m_ui_cache->ClearTextElements();
+        });
     }
 
     void UiTextSystem::RegisterTextElement(Ecs::EntityId entity) const
@@ -75,8 +79,7 @@ namespace Engine::Systems
 
     void UiTextSystem::HandleTextLabels()
     {
-        auto text_labels = EcsWorld()->GetComponentsOfType<Components::UI::Text>();
-        for (const auto [text, entity] : text_labels)
+        for (const auto [text, entity] : EcsWorld()->GetComponentView<Components::UI::Text>())
         {
             auto text_cache_value = m_ui_cache->GetTextElement(entity);
 
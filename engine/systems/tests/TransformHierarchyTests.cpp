@@ -0,0 +1,166 @@
+#if __APPLE__
+#include <catch2/catch_test_macros.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../src/transform/TransformHierarchy.hpp"
+
+using Engine::Systems::Transform::TransformHierarchy;
+
+namespace {
+    using Update = std::pair<uint64_t, std::optional<uint64_t> >;
+
+    std::vector<Update> Propagate(TransformHierarchy& hierarchy) {
+        std::vector<Update> updates;
+        hierarchy.Propagate([&updates](const uint64_t entity, const std::optional<uint64_t> parent) {
+            updates.emplace_back(entity, parent);
+        });
+        return updates;
+    }
+
+    std::size_t IndexOf(const std::vector<Update>& updates, const uint64_t entity) {
+        for (std::size_t i = 0; i < updates.size(); ++i) {
+            if (updates[i].first == entity) {
+                return i;
+            }
+        }
+        return updates.size();
+    }
+}
+
+TEST_CASE("TransformHierarchy::SetParent - Updates parents before their children", "[systems][fast]") {
+    TransformHierarchy hierarchy;
+    // Linked leaves first, so the order has to come from the depth and not from the calls
+    hierarchy.SetParent(4, 3);
+    hierarchy.SetParent(3, 2);
+    hierarchy.SetParent(2, 1);
+
+    const auto updates = Propagate(hierarchy);
+
+    REQUIRE(updates == std::vector<Update>{{2, 1}, {3, 2}, {4, 3}});
+    REQUIRE(hierarchy.HasParent(4));
+    REQUIRE_FALSE(hierarchy.HasParent(1));
+    REQUIRE(Propagate(hierarchy).empty());
+}
+
+TEST_CASE("TransformHierarchy::SetParent - Relinking moves the subtree below the new parent", "[systems][fast]") {
+    TransformHierarchy hierarchy;
+    hierarchy.SetParent(2, 1);
+    hierarchy.SetParent(3, 2);
+    hierarchy.SetParent(5, 4);
+    Propagate(hierarchy);
+
+    hierarchy.SetParent(2, 5);
+    const auto updates = Propagate(hierarchy);
+
+    REQUIRE(updates == std::vector<Update>{{2, 5}, {3, 2}});
+}
+
+TEST_CASE("TransformHierarchy::RemoveParent - Hands the child to the propagation as a root", "[systems][fast]") {
+    TransformHierarchy hierarchy;
+    hierarchy.SetParent(2, 1);
+    hierarchy.SetParent(3, 2);
+    Propagate(hierarchy);
+
+    hierarchy.RemoveParent(2);
+    const auto updates = Propagate(hierarchy);
+
+    REQUIRE(updates == std::vector<Update>{{2, std::nullopt}, {3, 2}});
+    REQUIRE_FALSE(hierarchy.HasParent(2));
+    REQUIRE(hierarchy.HasParent(3));
+}
+
+TEST_CASE("TransformHierarchy::RemoveEntity - Children of a removed parent become roots", "[systems][fast]") {
+    TransformHierarchy hierarchy;
+    hierarchy.SetParent(2, 1);
+    hierarchy.SetParent(3, 1);
+    hierarchy.SetParent(4, 2);
+    Propagate(hierarchy);
+
+    hierarchy.RemoveEntity(1);
+    hierarchy.RemoveEntity(4);
+    // Removing entities outside of the hierarchy does nothing
+    hierarchy.RemoveEntity(9);
+    const auto updates = Propagate(hierarchy);
+
+    REQUIRE(updates.size() == 2);
+    REQUIRE(IndexOf(updates, 2) < updates.size());
+    REQUIRE(IndexOf(updates, 3) < updates.size());
+    for (const auto& [entity, parent]: updates) {
+        REQUIRE_FALSE(parent.has_value());
+    }
+    REQUIRE_FALSE(hierarchy.HasParent(2));
+    REQUIRE_FALSE(hierarchy.HasParent(3));
+    REQUIRE_FALSE(hierarchy.HasParent(4));
+
+    hierarchy.MarkDirty(2);
+    REQUIRE(Propagate(hierarchy).empty());
+}
+
+TEST_CASE("TransformHierarchy::RemoveEntity - Removing several parents before a propagation", "[systems][fast]") {
+    TransformHierarchy hierarchy;
+    for (uint64_t parent = 1; parent <= 100; ++parent) {
+        hierarchy.SetParent(parent + 1000, parent);
+    }
+    Propagate(hierarchy);
+
+    for (uint64_t parent = 1; parent <= 100; ++parent) {
+        hierarchy.RemoveEntity(parent);
+    }
+    const auto updates = Propagate(hierarchy);
+
+    REQUIRE(updates.size() == 100);
+    for (uint64_t child = 1001; child <= 1100; ++child) {
+        REQUIRE_FALSE(hierarchy.HasParent(child));
+    }
+}
+
+TEST_CASE("TransformHierarchy::MarkDirty - Only visits the subtree of the dirty entity", "[systems][fast]") {
+    TransformHierarchy hierarchy;
+    hierarchy.SetParent(2, 1);
+    hierarchy.SetParent(3, 2);
+    hierarchy.SetParent(4, 1);
+    hierarchy.SetParent(6, 5);
+    Propagate(hierarchy);
+
+    hierarchy.MarkDirty(2);
+    REQUIRE(Propagate(hierarchy) == std::vector<Update>{{2, 1}, {3, 2}});
+
+    hierarchy.MarkDirty(1);
+    const auto updates = Propagate(hierarchy);
+    // Roots are updated by the system itself, only their children are visited
+    REQUIRE(updates.size() == 3);
+    REQUIRE(IndexOf(updates, 2) < IndexOf(updates, 3));
+    REQUIRE(IndexOf(updates, 4) < updates.size());
+    REQUIRE(IndexOf(updates, 6) == updates.size());
+}
+
+TEST_CASE("TransformHierarchy::MarkDirty - Marks made before a rebuild are kept", "[systems][fast]") {
+    TransformHierarchy hierarchy;
+    hierarchy.SetParent(2, 1);
+    hierarchy.SetParent(4, 3);
+    Propagate(hierarchy);
+
+    hierarchy.SetParent(5, 4);
+    hierarchy.MarkDirty(1);
+    const auto updates = Propagate(hierarchy);
+
+    REQUIRE(updates == std::vector<Update>{{2, 1}, {5, 4}});
+}
+
+TEST_CASE("TransformHierarchy::Propagate - Throws if the parent links form a cycle", "[systems][fast]") {
+    TransformHierarchy hierarchy;
+    hierarchy.SetParent(2, 1);
+    hierarchy.SetParent(3, 2);
+    hierarchy.SetParent(1, 3);
+
+    REQUIRE_THROWS_AS(Propagate(hierarchy), std::runtime_error);
+    REQUIRE_THROWS_AS(hierarchy.SetParent(7, 7), std::invalid_argument);
+}
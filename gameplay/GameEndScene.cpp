@@ -1,6 +1,7 @@
 #include "GameEndScene.hpp"
 
 #include "Camera.hpp"
+#include "Parent.hpp"
 #include "../engine/components/Transform.hpp"
 #include "Commands/UI/ButtonClickedCommand.hpp"
 #include "../components/ui/Button.hpp"
@@ -26,16 +27,13 @@ namespace Gameplay {
         std::cout << "Time until level complete: " << m_time_to_completion << std::endl;
     }
 
-    void GameEndScene::EvaluateSystemCommands(const std::vector<std::any>& commands) {
-        for (const std::any& command: commands) {
-            if (command.type() == typeid(Engine::Commands::UI::ButtonClickedCommand)) {
-                auto button_clicked = std::any_cast<Engine::Commands::UI::ButtonClickedCommand>(command);
-                const auto button_id = button_clicked.GetButtonId();
-                if (button_id == m_back_to_main_menu_button_id) {
+    void GameEndScene::SubscribeToCommands() {
+        OnCommand<Engine::Commands::UI::ButtonClickedCommand>(
+            [this](const Engine::Commands::UI::ButtonClickedCommand& button_clicked) {
+                if (button_clicked.GetButtonId() == m_back_to_main_menu_button_id) {
                     SceneManager().LoadScene("MainMenu", Engine::SceneManagement::SceneArgs{});
                 }
-            }
-        }
+            });
     }
 
     void GameEndScene::OnExit() {
@@ -78,28 +76,28 @@ namespace Gameplay {
         const auto heading_transform = Engine::Components::UI::RectTransform()
                 .SetPosition(glm::vec2(0.0f, 300))
                 .SetPivot(glm::vec2(0.5f, 0.0f))
-                .SetAnchor(Engine::Components::UI::Anchor::TopCenter)
-                .SetParent(bg_entity);
+                .SetAnchor(Engine::Components::UI::Anchor::TopCenter);
         const auto heading_text = Engine::Components::UI::Text()
                 .SetText("Congratulations!")
                 .SetFontName("SpaceFont.ttf")
                 .SetFontSize(128.0f);
         World().AddComponent(heading_entity, heading_text);
         World().AddComponent(heading_entity, heading_transform);
+        World().AddComponent(heading_entity, Engine::Components::Parent{bg_entity});
 
 
         const auto sub_heading_entity = World().CreateEntity("SubHeading");
         const auto sub_heading_transform = Engine::Components::UI::RectTransform()
                 .SetPosition(glm::vec2(0.0f, 420.0f))
                 .SetPivot(glm::vec2(0.5f, 0.0f))
-                .SetAnchor(Engine::Components::UI::Anchor::TopCenter)
-                .SetParent(bg_entity);
+                .SetAnchor(Engine::Components::UI::Anchor::TopCenter);
         const auto sub_heading_text = Engine::Components::UI::Text()
                 .SetText("You escaped the maze!")
                 .SetFontName("SpaceFont.ttf")
                 .SetFontSize(48.0f);
         World().AddComponent(sub_heading_entity, sub_heading_text);
         World().AddComponent(sub_heading_entity, sub_heading_transform);
+        World().AddComponent(sub_heading_entity, Engine::Components::Parent{bg_entity});
 
         const float completed_in_seconds = m_time_to_completion / 1000.0f;
         const float minutes = (completed_in_seconds / 60.0f);
@@ -110,14 +108,14 @@ namespace Gameplay {
         const auto time_display_transform = Engine::Components::UI::RectTransform()
                 .SetPosition(glm::vec2(0.0f, 550.0f))
                 .SetPivot(glm::vec2(0.5f, 0.0f))
-                .SetAnchor(Engine::Components::UI::Anchor::TopCenter)
-                .SetParent(bg_entity);
+                .SetAnchor(Engine::Components::UI::Anchor::TopCenter);
         const auto time_display_text = Engine::Components::UI::Text()
                 .SetText(time_needed_str)
                 .SetFontName("SpaceFont.ttf")
                 .SetFontSize(32.0f);
         World().AddComponent(time_display_entity, time_display_text);
         World().AddComponent(time_display_entity, time_display_transform);
+        World().AddComponent(time_display_entity, Engine::Components::Parent{bg_entity});
 
         constexpr auto button_size = glm::vec2(200, 70);
         const auto main_menu_button = World().CreateEntity("MainMenuButton");
@@ -127,9 +125,9 @@ namespace Gameplay {
                 .SetPosition(pos)
                 .SetSize(button_size)
                 .SetPivot(pivot)
-                .SetAnchor(Engine::Components::UI::Anchor::TopCenter)
-                .SetParent(bg_entity);
+                .SetAnchor(Engine::Components::UI::Anchor::TopCenter);
         World().AddComponent(main_menu_button, main_menu_button_rect);
+        World().AddComponent(main_menu_button, Engine::Components::Parent{bg_entity});
 
         auto main_menu = Engine::Components::UI::Button();
         main_menu.button_id = m_back_to_main_menu_button_id;
@@ -144,13 +142,13 @@ namespace Gameplay {
         const auto menu_button_text_transform = Engine::Components::UI::RectTransform()
                 .SetPosition(glm::vec2(0, 10))
                 .SetPivot(glm::vec2(0.5f, 0.0f))
-                .SetAnchor(Engine::Components::UI::Anchor::Center)
-                .SetParent(main_menu_button);
+                .SetAnchor(Engine::Components::UI::Anchor::Center);
         const auto menu_button_text = Engine::Components::UI::Text()
                 .SetText("Main Menu")
                 .SetFontName("SpaceFont.ttf")
                 .SetFontSize(32.0f);
         World().AddComponent(menu_button_text_entity, menu_button_text_transform);
+        World().AddComponent(menu_button_text_entity, Engine::Components::Parent{main_menu_button});
         World().AddComponent(menu_button_text_entity, menu_button_text);
     }
 } // namespace
@@ -6,11 +6,13 @@
 #include "Camera.hpp"
 #include "Collider.hpp"
 #include "GameEndScene.hpp"
+#include "Parent.hpp"
 #include "Rigidbody.hpp"
 #include "commands/LevelFinished.hpp"
 #include "commands/PauseCommand.hpp"
 #include "Commands/UI/ButtonClickedCommand.hpp"
 #include "components/Inventory.hpp"
+#include "resources/Player.hpp"
 #include "ui/Button.hpp"
 #include "ui/Image.hpp"
 #include "ui/RectTransform.hpp"
@@ -40,36 +42,31 @@ namespace Gameplay
         m_start_time = std::chrono::steady_clock::now();
     }
 
-    void GameScene::EvaluateSystemCommands(const std::vector<std::any>& commands)
+    void GameScene::SubscribeToCommands()
     {
-        for (const auto& command : commands)
+        OnCommand<Commands::PauseCommand>([this](const Commands::PauseCommand& pause_command)
         {
-            if (command.type() == typeid(Commands::PauseCommand))
-            {
-                auto pause_command = std::any_cast<Commands::PauseCommand>(command);
-                std::cout << "Enable Pause: " << (pause_command.IsPaused() ? "true" : "false") << std::endl;
-                pause_command.IsPaused() ? Pause() : Resume();
-                continue;
-            }
-            if (command.type() == typeid(Commands::LevelFinished))
-            {
-                const auto end_time = std::chrono::steady_clock::now();
-                const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - m_start_time).
-                    count();
-                m_time_passed += duration;
-
-                SceneManager().LoadScene("GameEnd",
-                                         Engine::SceneManagement::SceneArgs{
-                                             .payload = GameEndShowData{
-                                                 .time_to_completion = m_time_passed,
-                                             }
+            std::cout << "Enable Pause: " << (pause_command.IsPaused() ? "true" : "false") << std::endl;
+            pause_command.IsPaused() ? Pause() : Resume();
+        });
+        OnCommand<Commands::LevelFinished>([this](const Commands::LevelFinished&)
+        {
+            const auto end_time = std::chrono::steady_clock::now();
+            const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - m_start_time).
+                count();
+            m_time_passed += duration;
+
+            SceneManager().LoadScene("GameEnd",
+                                     Engine::SceneManagement::SceneArgs{
+                                         .payload = GameEndShowData{
+                                             .time_to_completion = m_time_passed,
                                          }
-                );
-                continue;
-            }
-            if (command.type() == typeid(Engine::Commands::UI::ButtonClickedCommand))
+                                     }
+            );
+        });
+        OnCommand<Engine::Commands::UI::ButtonClickedCommand>(
+            [this](const Engine::Commands::UI::ButtonClickedCommand& button_clicked)
             {
-                auto button_clicked = std::any_cast<Engine::Commands::UI::ButtonClickedCommand>(command);
                 const auto button_id = button_clicked.GetButtonId();
                 if (button_id == 1)
                 {
@@ -83,8 +80,7 @@ namespace Gameplay
                 {
                     Application().Quit();
                 }
-            }
-        }
+            });
     }
 
     void GameScene::OnExit()
@@ -186,6 +182,8 @@ namespace Gameplay
 
         constexpr auto inventory = Components::Inventory();
         World().AddComponent(player, inventory);
+
+        World().SetResource(Resources::Player{player});
     }
 
     void GameScene::CreateIngameUiOverlay() const
@@ -226,13 +224,13 @@ namespace Gameplay
         const auto heading_transform = Engine::Components::UI::RectTransform()
                                        .SetPosition(glm::vec2(0.0f, 300.0f))
                                        .SetPivot(glm::vec2(0.5f, 0.5f))
-                                       .SetAnchor(Engine::Components::UI::Anchor::TopCenter)
-                                       .SetParent(pause_entity);
+                                       .SetAnchor(Engine::Components::UI::Anchor::TopCenter);
         const auto heading_text = Engine::Components::UI::Text()
                                   .SetText("Pause")
                                   .SetFontName("SpaceFont.ttf")
                                   .SetFontSize(128.0f);
         World().AddComponent(heading_entity, heading_transform);
+        World().AddComponent(heading_entity, Engine::Components::Parent{pause_entity});
         World().AddComponent(heading_entity, heading_text);
         m_pause_entities.push_back(heading_entity);
 
@@ -251,8 +249,7 @@ namespace Gameplay
                            .SetPosition(position)
                            .SetSize(size)
                            .SetPivot(pivot)
-                           .SetAnchor(Engine::Components::UI::Anchor::TopCenter)
-                           .SetParent(parent_entity);
+                           .SetAnchor(Engine::Components::UI::Anchor::TopCenter);
 
         auto button = Engine::Components::UI::Button();
         button.button_id = button_id;
@@ -264,19 +261,20 @@ namespace Gameplay
 
         World().AddComponent(button_entity, button);
         World().AddComponent(button_entity, button_rect);
+        World().AddComponent(button_entity, Engine::Components::Parent{parent_entity});
 
         const auto button_text_entity = World().CreateEntity(content + "ButtonText");
         auto button_text_rect = Engine::Components::UI::RectTransform()
                                 .SetPosition(glm::vec2(0, 10))
                                 .SetPivot(glm::vec2(0.5f, 0.0f))
-                                .SetAnchor(Engine::Components::UI::Anchor::Center)
-                                .SetParent(button_entity);
+                                .SetAnchor(Engine::Components::UI::Anchor::Center);
         auto button_text = Engine::Components::UI::Text()
                            .SetText(content)
                            .SetFontName("SpaceFont.ttf")
                            .SetFontSize(32);
 
         World().AddComponent(button_text_entity, button_text_rect);
+        World().AddComponent(button_text_entity, Engine::Components::Parent{button_entity});
         World().AddComponent(button_text_entity, button_text);
 
         m_pause_entities.push_back(button_entity);
@@ -24,7 +24,7 @@ namespace Gameplay {
 
         void OnStart() override;
 
-        void EvaluateSystemCommands(const std::vector<std::any>& commands) override;
+        void SubscribeToCommands() override;
 
         void OnExit() override;
 
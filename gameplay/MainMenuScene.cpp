@@ -1,6 +1,7 @@
 #include "MainMenuScene.hpp"
 
 #include "Camera.hpp"
+#include "Parent.hpp"
 #include "GameScene.hpp"
 #include "Commands/UI/ButtonClickedCommand.hpp"
 #include "ui/Button.hpp"
@@ -29,13 +30,11 @@ namespace Gameplay
         SwitchUiElements(MenuState::Main);
     }
 
-    void MainMenuScene::EvaluateSystemCommands(const std::vector<std::any>& commands)
+    void MainMenuScene::SubscribeToCommands()
     {
-        for (const std::any& command : commands)
-        {
-            if (command.type() == typeid(Engine::Commands::UI::ButtonClickedCommand))
+        OnCommand<Engine::Commands::UI::ButtonClickedCommand>(
+            [this](const Engine::Commands::UI::ButtonClickedCommand& button_clicked)
             {
-                auto button_clicked = std::any_cast<Engine::Commands::UI::ButtonClickedCommand>(command);
                 const auto button_id = button_clicked.GetButtonId();
                 switch (m_menu_state)
                 {
@@ -46,8 +45,7 @@ namespace Gameplay
                         EvaluateDifficultyUiElementCommands(button_id);
                         break;
                 }
-            }
-        }
+            });
     }
 
     void MainMenuScene::OnExit()
@@ -122,13 +120,13 @@ namespace Gameplay
                                     .SetPosition(pos)
                                     .SetSize(size)
                                     .SetAnchor(Engine::Components::UI::Anchor::Center)
-                                    .SetPivot(glm::vec2{0.5f, 0.0f})
-                                    .SetParent(parent_entity);
+                                    .SetPivot(glm::vec2{0.5f, 0.0f});
         const auto text = Engine::Components::UI::Text()
                           .SetText(content)
                           .SetFontName(font_name)
                           .SetFontSize(font_size);
         World().AddComponent(text_entity, text_transform);
+        World().AddComponent(text_entity, Engine::Components::Parent{parent_entity});
         World().AddComponent(text_entity, text);
         m_active_state_entities.push_back(text_entity);
         return text_entity;
@@ -145,9 +143,9 @@ namespace Gameplay
                            .SetPosition(pos)
                            .SetSize(button_size)
                            .SetPivot(pivot)
-                           .SetAnchor(Engine::Components::UI::Anchor::Center)
-                           .SetParent(parent_entity);
+                           .SetAnchor(Engine::Components::UI::Anchor::Center);
         World().AddComponent(button_entity, resume_rect);
+        World().AddComponent(button_entity, Engine::Components::Parent{parent_entity});
 
         auto button = Engine::Components::UI::Button();
         button.button_id = button_id;
@@ -1,10 +1,5 @@
 #include "MazeBuilder.hpp"
 
-#include <format>
-
-#include "Collider.hpp"
-#include "MeshRenderer.hpp"
-#include "Transform.hpp"
 #include "../components/Door.hpp"
 #include "../components/DoorTrigger.hpp"
 #include "../components/Exit.hpp"
@@ -34,6 +29,34 @@ namespace Gameplay::Mazegenerator {
         m_wall_material = m_assets->LoadMaterial("wall.material");
         m_ceiling_material = m_assets->LoadMaterial("ceiling.material");
         m_door_material = m_assets->LoadMaterial("door.material");
+        CreateTilePrefabs();
+    }
+
+    void MazeBuilder::CreateTilePrefabs() {
+        // The transforms are set per tile, the prefabs only hold what the tiles share
+        m_floor_prefab.With(Engine::Components::MeshRenderer{
+                    .Mesh = m_floor_mesh,
+                    .Material = m_default_material,
+                })
+                .With(Engine::Components::Transform());
+
+        m_ceiling_prefab.With(Engine::Components::MeshRenderer{
+                    .Mesh = m_ceiling_mesh,
+                    .Material = m_ceiling_material,
+                })
+                .With(Engine::Components::Transform());
+
+        m_wall_prefab.With(Engine::Components::MeshRenderer{
+                    .Mesh = m_wall_mesh,
+                    .Material = m_wall_material,
+                })
+                .With(Engine::Components::Transform())
+                .With(Engine::Components::BoxCollider{
+                    .is_static = true,
+                    .width = 2.0f,
+                    .height = 2.0f,
+                    .depth = 1e-6f
+                });
     }
 
     void MazeBuilder::BuildMaze(int width, int height, int seed) {
@@ -54,38 +77,49 @@ namespace Gameplay::Mazegenerator {
 
 
     void MazeBuilder::CreateCellObjects() const {
-        const auto maze_cells = m_maze.cells;
-        for (const auto& cell: maze_cells) {
+        // Tiles are anonymous and collected per prefab first, so each prefab is instantiated once for all of its
+        // tiles instead of a named entity and single component events per tile.
+        MazeTiles tiles;
+        const auto cell_count = m_maze.cells.size();
+        tiles.floors.meshes.reserve(cell_count);
+        tiles.floors.transforms.reserve(cell_count);
+        tiles.ceilings.transforms.reserve(cell_count);
+
+        for (const auto& cell: m_maze.cells) {
             if (cell.cell_index == m_maze.exit_cell) {
-                CreateExitCell(cell);
+                CreateExitCell(cell, tiles);
                 continue;
             }
 
-            CreateMazeCell(cell);
+            CreateMazeCell(cell, tiles);
         }
+
+        SpawnTileBatch(m_floor_prefab, tiles.floors);
+        SpawnTileBatch(m_ceiling_prefab, tiles.ceilings);
+        SpawnTileBatch(m_wall_prefab, tiles.walls);
     }
 
-    void MazeBuilder::CreateExitCell(const Cell& exit_cell) const {
-        CreateCellFloorTile(exit_cell.cell_index, m_exit_material);
-        CreateCeilingTile(exit_cell.cell_index);
+    void MazeBuilder::CreateExitCell(const Cell& exit_cell, MazeTiles& tiles) const {
+        CreateCellFloorTile(exit_cell.cell_index, m_exit_material, tiles.floors);
+        CreateCeilingTile(exit_cell.cell_index, tiles.ceilings);
 
         if (exit_cell.HasWall(Front)) {
-            CreateWallTile(exit_cell.cell_index, Front);
+            CreateWallTile(exit_cell.cell_index, Front, tiles.walls);
         } else {
             CreateDoorTile(exit_cell.cell_index, Front);
         }
         if (exit_cell.HasWall(Back)) {
-            CreateWallTile(exit_cell.cell_index, Back);
+            CreateWallTile(exit_cell.cell_index, Back, tiles.walls);
         } else {
             CreateDoorTile(exit_cell.cell_index, Back);
         }
         if (exit_cell.HasWall(Left)) {
-            CreateWallTile(exit_cell.cell_index, Left);
+            CreateWallTile(exit_cell.cell_index, Left, tiles.walls);
         } else {
             CreateDoorTile(exit_cell.cell_index, Left);
         }
         if (exit_cell.HasWall(Right)) {
-            CreateWallTile(exit_cell.cell_index, Right);
+            CreateWallTile(exit_cell.cell_index, Right, tiles.walls);
         } else {
             CreateDoorTile(exit_cell.cell_index, Right);
         }
@@ -143,40 +177,49 @@ namespace Gameplay::Mazegenerator {
     }
 
 
-    void MazeBuilder::CreateMazeCell(const Cell& cell) const {
+    void MazeBuilder::CreateMazeCell(const Cell& cell, MazeTiles& tiles) const {
         const auto tile_material = DetermineFloorMaterialForCell(cell.cell_index);
-        CreateCellFloorTile(cell.cell_index, tile_material);
-        CreateCeilingTile(cell.cell_index);
+        CreateCellFloorTile(cell.cell_index, tile_material, tiles.floors);
+        CreateCeilingTile(cell.cell_index, tiles.ceilings);
 
         if (cell.HasWall(Front)) {
-            CreateWallTile(cell.cell_index, Front);
+            CreateWallTile(cell.cell_index, Front, tiles.walls);
         }
         if (cell.HasWall(Back)) {
-            CreateWallTile(cell.cell_index, Back);
+            CreateWallTile(cell.cell_index, Back, tiles.walls);
         }
         if (cell.HasWall(Left)) {
-            CreateWallTile(cell.cell_index, Left);
+            CreateWallTile(cell.cell_index, Left, tiles.walls);
         }
         if (cell.HasWall(Right)) {
-            CreateWallTile(cell.cell_index, Right);
+            CreateWallTile(cell.cell_index, Right, tiles.walls);
         }
     }
 
     void MazeBuilder::CreateCellFloorTile(
             const CellIndex& cell_idx,
-            Engine::Assets::MaterialHandle material) const {
-        const auto entity = m_game_world->CreateEntity(std::format("FloorTile [{}|{}]", cell_idx.x, cell_idx.y));
-        const auto mesh_component = Engine::Components::MeshRenderer{
+            Engine::Assets::MaterialHandle material,
+            TileBatch& floors) const {
+        floors.meshes.push_back(Engine::Components::MeshRenderer{
             .Mesh = m_floor_mesh,
             .Material = material,
-        };
-        m_game_world->AddComponent(entity, mesh_component);
+        });
         const auto position = glm::vec3(cell_idx.x * 2, 0.0f, cell_idx.y * 2);
         constexpr auto rotation = glm::vec3(0.0f, 0.0f, 0.0f);
-        const auto transform_component = Engine::Components::Transform()
+        floors.transforms.push_back(Engine::Components::Transform()
                 .SetPosition(position)
-                .SetRotation(rotation);
-        m_game_world->AddComponent(entity, transform_component);
+                .SetRotation(rotation));
+    }
+
+    void MazeBuilder::SpawnTileBatch(const Engine::Ecs::Prefab& prefab, const TileBatch& batch) const {
+        Engine::Ecs::PrefabOverrides overrides;
+        overrides.Set<Engine::Components::Transform>(batch.transforms);
+        if (!batch.meshes.empty()) {
+            overrides.Set<Engine::Components::MeshRenderer>(batch.meshes);
+        }
+
+        std::vector<Engine::Ecs::EntityId> entities(batch.transforms.size());
+        m_game_world->Instantiate(prefab, entities.size(), entities, overrides);
     }
 
     void MazeBuilder::GetShiftAndRotationVectorFromDirection(const Direction& direction, glm::vec3& shift_vector,
@@ -204,37 +247,19 @@ namespace Gameplay::Mazegenerator {
     }
 
     void MazeBuilder::CreateWallTile(const CellIndex& cell_idx,
-                                     const Direction& direction) const {
-        const auto entity = m_game_world->CreateEntity(
-                std::format("WallTile [{}|{}]-{}", cell_idx.x, cell_idx.y, static_cast<int>(direction))
-                );
-
+                                     const Direction& direction,
+                                     TileBatch& walls) const {
         glm::vec3 shift_vector;
         glm::vec3 rotation_shift;
         GetShiftAndRotationVectorFromDirection(direction, shift_vector, rotation_shift);
 
-        const auto mesh_component = Engine::Components::MeshRenderer{
-            .Mesh = m_wall_mesh,
-            .Material = m_wall_material,
-        };
-
-        m_game_world->AddComponent(entity, mesh_component);
         const auto position = glm::vec3(cell_idx.x * 2, 0.0f, cell_idx.y * 2) + shift_vector;
         const auto rotation = glm::vec3(0.0f, 0.0f, 0.0f) + rotation_shift;
         const auto scale = glm::vec3(0.5f, 0.5f, 0.5f);
-        const auto transform_component = Engine::Components::Transform()
+        walls.transforms.push_back(Engine::Components::Transform()
                 .SetPosition(position)
                 .SetRotation(rotation)
-                .SetScale(scale);
-        m_game_world->AddComponent(entity, transform_component);
-
-        constexpr auto collider = Engine::Components::BoxCollider{
-            .is_static = true,
-            .width = 2.0f,
-            .height = 2.0f,
-            .depth = 1e-6f
-        };
-        m_game_world->AddComponent(entity, collider);
+                .SetScale(scale));
     }
 
     void MazeBuilder::CreateDoorTile(const CellIndex& cell_idx, const Direction& direction) const {
@@ -246,12 +271,8 @@ namespace Gameplay::Mazegenerator {
         const auto scale = glm::vec3(0.5f, 0.5f, 0.5f);
 
 
-        const auto frame_entity = m_game_world->CreateEntity(
-                std::format("DoorFrame [{}|{}]-{}", cell_idx.x, cell_idx.y, static_cast<int>(direction))
-                );
-        const auto door_entity = m_game_world->CreateEntity(
-                std::format("Door [{}|{}]-{}", cell_idx.x, cell_idx.y, static_cast<int>(direction))
-                );
+        const auto frame_entity = m_game_world->CreateEntity();
+        const auto door_entity = m_game_world->CreateEntity();
         const auto frame_mesh_component = Engine::Components::MeshRenderer{
             .Mesh = m_door_frame,
             .Material = m_door_material,
@@ -295,21 +316,14 @@ namespace Gameplay::Mazegenerator {
     }
 
 
-    void MazeBuilder::CreateCeilingTile(const CellIndex& cell_idx) const {
-        const auto entity = m_game_world->CreateEntity(std::format("CeilingTile [{}|{}]", cell_idx.x, cell_idx.y));
-        const auto mesh_component = Engine::Components::MeshRenderer{
-            .Mesh = m_ceiling_mesh,
-            .Material = m_ceiling_material,
-        };
-        m_game_world->AddComponent(entity, mesh_component);
+    void MazeBuilder::CreateCeilingTile(const CellIndex& cell_idx, TileBatch& ceilings) const {
         const auto position = glm::vec3(cell_idx.x * 2, 2.0f, cell_idx.y * 2);
         constexpr auto rotation = glm::vec3(180.0f, 0.0f, 0.0f);
         constexpr auto scale = glm::vec3(0.5f, 1.0f, 0.5f);
-        const auto transform_component = Engine::Components::Transform()
+        ceilings.transforms.push_back(Engine::Components::Transform()
                 .SetPosition(position)
                 .SetRotation(rotation)
-                .SetScale(scale);
-        m_game_world->AddComponent(entity, transform_component);
+                .SetScale(scale));
     }
 
     Engine::Assets::MaterialHandle MazeBuilder::DetermineFloorMaterialForCell(const CellIndex& cell_idx) const {
@@ -1,7 +1,12 @@
 #pragma once
+#include <vector>
+
+#include "Collider.hpp"
 #include "DebugGridDrawer.hpp"
 #include "MazeAlgorithm.hpp"
+#include "MeshRenderer.hpp"
 #include "SceneWorld.hpp"
+#include "Transform.hpp"
 #include "Assets/AssetHandleTypes.hpp"
 #include <glm/glm.hpp>
 
@@ -20,6 +25,21 @@ namespace Gameplay::Mazegenerator {
         glm::vec3 GetMazeStartPosition() const;
 
     private:
+        /**
+         * Per tile components of tiles spawned from the same prefab. Meshes are optional and either empty or one per
+         * tile, they override the mesh of the prefab.
+         */
+        struct TileBatch {
+            std::vector<Engine::Components::MeshRenderer> meshes;
+            std::vector<Engine::Components::Transform> transforms;
+        };
+
+        struct MazeTiles {
+            TileBatch floors;
+            TileBatch ceilings;
+            TileBatch walls;
+        };
+
         Engine::SceneManagement::SceneWorld* m_game_world;
         Engine::Assets::IAssetLibrary* m_assets;
         std::unique_ptr<MazeAlgorithm> m_maze_algorithm;
@@ -38,26 +58,34 @@ namespace Gameplay::Mazegenerator {
         Engine::Assets::MaterialHandle m_wall_material;
         Engine::Assets::MaterialHandle m_ceiling_material;
         Engine::Assets::MaterialHandle m_door_material;
+        Engine::Ecs::Prefab m_floor_prefab;
+        Engine::Ecs::Prefab m_ceiling_prefab;
+        Engine::Ecs::Prefab m_wall_prefab;
 
-        void CreateCellFloorTile(const CellIndex& cell_idx, Engine::Assets::MaterialHandle material) const;
+        void CreateTilePrefabs();
 
-        void CreateWallTile(const CellIndex& cell_idx, const Direction& direction) const;
+        void CreateCellFloorTile(const CellIndex& cell_idx, Engine::Assets::MaterialHandle material,
+                                 TileBatch& floors) const;
+
+        void CreateWallTile(const CellIndex& cell_idx, const Direction& direction, TileBatch& walls) const;
 
         void CreateDoorTile(const CellIndex& cell_idx, const Direction& direction) const;
 
-        void CreateCeilingTile(const CellIndex& cell_idx) const;
+        void CreateCeilingTile(const CellIndex& cell_idx, TileBatch& ceilings) const;
+
+        void SpawnTileBatch(const Engine::Ecs::Prefab& prefab, const TileBatch& batch) const;
 
         [[nodiscard]] Engine::Assets::MaterialHandle DetermineFloorMaterialForCell(const CellIndex& cell_idx) const;
 
         void CreateCellObjects() const;
 
-        void CreateExitCell(const Cell& exit_cell) const;
+        void CreateExitCell(const Cell& exit_cell, MazeTiles& tiles) const;
 
         void CreateKeyObject(const CellIndex& cell_index) const;
 
         void CreateExitTrigger(const CellIndex& cell_index) const;
 
-        void CreateMazeCell(const Cell& cell) const;
+        void CreateMazeCell(const Cell& cell, MazeTiles& tiles) const;
 
         static void GetShiftAndRotationVectorFromDirection(const Direction& direction, glm::vec3& shift_vector,
                                                            glm::vec3& rotation_shift);
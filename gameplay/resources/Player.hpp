@@ -0,0 +1,11 @@
+#pragma once
+#include "Ecs/Types.hpp"
+
+namespace Gameplay::Resources {
+    /**
+     * World resource naming the player entity, set by the GameScene when it spawns the player.
+     */
+    struct Player {
+        Engine::Ecs::EntityId entity;
+    };
+}
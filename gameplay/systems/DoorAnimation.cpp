@@ -5,6 +5,7 @@
 namespace Gameplay::Systems {
     void DoorAnimation::Initialize() {
         ISystem::Initialize();
+        m_doors = GameWorld()->RegisterQuery<Components::Door, Engine::Components::Transform>();
     }
 
     void DoorAnimation::OnTriggerEnter(const Engine::Ecs::EntityId& target, const Engine::Ecs::EntityId& other) {
@@ -12,7 +13,7 @@ namespace Gameplay::Systems {
     }
 
     void DoorAnimation::OnTriggerExit(const Engine::Ecs::EntityId& target, const Engine::Ecs::EntityId& other) {
-        const auto is_player = GameWorld()->GetComponent<Components::Inventory>(target) != nullptr;
+        const auto is_player = GameWorld()->HasComponents<Components::Inventory>(target);
         const auto door_trigger = GameWorld()->GetComponent<Components::DoorTrigger>(other);
         if (!is_player || door_trigger == nullptr) {
             return;
@@ -25,28 +26,23 @@ namespace Gameplay::Systems {
     }
 
     void DoorAnimation::Run(float delta_time) {
-        auto doors = GameWorld()->GetComponentsOfType<Components::Door>();
-        for (const auto [door, entity]: doors) {
-            auto door_transform = GameWorld()->GetComponent<Engine::Components::Transform>(entity);
-            if (door_transform == nullptr) {
-                throw std::runtime_error("Door does not have a door transform");
-            }
-
-            auto door_position = door_transform->GetPosition();
-            switch (door->CurrentState) {
+        for (auto [entity, door, door_transform]: m_doors) {
+            auto door_position = door_transform.GetPosition();
+            switch (door.CurrentState) {
                 case Components::Door::State::Opening:
                     if (door_position.y > m_door_open_position) {
-                        door->CurrentState = Components::Door::State::Opened;
+                        door.CurrentState = Components::Door::State::Opened;
                     }
                     door_position += glm::vec3(0, 1, 0) * delta_time * m_door_open_speed;
-                    door_transform->SetPosition(door_position);
+                    door_transform.SetPosition(door_position);
+                    GameWorld()->MarkChanged<Engine::Components::Transform>(entity);
                     break;
                 case Components::Door::State::Closing:
                     if (door_position.y < m_door_close_position) {
-                        door->CurrentState = Components::Door::State::Closed;
+                        door.CurrentState = Components::Door::State::Closed;
                     }
 
-                    if (GameWorld()->GetComponent<Engine::Components::BoxCollider>(entity) == nullptr) {
+                    if (!GameWorld()->HasComponents<Engine::Components::BoxCollider>(entity)) {
                         GameWorld()->AddComponent<Engine::Components::BoxCollider>(
                                 entity,
                                 m_disabled_box_colliders[entity]
@@ -55,7 +51,8 @@ namespace Gameplay::Systems {
                     }
 
                     door_position += glm::vec3(0, -1, 0) * delta_time * m_door_open_speed;
-                    door_transform->SetPosition(door_position);
+                    door_transform.SetPosition(door_position);
+                    GameWorld()->MarkChanged<Engine::Components::Transform>(entity);
                     break;
                 case Components::Door::State::Opened: {
                     const auto box_collider = GameWorld()->GetComponent<Engine::Components::BoxCollider>(entity);
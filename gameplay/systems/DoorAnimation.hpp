@@ -1,12 +1,13 @@
 #pragma once
 #include "Collider.hpp"
 #include "SystemManager.hpp"
+#include "Transform.hpp"
 #include "../components/Inventory.hpp"
 #include "../components/Door.hpp"
 #include "../components/DoorTrigger.hpp"
 
 namespace Gameplay::Systems {
-    ECS_SYSTEM(DoorAnimation, Update, TAGS(), DEPENDENCIES())
+    ECS_SYSTEM(DoorAnimation, Update, TAGS(), DEPENDENCIES(), READS(), WRITES(Door, Transform, BoxCollider))
     class DoorAnimation : public Engine::Ecs::ISystem {
     public:
         DoorAnimation() = default;
@@ -22,6 +23,7 @@ namespace Gameplay::Systems {
         void OnTriggerExit(const Engine::Ecs::EntityId& target, const Engine::Ecs::EntityId& other) override;
 
     private:
+        Engine::Ecs::Query<Engine::Ecs::Exclude<>, Components::Door, Engine::Components::Transform> m_doors;
         bool m_key_item_detected = false;
 
         float m_door_open_speed = 0.5f;
@@ -3,7 +3,7 @@
 #include "Ecs/Types.hpp"
 
 namespace Gameplay::Systems {
-    ECS_SYSTEM(ExitSystem, Update, TAGS(), DEPENDENCIES())
+    ECS_SYSTEM(ExitSystem, Update, TAGS(), DEPENDENCIES(), READS(), WRITES())
 
     class ExitSystem final : public Engine::Ecs::ISystem {
     public:
@@ -3,10 +3,13 @@
 #include "../components/KeyItem.hpp"
 #include "../components/ui/Image.hpp"
 
+using namespace Engine::Ecs::Literals;
+
 namespace Gameplay::Systems {
     ItemSystem::ItemSystem() = default;
 
     void ItemSystem::Initialize() {
+        m_key_indicator = Engine::Ecs::NamedEntity("KeyIndicator"_name);
     }
 
     void ItemSystem::Run(float delta_time) {
@@ -17,14 +20,14 @@ namespace Gameplay::Systems {
     }
 
     void ItemSystem::CheckIfItemGotPickedUp(const Engine::Ecs::EntityId target_entity,
-                                            const Engine::Ecs::EntityId potential_item_entity) const {
+                                            const Engine::Ecs::EntityId potential_item_entity) {
         const auto player_inventory = GameWorld()->GetComponent<Components::Inventory>(target_entity);
-        const auto is_key_item = GameWorld()->GetComponent<Components::KeyItem>(potential_item_entity) != nullptr;
+        const auto is_key_item = GameWorld()->HasComponents<Components::KeyItem>(potential_item_entity);
 
         if (player_inventory != nullptr && is_key_item) {
             player_inventory->key_collected = true;
             GameWorld()->DestroyEntity(potential_item_entity);
-            const auto ui_entity = GameWorld()->GetEntityByName("KeyIndicator");
+            const auto ui_entity = GameWorld()->Resolve(m_key_indicator);
             if (ui_entity == Engine::Ecs::INVALID_ENTITY_ID) {
                 return;
             }
@@ -1,8 +1,9 @@
 #pragma once
+#include "NamedEntity.hpp"
 #include "SystemManager.hpp"
 
 namespace Gameplay::Systems {
-    ECS_SYSTEM(ItemSystem, Update, TAGS(), DEPENDENCIES())
+    ECS_SYSTEM(ItemSystem, Update, TAGS(), DEPENDENCIES(), READS(), WRITES())
 
     class ItemSystem : public Engine::Ecs::ISystem {
     public:
@@ -17,7 +18,9 @@ namespace Gameplay::Systems {
         void OnCollisionEnter(const Engine::Ecs::EntityId& target, const Engine::Ecs::EntityId& other) override;
 
     private:
+        Engine::Ecs::NamedEntity m_key_indicator;
+
         void CheckIfItemGotPickedUp(Engine::Ecs::EntityId target_entity,
-                                    Engine::Ecs::EntityId potential_item_entity) const;
+                                    Engine::Ecs::EntityId potential_item_entity);
     };
 } // namespace
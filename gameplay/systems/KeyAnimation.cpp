@@ -1,23 +1,19 @@
 #include "KeyAnimation.hpp"
 
 #include "SystemWorld.hpp"
-#include "Transform.hpp"
-#include "../components/KeyItem.hpp"
 
 namespace Gameplay::Systems {
     void KeyAnimation::Initialize() {
+        m_keys = GameWorld()->RegisterQuery<const Components::KeyItem, Engine::Components::Transform>();
     }
 
     void KeyAnimation::Run(float delta_time) {
-        auto entities = GameWorld()->GetComponentsOfType<Components::KeyItem>();
-        for (const auto entityId: entities | std::views::values) {
-            const auto transform = GameWorld()->GetComponent<Engine::Components::Transform>(entityId);
-
-            auto rotation = transform->GetRotation();
+        for (auto [entity, key_item, transform]: m_keys) {
+            auto rotation = transform.GetRotation();
             rotation.y += 10 * delta_time * m_rotation_speed;
-            transform->SetRotation(rotation);
+            transform.SetRotation(rotation);
 
-            auto position = transform->GetPosition();
+            auto position = transform.GetPosition();
             if (position.y > m_max_height && goes_up) {
                 goes_up = false;
                 hover_direction *= -1.0f;
@@ -28,7 +24,8 @@ namespace Gameplay::Systems {
             }
 
             position += hover_direction * delta_time * m_hover_speed;
-            transform->SetPosition(position);
+            transform.SetPosition(position);
+            GameWorld()->MarkChanged<Engine::Components::Transform>(entity);
         }
     }
 } // namespace
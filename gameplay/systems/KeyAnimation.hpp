@@ -1,10 +1,13 @@
 #pragma once
 #include <glm/vec3.hpp>
 
+#include "SystemWorld.hpp"
 #include "Ecs/ISystem.hpp"
+#include "Transform.hpp"
+#include "../components/KeyItem.hpp"
 
 namespace Gameplay::Systems {
-    ECS_SYSTEM(KeyAnimation, Update, TAGS(), DEPENDENCIES())
+    ECS_SYSTEM(KeyAnimation, Update, TAGS(), DEPENDENCIES(), READS(KeyItem), WRITES(Transform))
 
     class KeyAnimation : public Engine::Ecs::ISystem {
     public:
@@ -17,6 +20,8 @@ namespace Gameplay::Systems {
         void Run(float delta_time) override;
 
     private:
+        Engine::Ecs::Query<Engine::Ecs::Exclude<>, const Components::KeyItem, Engine::Components::Transform> m_keys;
+
         float m_rotation_speed = 5.0f;
         float m_hover_speed = 0.08f;
 
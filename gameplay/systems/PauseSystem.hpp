@@ -2,7 +2,7 @@
 #include "IEngineSystem.hpp"
 
 namespace Gameplay::Systems {
-    ECS_SYSTEM(PauseSystem, Update, TAGS(), DEPENDENCIES())
+    ECS_SYSTEM(PauseSystem, Update, TAGS(), DEPENDENCIES(), READS(), WRITES())
 
     class PauseSystem : public Engine::Ecs::ISystem {
     public:
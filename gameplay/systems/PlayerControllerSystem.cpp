@@ -7,6 +7,7 @@
 #include "SystemWorld.hpp"
 #include "Transform.hpp"
 #include "../commands/PauseCommand.hpp"
+#include "../resources/Player.hpp"
 
 namespace Gameplay::Systems
 {
@@ -14,17 +15,15 @@ namespace Gameplay::Systems
 
     PlayerControllerSystem::~PlayerControllerSystem() = default;
 
-    void PlayerControllerSystem::Initialize()
-    {
-    }
-
     void PlayerControllerSystem::Run(const float delta_time)
     {
         const auto input = Input()->GetInput();
         if (!input.IsMapActive("PlayerInputMap"))
             return;
 
-        const auto player_entity = GameWorld()->GetEntityByName("Player");
+        const auto* player = GameWorld()->GetResource<Resources::Player>();
+        if (player == nullptr)
+            return;
 
         if (input.HasAction("pause"))
         {
@@ -35,14 +34,14 @@ namespace Gameplay::Systems
             return;
         }
 
-        CalculateNewTransform(player_entity, input, delta_time);
+        CalculateNewTransform(player->entity, input, delta_time);
     }
 
     void PlayerControllerSystem::CalculateNewTransform(const Engine::Ecs::EntityId player_entity,
                                                        const Engine::Input::InputBuffer& input,
                                                        const float delta_time) const
     {
-        const auto transform = GameWorld()->GetComponent<Engine::Components::Transform>(player_entity);
+        const auto transform = GameWorld()->Modify<Engine::Components::Transform>(player_entity);
         const auto rigidbody = GameWorld()->GetComponent<Engine::Components::Rigidbody>(player_entity);
         if (transform == nullptr || rigidbody == nullptr)
         {
@@ -11,8 +11,6 @@ namespace Gameplay::Systems {
 
         ~PlayerControllerSystem() override;
 
-        void Initialize() override;
-
         void Run(float delta_time) override;
 
     private:
@@ -5,8 +5,11 @@
 #pragma once
 #include <vector>
 
+#include "ComponentReflection.hpp"
 #include "SystemManager.hpp"
 
 namespace MazeGame{
     std::vector<Engine::Ecs::SystemMeta> GetSystemsFromGeneratedSource();
+
+    std::vector<Engine::Ecs::ComponentTypeInfo> GetComponentsFromGeneratedSource();
 }
@@ -11,8 +11,9 @@ struct App {
 
     void Initialize() {
         const std::vector<Engine::Ecs::SystemMeta> systems = MazeGame::GetSystemsFromGeneratedSource();
+        const std::vector<Engine::Ecs::ComponentTypeInfo> components = MazeGame::GetComponentsFromGeneratedSource();
         m_engine_controller = std::make_unique<Engine::Core::EngineController>();
-        m_engine_controller->Initialize(systems);
+        m_engine_controller->Initialize(systems, components);
 
         m_gameplay_manager = std::make_unique<Gameplay::GameplayManager>(*m_engine_controller);
         m_gameplay_manager->Initialize();
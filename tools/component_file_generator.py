@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+
+import argparse
+import re
+import sys
+from pathlib import Path
+from typing import TypedDict, List, Optional, Tuple
+
+ALLOWED_FILES = {".h", ".hpp", ".hh"}
+
+
+class ComponentField(TypedDict):
+    name: str
+    type: str
+
+
+class ComponentMeta(TypedDict):
+    name: str
+    namespace: str
+    include: str
+    fields: List[ComponentField]
+
+
+def iter_files(roots):
+    for root in roots:
+        path = Path(root)
+        if not path.exists():
+            print(f"[CodeGen] WARN: root does not exist: {root}", file=sys.stderr)
+            continue
+
+        for file in path.rglob("*"):
+            if file.suffix.lower() in ALLOWED_FILES and file.is_file():
+                yield file
+
+
+def strip_comments(content: str) -> str:
+    content = re.sub(r"/\*.*?\*/", "", content, flags=re.DOTALL)
+    return re.sub(r"//[^\n]*", "", content)
+
+
+def find_closing_brace(content: str, open_index: int) -> int:
+    depth = 0
+    for i in range(open_index, len(content)):
+        if content[i] == '{':
+            depth += 1
+        elif content[i] == '}':
+            depth -= 1
+            if depth == 0:
+                return i
+    raise ValueError("[CodeGen] Unbalanced braces")
+
+
+def extract_namespace(content: str) -> Tuple[str, int, int]:
+    """Returns the namespace name and the range of its body."""
+    match = re.search(r"\bnamespace\s+([\w:]+)\s*\{", content)
+    if match is None:
+        return "", 0, len(content)
+    open_index = match.end() - 1
+    return match.group(1), open_index + 1, find_closing_brace(content, open_index)
+
+
+def extract_types(body: str) -> List[Tuple[str, str, str]]:
+    """Returns the keyword, name and body of every struct or class declared directly in the namespace body."""
+    types = []
+    i = 0
+    while i < len(body):
+        if body[i] == '{':
+            i = find_closing_brace(body, i) + 1
+            continue
+        match = re.compile(r"\b(enum\s+class|enum|struct|class)\s+(\w+)[^;{]*\{").match(body, i)
+        if match is None:
+            i += 1
+            continue
+        open_index = match.end() - 1
+        close_index = find_closing_brace(body, open_index)
+        if not match.group(1).startswith("enum"):
+            types.append((match.group(1), match.group(2), body[open_index + 1:close_index]))
+        i = close_index + 1
+    return types
+
+
+def parse_member(statement: str) -> Optional[Tuple[str, str]]:
+    """Returns type and name if the statement declares a non-static data member."""
+    statement = " ".join(statement.split())
+    if not statement or re.match(r"(static|using|typedef|friend|template|enum|struct|class|union)\b", statement):
+        return None
+
+    declaration = re.split(r"[={]", statement, maxsplit=1)[0].strip()
+    if "(" in declaration:
+        return None
+
+    match = re.fullmatch(r"(?:mutable\s+)?(.+?)\s*\b(\w+)", declaration)
+    if match is None:
+        return None
+    return match.group(1).strip(), match.group(2)
+
+
+def extract_fields(keyword: str, name: str, body: str, file: Path) -> List[ComponentField]:
+    reflection_is_friend = re.search(rf"friend\s+struct\s+(Engine::)?Ecs::ComponentReflection<\s*{name}\s*>", body)
+    access = "public" if keyword == "struct" else "private"
+    fields: List[ComponentField] = []
+    skipped: List[str] = []
+
+    statement = ""
+    i = 0
+    while i < len(body):
+        ch = body[i]
+        access_match = re.compile(r"\s*(public|private|protected)\s*:(?!:)").match(body, i)
+        if not statement.strip() and access_match:
+            access = access_match.group(1)
+            i = access_match.end()
+            continue
+
+        if ch == '{':
+            close_index = find_closing_brace(body, i)
+            declaration = re.split(r"=", statement, maxsplit=1)[0]
+            if "(" in declaration or re.match(r"\s*(enum|struct|class|union)\b", statement):
+                # Function body or nested type, nothing to reflect
+                statement = ""
+                i = close_index + 1
+                while i < len(body) and body[i] in " \t\r\n;":
+                    i += 1
+                continue
+            statement += body[i:close_index + 1]
+            i = close_index + 1
+            continue
+
+        if ch == ';':
+            member = parse_member(statement)
+            if member is not None:
+                if access == "public" or reflection_is_friend:
+                    fields.append({"type": member[0], "name": member[1]})
+                else:
+                    skipped.append(member[1])
+            statement = ""
+        else:
+            statement += ch
+        i += 1
+
+    if skipped:
+        print(f"[CodeGen] WARN: {name} in {file} has non-public members without befriending "
+              f"Ecs::ComponentReflection<{name}>, skipped: {', '.join(skipped)}", file=sys.stderr)
+    return fields
+
+
+def normalize_include_path(file: Path) -> str:
+    file_path = str(file)
+    file_path = file_path.split("Maze Game")[-1]
+
+    if file_path.startswith("/engine/components/"):
+        file_path = file_path.replace("/engine/components/", "../engine/components/")
+    elif file_path.startswith("/gameplay/"):
+        file_path = file_path.replace("/gameplay/", "../gameplay/")
+
+    return file_path
+
+
+def find_components_in_file(file: Path) -> List[ComponentMeta]:
+    with open(file, encoding="utf-8") as f:
+        content = strip_comments(f.read())
+
+    namespace, body_begin, body_end = extract_namespace(content)
+    components: List[ComponentMeta] = []
+    for keyword, name, body in extract_types(content[body_begin:body_end]):
+        components.append({
+            "name": name,
+            "namespace": namespace,
+            "include": normalize_include_path(file),
+            "fields": extract_fields(keyword, name, body, file),
+        })
+    return components
+
+
+def qualified_name(meta: ComponentMeta) -> str:
+    return f"{meta['namespace']}::{meta['name']}" if meta['namespace'] else meta['name']
+
+
+def build_reflection(meta: ComponentMeta) -> str:
+    name = qualified_name(meta)
+    out = "\ttemplate<>\n"
+    out += f"\tstruct ComponentReflection<{name}> {{\n"
+    out += f"\t\tusing Type = {name};\n"
+    out += f"\t\tstatic constexpr std::string_view name = \"{name}\";\n"
+    out += "\t\tstatic constexpr uint64_t stable_id = HashName(name);\n"
+    out += f"\t\tstatic constexpr std::array<ComponentField, {len(meta['fields'])}> fields{{{{\n"
+    for field in meta['fields']:
+        out += (f"\t\t\t{{\"{field['name']}\", \"{field['type']}\", offsetof(Type, {field['name']}), "
+                f"sizeof(Type::{field['name']})}},\n")
+    out += "\t\t}};\n"
+    out += "\t};\n\n"
+    return out
+
+
+def build_hpp_string(metas: List[ComponentMeta]) -> str:
+    hpp_string = """// ECS_Components.gen.hpp
+// Auto-generated file.
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "ComponentReflection.hpp"
+"""
+    for include in dict.fromkeys(meta['include'] for meta in metas):
+        hpp_string += f"#include \"{include}\"\n"
+
+    hpp_string += "\nnamespace Engine::Ecs {\n"
+    for meta in metas:
+        hpp_string += build_reflection(meta)
+    hpp_string += "}\n"
+    return hpp_string
+
+
+def build_cpp_string(metas: List[ComponentMeta], hpp_name: str) -> str:
+    cpp_string = f"""// ECS_Components.gen.cpp
+// Auto-generated file.
+
+#include "Generated.hpp"
+#include "{hpp_name}"
+
+std::vector<Engine::Ecs::ComponentTypeInfo> MazeGame::GetComponentsFromGeneratedSource(){{
+\treturn {{
+"""
+    for meta in metas:
+        cpp_string += f"\t\tEngine::Ecs::ComponentTypeInfo::Of<{qualified_name(meta)}>(),\n"
+    cpp_string += """\t};
+}"""
+    return cpp_string
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--out", required=True, help="Path to generated cpp file, the header is written next to it")
+    parser.add_argument("--roots", nargs="+", required=True, help="Directories to scan for component types")
+    args = parser.parse_args()
+
+    out_path = Path(args.out)
+    out_path.parent.mkdir(parents=True, exist_ok=True)
+    hpp_path = out_path.with_suffix(".hpp")
+
+    metas: List[ComponentMeta] = []
+    files = sorted(iter_files(args.roots))
+    print(f"[CodeGen] files: {len(files)}")
+    for f in files:
+        print("\t*", f)
+        try:
+            metas.extend(find_components_in_file(f))
+        except Exception as ex:
+            print(f"[CodeGen] ERROR while parsing {f}: {ex}", file=sys.stderr)
+            raise
+
+    # The position in the table is the type id, sorting by name keeps it stable across runs
+    metas.sort(key=qualified_name)
+    hpp_path.write_text(build_hpp_string(metas), encoding="utf-8")
+    out_path.write_text(build_cpp_string(metas, hpp_path.name), encoding="utf-8")
+    print(f"[CodeGen] Wrote {len(metas)} components to {hpp_path} and {out_path}")
+
+
+if __name__ == "__main__":
+    main()
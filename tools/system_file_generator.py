@@ -16,6 +16,8 @@ class SystemMeta(TypedDict):
     phase: str
     tags: List[str]
     dependencies: List[str]
+    reads: Optional[List[str]]
+    writes: Optional[List[str]]
     isSystem: bool
 
 
@@ -93,6 +95,15 @@ def extract_macro_list(value: str, macro_name: str) -> List[str]:
     return [item.strip() for item in inner.split(",") if item.strip()]
 
 
+def extract_access_list(value: str, macro_name: str) -> List[str]:
+    # Access sets are compared by unqualified type name, namespaces and const are dropped.
+    types = []
+    for item in extract_macro_list(value, macro_name):
+        type_name = item.replace("const ", "").strip()
+        types.append(type_name.split("::")[-1])
+    return types
+
+
 def build_includes(metas: List[SystemMeta]) -> str:
     include_str = "#include \"Generated.hpp\"\n"
 
@@ -130,6 +141,17 @@ def build_string_list(field_name: str, values: List[str]) -> str:
     return out
 
 
+def build_access(meta: SystemMeta) -> str:
+    if meta['reads'] is None and meta['writes'] is None:
+        return ""
+
+    out = "\t\t\t.access = Engine::Ecs::SystemAccess{\n"
+    out += "\t" + build_string_list("reads", meta['reads'] or [])
+    out += "\t" + build_string_list("writes", meta['writes'] or [])
+    out += "\t\t\t},\n"
+    return out
+
+
 def build_meta_list_entry(meta: SystemMeta) -> str:
     if not meta['isSystem']:
         return ""
@@ -139,7 +161,9 @@ def build_meta_list_entry(meta: SystemMeta) -> str:
     meta_string += f"\t\t\t.phase = Engine::Ecs::Phase::{meta['phase']},\n"
     meta_string += build_string_list("tags", meta['tags'])
     meta_string += build_string_list("dependencies", meta['dependencies'])
-    meta_string += f"\t\t\t.factory = &Create_{meta['name']}\n"
+    meta_string += build_access(meta)
+    meta_string += f"\t\t\t.factory = &Create_{meta['name']},\n"
+    meta_string += f"\t\t\t.dispatch = Engine::Ecs::MakeSystemDispatch<{meta['namespace']}::{meta['name']}>()\n"
     meta_string += "\t\t},\n"
 
     return meta_string
@@ -176,6 +200,8 @@ def find_ecs_meta_in_file(file: Path) -> SystemMeta:
         "phase": "",
         "tags": [],
         "dependencies": [],
+        "reads": None,
+        "writes": None,
         "isSystem": False,
     }
 
@@ -189,10 +215,11 @@ def find_ecs_meta_in_file(file: Path) -> SystemMeta:
         return sys_meta
 
     args = split_top_level_args(ecs_call)
-    if len(args) != 4:
+    if len(args) < 4 or len(args) > 6:
         raise ValueError(
             f"[CodeGen] Invalid ECS_SYSTEM signature in {file}. "
-            f"Expected 4 arguments (name, phase, tags, dependencies), got {len(args)}: {args}"
+            f"Expected 4 to 6 arguments (name, phase, tags, dependencies[, reads][, writes]), "
+            f"got {len(args)}: {args}"
         )
 
     sys_meta['name'] = args[0]
@@ -200,6 +227,13 @@ def find_ecs_meta_in_file(file: Path) -> SystemMeta:
     sys_meta['phase'] = args[1]
     sys_meta['tags'] = extract_macro_list(args[2], "TAGS")
     sys_meta['dependencies'] = extract_macro_list(args[3], "DEPENDENCIES")
+    for access_arg in args[4:]:
+        if access_arg.startswith("READS(") and sys_meta['reads'] is None:
+            sys_meta['reads'] = extract_access_list(access_arg, "READS")
+        elif access_arg.startswith("WRITES(") and sys_meta['writes'] is None:
+            sys_meta['writes'] = extract_access_list(access_arg, "WRITES")
+        else:
+            raise ValueError(f"[CodeGen] Expected a single READS(...) and WRITES(...) in {file} but got: {access_arg}")
     sys_meta['isSystem'] = True
 
     return sys_meta